@@ -255,6 +255,15 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * Set the modification time of the scalar and offset fields (see
+     * ttk::VertexOrder).
+     */
+    inline int setInputModificationTime(const unsigned long long &time) {
+      discreteGradient_.setInputModificationTime(time);
+      return 0;
+    }
+
     /**
      * Set the output critical points data pointers.
      */
@@ -430,6 +439,14 @@ namespace ttk {
                              const SimplexId *const descendingManifold,
                              SimplexId *const morseSmaleManifold) const;
 
+    /**
+     * Report the memory footprint of the internal buffers (the discrete
+     * gradient, the outputs being owned by the caller).
+     */
+    int getMemoryReport(MemoryReport &report) const override {
+      return discreteGradient_.getMemoryReport(report);
+    }
+
   protected:
     bool ReverveSaddleMaximumConnection;
     bool ReverveSaddleSaddleConnection;
@@ -5,6 +5,8 @@ using namespace ttk;
 
 AbstractTriangulation::AbstractTriangulation() {
 
+  lazyMode_ = false;
+
   clear();
 }
 
@@ -57,88 +59,57 @@ int AbstractTriangulation::clear() {
   vertexStarList_.clear();
   vertexTriangleList_.clear();
 
+  relationCache_.clear();
+
   return 0;
 }
 
-template <class itemType>
-size_t AbstractTriangulation::tableTableFootprint(
-  const vector<vector<itemType>> &table,
-  const string tableName,
-  stringstream *msg) const {
-
-  size_t localByteNumber = 0;
-
-  for(size_t i = 0; i < table.size(); i++) {
-    localByteNumber += table[i].size() * sizeof(itemType);
+int AbstractTriangulation::getMemoryReport(MemoryReport &report) const {
+
+  const string component = "AbstractTriangulation";
+
+  report.add(
+    component, "boundaryEdges_", MemoryReport::bytes(boundaryEdges_));
+  report.add(component, "boundaryTriangles_",
+             MemoryReport::bytes(boundaryTriangles_));
+  report.add(
+    component, "boundaryVertices_", MemoryReport::bytes(boundaryVertices_));
+  report.add(component, "edgeList_", MemoryReport::bytes(edgeList_));
+
+  // legacy jagged tables (see the get*s() functions)
+  const vector<pair<const vector<vector<SimplexId>> *, string>> tables = {
+    {&cellEdgeList_, "cellEdgeList_"},
+    {&cellNeighborList_, "cellNeighborList_"},
+    {&cellTriangleList_, "cellTriangleList_"},
+    {&edgeLinkList_, "edgeLinkList_"},
+    {&edgeStarList_, "edgeStarList_"},
+    {&edgeTriangleList_, "edgeTriangleList_"},
+    {&triangleList_, "triangleList_"},
+    {&triangleEdgeList_, "triangleEdgeList_"},
+    {&triangleLinkList_, "triangleLinkList_"},
+    {&triangleStarList_, "triangleStarList_"},
+    {&vertexEdgeList_, "vertexEdgeList_"},
+    {&vertexLinkList_, "vertexLinkList_"},
+    {&vertexNeighborList_, "vertexNeighborList_"},
+    {&vertexStarList_, "vertexStarList_"},
+    {&vertexTriangleList_, "vertexTriangleList_"}};
+  for(const auto &table : tables) {
+    report.add(component, table.second, MemoryReport::bytes(*table.first));
   }
 
-  if((localByteNumber) && (tableName.length()) && (msg)) {
-    (*msg) << "[AbstractTriangulation] " << tableName << ": " << localByteNumber
-           << " bytes" << endl;
-  }
+  report.add(component, "relationCache_", relationCache_.footprint());
 
-  return localByteNumber;
+  return 0;
 }
 
 size_t AbstractTriangulation::footprint() const {
 
-  size_t size = sizeof(*this);
-  stringstream msg;
-
-  size += tableFootprint<bool>(boundaryEdges_, "boundaryEdges_", &msg);
-
-  size += tableFootprint<bool>(boundaryTriangles_, "boundaryTriangles_", &msg);
-
-  size += tableFootprint<bool>(boundaryVertices_, "boundaryVertices_", &msg);
-
-  size += tableTableFootprint<SimplexId>(cellEdgeList_, "cellEdgeList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    cellNeighborList_, "cellNeighborList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    cellTriangleList_, "cellTriangleList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(edgeLinkList_, "edgeLinkList_", &msg);
-
-  size
-    += tableFootprint<pair<SimplexId, SimplexId>>(edgeList_, "edgeList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(edgeStarList_, "edgeStarList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    edgeTriangleList_, "edgeTriangleList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(triangleList_, "triangleList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    triangleEdgeList_, "triangleEdgeList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    triangleLinkList_, "triangleLinkList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    triangleStarList_, "triangleStarList_", &msg);
-
-  size
-    += tableTableFootprint<SimplexId>(vertexEdgeList_, "vertexEdgeList_", &msg);
-
-  size
-    += tableTableFootprint<SimplexId>(vertexLinkList_, "vertexLinkList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    vertexNeighborList_, "vertexNeighborList_", &msg);
-
-  size
-    += tableTableFootprint<SimplexId>(vertexStarList_, "vertexStarList_", &msg);
-
-  size += tableTableFootprint<SimplexId>(
-    vertexTriangleList_, "vertexTriangleList_", &msg);
-
-  msg << "[AbstractTriangulation] Total footprint: " << (size / 1024) / 1024
-      << " MB." << endl;
+  MemoryReport report;
+  getMemoryReport(report);
 
+  stringstream msg;
+  report.print(msg, "[AbstractTriangulation] ");
   dMsg(cout, msg.str(), memoryMsg);
 
-  return size;
+  return sizeof(*this) + report.getTotal();
 }
@@ -14,6 +14,7 @@
 
 // base code includes
 #include <Geometry.h>
+#include <RelationCache.h>
 #include <Wrapper.h>
 
 namespace ttk {
@@ -27,8 +28,13 @@ namespace ttk {
 
     virtual int clear();
 
+    /// Computes and displays the memory footprint of the data-structure.
+    /// \return Returns the number of bytes used by the data-structure.
+    /// \sa getMemoryReport()
     virtual size_t footprint() const;
 
+    int getMemoryReport(MemoryReport &report) const override;
+
     virtual int getCellEdge(const SimplexId &cellId,
                             const int &localEdgeId,
                             SimplexId &edgeId) const = 0;
@@ -61,6 +67,16 @@ namespace ttk {
 
     virtual int getDimensionality() const = 0;
 
+    /// Get the number of vertices along each axis, if the triangulation is
+    /// the implicit triangulation of a (non-periodic) regular grid. The
+    /// vertex identifiers then follow the row-major order of the grid.
+    /// \return Returns 0 upon success, -1 if the triangulation is not a
+    /// regular grid.
+    virtual int getRegularGridDimensions(SimplexId dimensions[3]) const {
+      (void)dimensions;
+      return -1;
+    }
+
     virtual const std::vector<std::pair<SimplexId, SimplexId>> *getEdges() = 0;
 
     virtual int getEdgeLink(const SimplexId &edgeId,
@@ -191,6 +207,19 @@ namespace ttk {
       return hasPreprocessedBoundaryVertices_;
     }
 
+    /// Get the memory budget (in bytes) of the relation cache used in lazy
+    /// mode.
+    /// \sa setLazyMode()
+    inline size_t getCacheMemoryBudget() const {
+      return relationCache_.getMemoryBudget();
+    }
+
+    /// Check if the lazy mode is enabled.
+    /// \sa setLazyMode()
+    inline bool getLazyMode() const {
+      return lazyMode_;
+    }
+
     virtual inline bool hasPreprocessedCellEdges() const {
       return hasPreprocessedCellEdges_;
     }
@@ -372,6 +401,34 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the memory budget (in bytes) of the relation cache used in lazy
+    /// mode. If the cache currently uses more memory, the least recently used
+    /// blocks are evicted.
+    /// \sa setLazyMode()
+    virtual int setCacheMemoryBudget(const size_t &memoryBudget) {
+      relationCache_.setMemoryBudget(memoryBudget);
+      return 0;
+    }
+
+    /// Enable or disable the lazy mode.
+    ///
+    /// In lazy mode, the pre-processing functions of the relations that
+    /// support it (edge links, edge stars, triangle links and vertex links,
+    /// for explicit triangulations) only compute the prerequisites of these
+    /// relations. The relations themselves are then computed by blocks of
+    /// simplices upon first access and stored in a cache whose memory is
+    /// bounded (see setCacheMemoryBudget()). This avoids pre-processing the
+    /// whole mesh when only a few simplices are queried.
+    ///
+    /// The mode is taken into account by the subsequent calls to the
+    /// pre-processing functions; relations already pre-processed are kept.
+    /// Implicit triangulations ignore this mode (they do not store their
+    /// relations anyway).
+    virtual int setLazyMode(const bool &lazyMode) {
+      lazyMode_ = lazyMode;
+      return 0;
+    }
+
     /**
      * Compute the barycenter of the points of the given edge identifier.
      */
@@ -483,28 +540,13 @@ namespace ttk {
       return false;
     };
 
-    template <class itemType>
-    size_t tableFootprint(const std::vector<itemType> &table,
-                          const std::string tableName = "",
-                          std::stringstream *msg = NULL) const {
-
-      if((table.size()) && (tableName.length()) && (msg)) {
-        (*msg) << "[AbstractTriangulation] " << tableName << ": "
-               << table.size() * sizeof(itemType) << " bytes" << std::endl;
-      }
-
-      return table.size() * sizeof(itemType);
-    }
-
-    template <class itemType>
-    size_t tableTableFootprint(const std::vector<std::vector<itemType>> &table,
-                               const std::string tableName = "",
-                               std::stringstream *msg = NULL) const;
-
     int updateProgress(const float &progress) {
       return 0;
     };
 
+    bool lazyMode_;
+    RelationCache relationCache_;
+
     bool hasPreprocessedBoundaryEdges_, hasPreprocessedBoundaryTriangles_,
       hasPreprocessedBoundaryVertices_, hasPreprocessedCellEdges_,
       hasPreprocessedCellNeighbors_, hasPreprocessedCellTriangles_,
@@ -0,0 +1,233 @@
+/// \ingroup base
+/// \class ttk::RelationCache
+/// \date October 2019.
+///
+/// \brief Memory-bounded cache of blocks of triangulation relations.
+///
+/// In lazy mode, triangulations do not materialize some of their relations
+/// (edge stars, links, etc.) for the whole mesh at pre-processing time.
+/// Instead, the relation is computed by blocks of consecutive simplices upon
+/// first access, and stored in this cache. When the memory used by the
+/// cached blocks exceeds the memory budget, the least recently used blocks
+/// are evicted.
+///
+/// Each thread keeps a reference on the last block it accessed for each
+/// relation (in thread-local storage, for the few caches it used last), so
+/// that consecutive queries on the same block do not take the cache lock.
+/// The memory actually used can therefore exceed the budget by at most one
+/// block per thread and per relation. These references are released when
+/// the thread moves to other caches or terminates.
+///
+/// Copying a cache yields an empty cache with the same memory budget.
+///
+/// \sa ttk::AbstractTriangulation
+/// \sa ttk::ExplicitTriangulation
+
+#ifndef _RELATIONCACHE_H
+#define _RELATIONCACHE_H
+
+#include <FlatJaggedArray.h>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace ttk {
+
+  class RelationCache {
+
+  public:
+    using Block = std::shared_ptr<const FlatJaggedArray>;
+
+    /// Maximum number of relations handled by a single cache.
+    static const int relationNumber = 8;
+
+    RelationCache() {
+      initialize();
+    }
+
+    RelationCache(const RelationCache &rhs) {
+      initialize();
+      memoryBudget_ = rhs.memoryBudget_;
+    }
+
+    RelationCache &operator=(const RelationCache &rhs) {
+      if(this != &rhs) {
+        clear();
+        memoryBudget_ = rhs.memoryBudget_;
+      }
+      return *this;
+    }
+
+    ~RelationCache() {
+    }
+
+    /// Remove all the cached blocks.
+    /// \warning Not thread-safe: should not be called concurrently with
+    /// get().
+    inline void clear() {
+      lru_.clear();
+      index_.clear();
+      usedBytes_ = 0;
+      // invalidate the last blocks of the threads
+      cacheId_ = newCacheId();
+    }
+
+    /// Memory used by the cached blocks (in bytes).
+    inline size_t footprint() const {
+      return usedBytes_;
+    }
+
+    inline size_t getMemoryBudget() const {
+      return memoryBudget_;
+    }
+
+    /// Set the memory budget (in bytes) of the cache.
+    inline void setMemoryBudget(const size_t &memoryBudget) {
+      lock();
+      memoryBudget_ = memoryBudget;
+      evict();
+      unlock();
+    }
+
+    /// Get the block \p blockId of the relation \p relationId, calling
+    /// \p builder (which takes a FlatJaggedArray to fill as argument) if the
+    /// block is not in the cache.
+    ///
+    /// The returned pointer remains valid until the next call to get() on
+    /// the same relation by the calling thread (or until this thread
+    /// accesses several other caches).
+    template <class builderType>
+    inline const FlatJaggedArray *get(const int &relationId,
+                                      const SimplexId &blockId,
+                                      const builderType &builder) const {
+
+      const uint64_t key
+        = ((uint64_t)blockId) * relationNumber + (uint64_t)relationId;
+
+      std::pair<uint64_t, Block> &slot = getThreadSlot(relationId);
+      if((!slot.second) || (slot.first != key)) {
+        slot.second = fetch(key, builder);
+        slot.first = key;
+      }
+      return slot.second.get();
+    }
+
+  protected:
+    inline void initialize() {
+      usedBytes_ = 0;
+      // default budget: 1 GB
+      memoryBudget_ = ((size_t)1) << 30;
+      cacheId_ = newCacheId();
+    }
+
+    // unique identifier of a cache (never 0), renewed by clear()
+    static inline uint64_t newCacheId() {
+      static std::atomic<uint64_t> cacheNumber(0);
+      return ++cacheNumber;
+    }
+
+    // last blocks accessed by the calling thread for a given cache
+    struct ThreadSlots {
+      uint64_t cacheId;
+      std::pair<uint64_t, Block> blocks[relationNumber];
+    };
+
+    // slot of the last block of the relation relationId accessed by the
+    // calling thread, whatever the threading layer (OpenMP, std::thread).
+    // the threads keep the slots of their last threadSlotNumber caches.
+    inline std::pair<uint64_t, Block> &
+      getThreadSlot(const int &relationId) const {
+      static const int threadSlotNumber = 4;
+      static thread_local ThreadSlots threadSlots[threadSlotNumber] = {};
+      static thread_local int nextThreadSlot = 0;
+
+      for(int i = 0; i < threadSlotNumber; i++) {
+        if(threadSlots[i].cacheId == cacheId_)
+          return threadSlots[i].blocks[relationId];
+      }
+
+      // replace the slots of the oldest cache
+      ThreadSlots &slots = threadSlots[nextThreadSlot];
+      nextThreadSlot = (nextThreadSlot + 1) % threadSlotNumber;
+      slots.cacheId = cacheId_;
+      for(auto &slot : slots.blocks) {
+        slot.first = 0;
+        slot.second.reset();
+      }
+      return slots.blocks[relationId];
+    }
+
+    inline void lock() const {
+      mutex_.lock();
+    }
+
+    inline void unlock() const {
+      mutex_.unlock();
+    }
+
+    // evict the least recently used blocks until the budget is met (the most
+    // recently used block is always kept). the lock should be held.
+    inline void evict() const {
+      while((usedBytes_ > memoryBudget_) && (lru_.size() > 1)) {
+        usedBytes_ -= lru_.back().second->footprint();
+        index_.erase(lru_.back().first);
+        lru_.pop_back();
+      }
+    }
+
+    template <class builderType>
+    inline Block fetch(const uint64_t &key, const builderType &builder) const {
+
+      lock();
+      auto it = index_.find(key);
+      if(it != index_.end()) {
+        // move to the front of the LRU list
+        lru_.splice(lru_.begin(), lru_, it->second);
+        Block block = it->second->second;
+        unlock();
+        return block;
+      }
+      unlock();
+
+      // build outside of the lock, so that threads requesting different
+      // blocks do not wait for each other
+      std::shared_ptr<FlatJaggedArray> newBlock
+        = std::make_shared<FlatJaggedArray>();
+      builder(*newBlock);
+      // narrow identifiers, if possible (64-bit identifier builds only)
+      newBlock->compact();
+
+      lock();
+      it = index_.find(key);
+      if(it != index_.end()) {
+        // another thread built it in the meantime
+        Block block = it->second->second;
+        unlock();
+        return block;
+      }
+      lru_.emplace_front(key, newBlock);
+      index_[key] = lru_.begin();
+      usedBytes_ += newBlock->footprint();
+      evict();
+      unlock();
+
+      return newBlock;
+    }
+
+    size_t memoryBudget_;
+    mutable size_t usedBytes_;
+    mutable std::list<std::pair<uint64_t, Block>> lru_;
+    mutable std::unordered_map<uint64_t,
+                               std::list<std::pair<uint64_t, Block>>::iterator>
+      index_;
+    uint64_t cacheId_;
+    mutable std::mutex mutex_;
+  };
+} // namespace ttk
+
+#endif // _RELATIONCACHE_H
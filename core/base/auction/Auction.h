@@ -52,7 +52,6 @@ namespace ttk {
     }
 
     KDTree<dataType> *kdt_;
-    std::vector<KDTree<dataType> *> correspondance_kdt_map_;
 
     Auction(int wasserstein,
             double geometricalFactor,
@@ -81,7 +80,6 @@ namespace ttk {
             double lambda,
             double delta_lim,
             KDTree<dataType> *kdt,
-            std::vector<KDTree<dataType> *> &correspondance_kdt_map,
             dataType epsilon,
             dataType initial_diag_price,
             bool use_kdTree = true) {
@@ -127,7 +125,6 @@ namespace ttk {
       use_kdt_ = (use_kdTree && goods_->size() > 0);
       if(use_kdt_) {
         kdt_ = kdt;
-        correspondance_kdt_map_ = correspondance_kdt_map;
       }
     };
 
@@ -143,6 +140,11 @@ namespace ttk {
     };
 
     void runAuctionRound(int &n_biddings, const int kdt_index = 0);
+    // Jacobi variant of runAuctionRound(): the unassigned off-diagonal
+    // bidders bid concurrently against the current prices, then each good
+    // goes to its highest bidder. The diagonal bidders, which all compete
+    // for the cheapest diagonal goods, still bid one at a time.
+    void runJacobiAuctionRound(int &n_biddings, const int kdt_index = 0);
     dataType getMatchingsAndDistance(std::vector<matchingTuple> *matchings,
                                      bool get_diagonal_matches = false);
     dataType run(std::vector<matchingTuple> *matchings);
@@ -239,23 +241,20 @@ namespace ttk {
     void buildKDTree() {
       Timer t;
       kdt_ = new KDTree<dataType>(true, wasserstein_);
-      const int dimension
-        = geometricalFactor_ >= 1 ? (geometricalFactor_ <= 0 ? 3 : 2) : 5;
+      // same coordinates as Bidder::getKDTCoordinates()
+      const int dimension = geometricalFactor_ >= 1 ? 2 : 5;
       std::vector<dataType> coordinates;
       for(int i = 0; i < goods_->size(); i++) {
         Good<dataType> &g = goods_->get(i);
-        if(geometricalFactor_ > 0) {
-          coordinates.push_back(geometricalFactor_ * g.x_);
-          coordinates.push_back(geometricalFactor_ * g.y_);
-        }
+        coordinates.push_back(geometricalFactor_ * g.x_);
+        coordinates.push_back(geometricalFactor_ * g.y_);
         if(geometricalFactor_ < 1) {
           coordinates.push_back((1 - geometricalFactor_) * g.coords_x_);
           coordinates.push_back((1 - geometricalFactor_) * g.coords_y_);
           coordinates.push_back((1 - geometricalFactor_) * g.coords_z_);
         }
       }
-      correspondance_kdt_map_
-        = kdt_->build(coordinates.data(), goods_->size(), dimension);
+      kdt_->build(coordinates.data(), goods_->size(), dimension);
     }
 
     void setEpsilon(dataType epsilon) {
@@ -354,10 +353,18 @@ namespace ttk {
     }
 
   protected:
+    dataType getBiddingEpsilon();
+    int runBidding(const int pos, const dataType epsilon, const int kdt_index);
+    void updateGoodArrays(Bidder<dataType> &b);
+
     int wasserstein_; // Power in Wassertsein distance (by default set to 2)
     BidderDiagram<dataType> *bidders_;
     GoodDiagram<dataType> *goods_;
     GoodDiagram<dataType> *diagonal_goods_;
+    // copy of goods_ scanned by the brute-force bidding search (without
+    // KD-Tree), and its buffer of values
+    GoodArrays<dataType> goodArrays_;
+    std::vector<dataType> goodValues_;
     std::priority_queue<std::pair<int, dataType>,
                         std::vector<std::pair<int, dataType>>,
                         Compare<dataType>>
@@ -338,6 +338,135 @@ namespace ttk {
     goods_[idx] = g;
   }
 
+  template <typename dataType>
+  class GoodArrays {
+    /// Structure-of-arrays copy of the goods of a GoodDiagram (coordinates,
+    /// diagonal flags and prices), scanned by the brute-force bidding
+    /// search. The copy is made at the beginning of an auction round, the
+    /// auction then keeps the prices up to date.
+
+  public:
+    GoodArrays(){};
+
+    ~GoodArrays(){};
+
+    void build(GoodDiagram<dataType> *goods,
+               int wasserstein,
+               double geometricalFactor);
+
+    inline void setPrice(int idx, dataType price) {
+      prices_[idx] = price;
+    }
+
+    inline int size() const {
+      return prices_.size();
+    }
+
+    // Values (opposite of the cost, minus the price) of all the goods for
+    // an off-diagonal bidder, with the same arithmetic as
+    // AuctionActor::cost()
+    void getValues(AuctionActor<dataType> &bidder,
+                   int wasserstein,
+                   double geometricalFactor,
+                   std::vector<dataType> &values) const;
+
+  private:
+    template <int power>
+    void computeValues(AuctionActor<dataType> &bidder,
+                       int wasserstein,
+                       double geometricalFactor,
+                       std::vector<dataType> &values) const;
+
+    std::vector<dataType> x_;
+    std::vector<dataType> y_;
+    std::vector<float> coords_x_;
+    std::vector<float> coords_y_;
+    std::vector<float> coords_z_;
+    // geometrical part of the cost of the diagonal goods
+    std::vector<double> diagonal_costs_;
+    std::vector<char> is_diagonal_;
+    std::vector<dataType> prices_;
+  };
+
+  template <typename dataType>
+  void GoodArrays<dataType>::build(GoodDiagram<dataType> *goods,
+                                   int wasserstein,
+                                   double geometricalFactor) {
+    const int n = goods->size();
+    x_.resize(n);
+    y_.resize(n);
+    coords_x_.resize(n);
+    coords_y_.resize(n);
+    coords_z_.resize(n);
+    diagonal_costs_.resize(n);
+    is_diagonal_.resize(n);
+    prices_.resize(n);
+    for(int i = 0; i < n; i++) {
+      Good<dataType> &g = goods->get(i);
+      x_[i] = g.x_;
+      y_[i] = g.y_;
+      coords_x_[i] = g.coords_x_;
+      coords_y_[i] = g.coords_y_;
+      coords_z_[i] = g.coords_z_;
+      diagonal_costs_[i]
+        = (1 - geometricalFactor) * g.getPairGeometricalLength(wasserstein);
+      is_diagonal_[i] = g.isDiagonal();
+      prices_[i] = g.getPrice();
+    }
+  }
+
+  template <typename dataType>
+  void GoodArrays<dataType>::getValues(AuctionActor<dataType> &bidder,
+                                       int wasserstein,
+                                       double geometricalFactor,
+                                       std::vector<dataType> &values) const {
+    // the usual powers are expanded, so that the scan vectorizes
+    switch(wasserstein) {
+      case 1:
+        computeValues<1>(bidder, wasserstein, geometricalFactor, values);
+        break;
+      case 2:
+        computeValues<2>(bidder, wasserstein, geometricalFactor, values);
+        break;
+      default:
+        computeValues<0>(bidder, wasserstein, geometricalFactor, values);
+    }
+  }
+
+  template <typename dataType>
+  template <int power>
+  void GoodArrays<dataType>::computeValues(
+    AuctionActor<dataType> &bidder,
+    int wasserstein,
+    double geometricalFactor,
+    std::vector<dataType> &values) const {
+    auto pw = [wasserstein](const dataType v) -> dataType {
+      return power == 1 ? v : power == 2 ? v * v : pow(v, wasserstein);
+    };
+    auto abs = [](const dataType v) -> dataType { return v >= 0 ? v : -v; };
+
+    const dataType x = bidder.x_;
+    const dataType y = bidder.y_;
+    const float cx = bidder.coords_x_;
+    const float cy = bidder.coords_y_;
+    const float cz = bidder.coords_z_;
+    const double geometricalComplement = 1 - geometricalFactor;
+    const double toDiagonal = geometricalFactor * (2 * pw(abs(y / 2 - x / 2)));
+
+    const int n = size();
+    values.resize(n);
+    for(int i = 0; i < n; i++) {
+      const double diagonalCost = toDiagonal + diagonal_costs_[i];
+      const double cost
+        = geometricalFactor * (pw(abs(x - x_[i])) + pw(abs(y - y_[i])))
+          + geometricalComplement
+              * (pw(abs(cx - coords_x_[i])) + pw(abs(cy - coords_y_[i]))
+                 + pw(abs(cz - coords_z_[i])));
+      values[i]
+        = -(dataType)(is_diagonal_[i] ? diagonalCost : cost) - prices_[i];
+    }
+  }
+
   template <typename dataType>
   class Bidder : public AuctionActor<dataType> {
   public:
@@ -410,12 +539,52 @@ namespace ttk {
     ~Bidder() {
     }
 
+    // Off-diagonal bid against the current prices: returns the good the
+    // bidder bids for and the offered price, without assigning anything
+    // (with or without the use of a KD-Tree, closestId being the index of
+    // the good in the KD-Tree, or -1). Without KD-Tree, the goods are
+    // scanned through goodArrays, values being a buffer.
+    Good<dataType> *getBid(GoodDiagram<dataType> *goods,
+                           const GoodArrays<dataType> &goodArrays,
+                           Good<dataType> &twinGood,
+                           int wasserstein,
+                           dataType epsilon,
+                           double geometricalFactor,
+                           dataType &price,
+                           std::vector<dataType> &values);
+    Good<dataType> *getKDTBid(GoodDiagram<dataType> *goods,
+                              Good<dataType> &twinGood,
+                              int wasserstein,
+                              dataType epsilon,
+                              double geometricalFactor,
+                              KDTree<dataType> *kdt,
+                              dataType &price,
+                              int &closestId,
+                              const int kdt_index = 0);
+    // Same, from the (up to 2) closest goods given by the KD-Tree, sorted by
+    // increasing cost
+    Good<dataType> *getKDTBid(GoodDiagram<dataType> *goods,
+                              Good<dataType> &twinGood,
+                              int wasserstein,
+                              dataType epsilon,
+                              double geometricalFactor,
+                              const int *neighbours,
+                              const dataType *costs,
+                              const int neighbourNumber,
+                              dataType &price,
+                              int &closestId);
+    // Coordinates of the bidder in the KD-Tree of the goods
+    void getKDTCoordinates(double geometricalFactor,
+                           std::vector<dataType> &coordinates);
+
     // Off-diagonal Bidding (with or without the use of a KD-Tree
     int runBidding(GoodDiagram<dataType> *goods,
+                   const GoodArrays<dataType> &goodArrays,
                    Good<dataType> &diagonalGood,
                    int wasserstein,
                    dataType epsilon,
-                   double geometricalFactor);
+                   double geometricalFactor,
+                   std::vector<dataType> &values);
     int runKDTBidding(GoodDiagram<dataType> *goods,
                       Good<dataType> &diagonalGood,
                       int wasserstein,
@@ -440,7 +609,7 @@ namespace ttk {
       int wasserstein,
       dataType epsilon,
       double geometricalFactor,
-      std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+      KDTree<dataType> *kdt,
       std::priority_queue<std::pair<int, dataType>,
                           std::vector<std::pair<int, dataType>>,
                           Compare<dataType>> &diagonal_queue,
@@ -474,22 +643,25 @@ namespace ttk {
   }
 
   template <typename dataType>
-  int Bidder<dataType>::runBidding(GoodDiagram<dataType> *goods,
-                                   Good<dataType> &twinGood,
-                                   int wasserstein,
-                                   dataType epsilon,
-                                   double geometricalFactor) {
+  Good<dataType> *
+    Bidder<dataType>::getBid(GoodDiagram<dataType> *goods,
+                             const GoodArrays<dataType> &goodArrays,
+                             Good<dataType> &twinGood,
+                             int wasserstein,
+                             dataType epsilon,
+                             double geometricalFactor,
+                             dataType &price,
+                             std::vector<dataType> &values) {
     dataType best_val = std::numeric_limits<dataType>::lowest();
     dataType second_val = std::numeric_limits<dataType>::lowest();
     Good<dataType> *best_good = nullptr;
-    for(int i = 0; i < goods->size(); i++) {
-      Good<dataType> &g = goods->get(i);
-      dataType val = -this->cost(g, wasserstein, geometricalFactor);
-      val -= g.getPrice();
+    goodArrays.getValues(*this, wasserstein, geometricalFactor, values);
+    for(int i = 0; i < (int)values.size(); i++) {
+      const dataType val = values[i];
       if(val > best_val) {
         second_val = best_val;
         best_val = val;
-        best_good = &g;
+        best_good = &goods->get(i);
       } else if(val > second_val) {
         second_val = val;
       }
@@ -516,6 +688,23 @@ namespace ttk {
       new_price = old_price + epsilon;
       std::cout << "Huho 376" << std::endl;
     }
+    price = new_price;
+    return best_good;
+  }
+
+  template <typename dataType>
+  int Bidder<dataType>::runBidding(GoodDiagram<dataType> *goods,
+                                   const GoodArrays<dataType> &goodArrays,
+                                   Good<dataType> &twinGood,
+                                   int wasserstein,
+                                   dataType epsilon,
+                                   double geometricalFactor,
+                                   std::vector<dataType> &values) {
+    dataType new_price;
+    Good<dataType> *best_good
+      = this->getBid(goods, goodArrays, twinGood, wasserstein, epsilon,
+                     geometricalFactor, new_price, values);
+
     // Assign bidder to best_good
     this->setProperty(best_good);
     this->setPricePaid(new_price);
@@ -651,7 +840,7 @@ namespace ttk {
     int wasserstein,
     dataType epsilon,
     double geometricalFactor,
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+    KDTree<dataType> *kdt,
     std::priority_queue<std::pair<int, dataType>,
                         std::vector<std::pair<int, dataType>>,
                         Compare<dataType>> &diagonal_queue,
@@ -762,8 +951,7 @@ namespace ttk {
     if(is_twin) {
       // std::cout << "got here 5" << std::endl;
       // Update weight in KDTree if the closest good is in it
-      correspondance_kdt_map[best_good->id_]->updateWeight(
-        new_price, kdt_index);
+      kdt->updateWeight(best_good->id_, new_price, kdt_index);
       if(non_empty_goods) {
         diagonal_queue.push(best_pair);
       }
@@ -779,18 +967,8 @@ namespace ttk {
   }
 
   template <typename dataType>
-  int Bidder<dataType>::runKDTBidding(GoodDiagram<dataType> *goods,
-                                      Good<dataType> &twinGood,
-                                      int wasserstein,
-                                      dataType epsilon,
-                                      double geometricalFactor,
-                                      KDTree<dataType> *kdt,
-                                      const int kdt_index) {
-    /// Runs bidding of a non-diagonal bidder
-    std::vector<KDTree<dataType> *> neighbours;
-    std::vector<dataType> costs;
-
-    std::vector<dataType> coordinates;
+  void Bidder<dataType>::getKDTCoordinates(double geometricalFactor,
+                                           std::vector<dataType> &coordinates) {
     coordinates.push_back(geometricalFactor * this->x_);
     coordinates.push_back(geometricalFactor * this->y_);
     if(geometricalFactor < 1) {
@@ -798,36 +976,50 @@ namespace ttk {
       coordinates.push_back((1 - geometricalFactor) * this->coords_y_);
       coordinates.push_back((1 - geometricalFactor) * this->coords_z_);
     }
+  }
+
+  template <typename dataType>
+  Good<dataType> *Bidder<dataType>::getKDTBid(GoodDiagram<dataType> *goods,
+                                              Good<dataType> &twinGood,
+                                              int wasserstein,
+                                              dataType epsilon,
+                                              double geometricalFactor,
+                                              KDTree<dataType> *kdt,
+                                              dataType &price,
+                                              int &closestId,
+                                              const int kdt_index) {
+    /// Computes the bid of a non-diagonal bidder
+    std::vector<int> neighbours;
+    std::vector<dataType> costs;
+
+    std::vector<dataType> coordinates;
+    this->getKDTCoordinates(geometricalFactor, coordinates);
 
-    // std::cout<<"got to 1"<<std::endl;
     kdt->getKClosest(2, coordinates, neighbours, costs, kdt_index);
-    // std::cout<<"got to 2"<<std::endl;
-    dataType best_val, second_val;
-    KDTree<dataType> *closest_kdt;
-    Good<dataType> *best_good;
-    if(costs.size() == 2) {
-      // std::cout<<"got to 735"<<std::endl;
-      std::vector<int> idx(2);
-      idx[0] = 0;
-      idx[1] = 1;
-      sort(idx.begin(), idx.end(),
-           [&costs](int &a, int &b) { return costs[a] < costs[b]; });
-
-      closest_kdt = neighbours[idx[0]];
-      best_good = &(goods->get(closest_kdt->id_));
-      // Value is defined as the opposite of cost (each bidder aims at
-      // maximizing it)
-      best_val = -costs[idx[0]];
-      second_val = -costs[idx[1]];
-    } else {
-      // std::cout<<"got to 748"<<std::endl;
-      // If the kdtree contains only one point
-      closest_kdt = neighbours[0];
-      best_good = &(goods->get(closest_kdt->id_));
-      best_val = -costs[0];
-      second_val = best_val;
-    }
-    // std::cout<<"got to 755"<<std::endl;
+    return this->getKDTBid(goods, twinGood, wasserstein, epsilon,
+                           geometricalFactor, neighbours.data(), costs.data(),
+                           neighbours.size(), price, closestId);
+  }
+
+  template <typename dataType>
+  Good<dataType> *Bidder<dataType>::getKDTBid(GoodDiagram<dataType> *goods,
+                                              Good<dataType> &twinGood,
+                                              int wasserstein,
+                                              dataType epsilon,
+                                              double geometricalFactor,
+                                              const int *neighbours,
+                                              const dataType *costs,
+                                              const int neighbourNumber,
+                                              dataType &price,
+                                              int &closestId) {
+    // Value is defined as the opposite of cost (each bidder aims at
+    // maximizing it)
+    Good<dataType> *best_good = &(goods->get(neighbours[0]));
+    dataType best_val = -costs[0];
+    // If the kdtree contains only one point
+    dataType second_val
+      = (neighbourNumber > 1 && neighbours[1] >= 0) ? -costs[1] : best_val;
+
     // And now check for the corresponding twin bidder
     bool twin_chosen = false;
     Good<dataType> &g = twinGood;
@@ -842,7 +1034,6 @@ namespace ttk {
       second_val = val;
     }
 
-    // std::cout << "got here 2" << std::endl;
     if(second_val == std::numeric_limits<dataType>::lowest()) {
       // There is only one acceptable good for the bidder
       second_val = best_val;
@@ -853,6 +1044,27 @@ namespace ttk {
       new_price = old_price + epsilon;
       std::cout << "Huho 681" << std::endl;
     }
+    price = new_price;
+    closestId = twin_chosen ? -1 : neighbours[0];
+    return best_good;
+  }
+
+  template <typename dataType>
+  int Bidder<dataType>::runKDTBidding(GoodDiagram<dataType> *goods,
+                                      Good<dataType> &twinGood,
+                                      int wasserstein,
+                                      dataType epsilon,
+                                      double geometricalFactor,
+                                      KDTree<dataType> *kdt,
+                                      const int kdt_index) {
+    /// Runs bidding of a non-diagonal bidder
+    dataType new_price;
+    int closest_id;
+    Good<dataType> *best_good
+      = this->getKDTBid(goods, twinGood, wasserstein, epsilon,
+                        geometricalFactor, kdt, new_price, closest_id,
+                        kdt_index);
+
     // Assign bidder to best_good
     this->setProperty(best_good);
     this->setPricePaid(new_price);
@@ -863,8 +1075,8 @@ namespace ttk {
     // std::cout << "got here 3" << std::endl;
     best_good->assign(this->position_in_auction_, new_price);
     // Update the price in the KDTree
-    if(!twin_chosen) {
-      closest_kdt->updateWeight(new_price, kdt_index);
+    if(closest_id >= 0) {
+      kdt->updateWeight(closest_id, new_price, kdt_index);
     }
     return idx_reassigned;
   }
@@ -6,55 +6,76 @@
 #endif
 
 template <typename dataType>
-void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
-                                             const int kdt_index) {
+dataType ttk::Auction<dataType>::getBiddingEpsilon() {
   dataType max_price = getMaximalPrice();
   dataType epsilon = epsilon_;
   if(epsilon_ < 1e-6 * max_price) {
     // Risks of floating point limits reached...
     epsilon = 1e-6 * max_price;
   }
+  return epsilon;
+}
+
+template <typename dataType>
+int ttk::Auction<dataType>::runBidding(const int pos,
+                                       const dataType epsilon,
+                                       const int kdt_index) {
+  Bidder<dataType> &b = bidders_->get(pos);
+
+  GoodDiagram<dataType> *all_goods = b.isDiagonal() ? diagonal_goods_ : goods_;
+  Good<dataType> &twin_good
+    = b.id_ >= 0 ? diagonal_goods_->get(b.id_) : goods_->get(-b.id_ - 1);
+  // dataType eps = epsilon_*(1+0.05*n_biddings/bidders_->size());
+  int idx_reassigned;
+  if(b.isDiagonal()) {
+    if(use_kdt_) {
+      idx_reassigned = b.runDiagonalKDTBidding(
+        all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
+        kdt_, diagonal_queue_, kdt_index);
+    } else {
+      idx_reassigned
+        = b.runDiagonalBidding(all_goods, twin_good, wasserstein_, epsilon,
+                               geometricalFactor_, diagonal_queue_);
+    }
+  } else {
+    if(use_kdt_) {
+      // We can use the kd-tree to speed up the search
+      idx_reassigned
+        = b.runKDTBidding(all_goods, twin_good, wasserstein_, epsilon,
+                          geometricalFactor_, kdt_, kdt_index);
+    } else {
+      idx_reassigned
+        = b.runBidding(all_goods, goodArrays_, twin_good, wasserstein_,
+                       epsilon, geometricalFactor_, goodValues_);
+    }
+  }
+  updateGoodArrays(b);
+  return idx_reassigned;
+}
+
+template <typename dataType>
+void ttk::Auction<dataType>::updateGoodArrays(Bidder<dataType> &b) {
+  // report the new price of the good b was assigned to (diagonal goods are
+  // not in goodArrays_)
+  Good<dataType> *g = b.getProperty();
+  if(!use_kdt_ && g && g->id_ >= 0) {
+    goodArrays_.setPrice(g->id_, g->getPrice());
+  }
+}
+
+template <typename dataType>
+void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
+                                             const int kdt_index) {
+  const dataType epsilon = getBiddingEpsilon();
+  if(!use_kdt_) {
+    goodArrays_.build(goods_, wasserstein_, geometricalFactor_);
+  }
   while(unassignedBidders_.size() > 0) {
     n_biddings++;
     int pos = unassignedBidders_.front();
-    Bidder<dataType> &b = bidders_->get(pos);
     unassignedBidders_.pop_front();
 
-    GoodDiagram<dataType> *all_goods
-      = b.isDiagonal() ? diagonal_goods_ : goods_;
-    Good<dataType> &twin_good
-      = b.id_ >= 0 ? diagonal_goods_->get(b.id_) : goods_->get(-b.id_ - 1);
-    // dataType eps = epsilon_*(1+0.05*n_biddings/bidders_->size());
-    int idx_reassigned;
-    if(b.isDiagonal()) {
-      if(use_kdt_) {
-        idx_reassigned = b.runDiagonalKDTBidding(
-          all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
-          correspondance_kdt_map_, diagonal_queue_, kdt_index);
-      } else {
-        idx_reassigned
-          = b.runDiagonalBidding(all_goods, twin_good, wasserstein_, epsilon,
-                                 geometricalFactor_, diagonal_queue_);
-      }
-    } else {
-      if(use_kdt_) {
-        // We can use the kd-tree to speed up the search
-        idx_reassigned
-          = b.runKDTBidding(all_goods, twin_good, wasserstein_, epsilon,
-                            geometricalFactor_, kdt_, kdt_index);
-      } else {
-        idx_reassigned = b.runBidding(
-          all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_);
-      }
-    }
-    /*if(n_biddings>-1){
-      std::cout.precision(10);
-      std::cout<< n_biddings << ", out : " <<idx_reassigned<< ", " << b.id_ <<
-    "->" << b.getProperty()->id_ << ", distance : "<< b.cost(b.getProperty(),
-    wasserstein_, geometricalFactor_) << ", price : "
-    <<b.getProperty()->getPrice() << ", diagonal ? " << b.isDiagonal() << ", "<<
-    b.getProperty()->isDiagonal() << std::endl;
-    }*/
+    int idx_reassigned = runBidding(pos, epsilon, kdt_index);
     if(idx_reassigned >= 0) {
       Bidder<dataType> &reassigned = bidders_->get(idx_reassigned);
       reassigned.setProperty(NULL);
@@ -63,6 +84,128 @@ void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
   }
 }
 
+template <typename dataType>
+void ttk::Auction<dataType>::runJacobiAuctionRound(int &n_biddings,
+                                                   const int kdt_index) {
+  const dataType epsilon = getBiddingEpsilon();
+  if(!use_kdt_) {
+    goodArrays_.build(goods_, wasserstein_, geometricalFactor_);
+  }
+
+  std::vector<int> offDiagonalBidders;
+  std::vector<int> diagonalBidders;
+  // bid of each off-diagonal bidder: good, price and index in the KDTree
+  std::vector<Good<dataType> *> goods;
+  std::vector<dataType> prices;
+  std::vector<int> ids;
+  // batched KDTree queries: coordinates of the bidders, 2 closest goods
+  std::vector<dataType> queries;
+  std::vector<int> neighbours;
+  std::vector<dataType> costs;
+  std::unordered_map<Good<dataType> *, size_t> winners;
+
+  auto unassign = [this](const int pos) {
+    if(pos >= 0) {
+      bidders_->get(pos).setProperty(NULL);
+      unassignedBidders_.push_back(pos);
+    }
+  };
+
+  while(unassignedBidders_.size() > 0) {
+    // Few bidders left (typically a chain of evictions): a parallel step
+    // would cost more than it saves, bid one at a time.
+    if(unassignedBidders_.size() < 256) {
+      n_biddings++;
+      const int pos = unassignedBidders_.front();
+      unassignedBidders_.pop_front();
+      unassign(runBidding(pos, epsilon, kdt_index));
+      continue;
+    }
+
+    offDiagonalBidders.clear();
+    diagonalBidders.clear();
+    for(const int pos : unassignedBidders_) {
+      if(bidders_->get(pos).isDiagonal())
+        diagonalBidders.push_back(pos);
+      else
+        offDiagonalBidders.push_back(pos);
+    }
+    unassignedBidders_.clear();
+
+    // 1- Concurrent bids, against the prices of the previous step
+    const int nbBids = offDiagonalBidders.size();
+    n_biddings += nbBids;
+    goods.resize(nbBids);
+    prices.resize(nbBids);
+    ids.resize(nbBids);
+
+    if(use_kdt_) {
+      queries.clear();
+      for(const int pos : offDiagonalBidders) {
+        bidders_->get(pos).getKDTCoordinates(geometricalFactor_, queries);
+      }
+      kdt_->setThreadNumber(threadNumber_);
+      kdt_->getKClosest(2, queries, nbBids, neighbours, costs, kdt_index);
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<dataType> values;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif // TTK_ENABLE_OPENMP
+      for(int i = 0; i < nbBids; ++i) {
+        Bidder<dataType> &b = bidders_->get(offDiagonalBidders[i]);
+        Good<dataType> &twin_good = b.id_ >= 0 ? diagonal_goods_->get(b.id_)
+                                               : goods_->get(-b.id_ - 1);
+        if(use_kdt_) {
+          goods[i] = b.getKDTBid(goods_, twin_good, wasserstein_, epsilon,
+                                 geometricalFactor_, &neighbours[2 * i],
+                                 &costs[2 * i], 2, prices[i], ids[i]);
+        } else {
+          goods[i] = b.getBid(goods_, goodArrays_, twin_good, wasserstein_,
+                              epsilon, geometricalFactor_, prices[i], values);
+          ids[i] = -1;
+        }
+      }
+    }
+
+    // 2- Each good goes to its highest bidder (the first one in case of
+    // ties), the other bidders remain unassigned
+    winners.clear();
+    for(int i = 0; i < nbBids; ++i) {
+      auto it = winners.emplace(goods[i], i).first;
+      if(prices[i] > prices[it->second])
+        it->second = i;
+    }
+    for(int i = 0; i < nbBids; ++i) {
+      const int pos = offDiagonalBidders[i];
+      if(winners[goods[i]] != (size_t)i) {
+        unassign(pos);
+        continue;
+      }
+      Bidder<dataType> &b = bidders_->get(pos);
+      b.setProperty(goods[i]);
+      b.setPricePaid(prices[i]);
+      const int idx_reassigned = goods[i]->getOwner();
+      goods[i]->assign(b.getPositionInAuction(), prices[i]);
+      if(ids[i] >= 0) {
+        kdt_->updateWeight(ids[i], prices[i], kdt_index);
+      }
+      updateGoodArrays(b);
+      unassign(idx_reassigned);
+    }
+
+    // 3- Sequential bids of the diagonal bidders
+    n_biddings += diagonalBidders.size();
+    for(const int pos : diagonalBidders) {
+      unassign(runBidding(pos, epsilon, kdt_index));
+    }
+  }
+}
+
 template <typename dataType>
 dataType ttk::Auction<dataType>::getMaximalPrice() {
   dataType max_price = 0;
@@ -132,11 +275,23 @@ dataType ttk::Auction<dataType>::run(std::vector<matchingTuple> *matchings) {
   initializeEpsilon();
   int n_biddings = 0;
   dataType delta = 5;
+
+  // Large matchings bid in parallel, unless they are already run
+  // concurrently (PDBarycenter matches all of its inputs in parallel).
+  bool jacobi = false;
+#ifdef TTK_ENABLE_OPENMP
+  jacobi = threadNumber_ > 1 && omp_get_level() == 0
+           && bidders_->size() >= 1024;
+#endif // TTK_ENABLE_OPENMP
+
   while(delta > delta_lim_) {
     epsilon_ /= 5;
     this->buildUnassignedBidders();
     this->reinitializeGoods();
-    this->runAuctionRound(n_biddings);
+    if(jacobi)
+      this->runJacobiAuctionRound(n_biddings);
+    else
+      this->runAuctionRound(n_biddings);
     delta = this->getRelativePrecision();
   }
   dataType wassersteinDistance = this->getMatchingsAndDistance(matchings, true);
@@ -45,14 +45,27 @@ namespace ttk {
 
   public:
     BottleneckDistance()
-      : distance_(-1), wasserstein_("inf"), pvAlgorithm_(-1), zeroThreshold_(0),
-        px_(0), py_(0), pz_(0), pe_(0), ps_(0){};
+      : inputDiagrams_(nullptr), distanceMatrix_(nullptr),
+        condensedDistanceMatrix_(false), distance_(-1), wasserstein_("inf"),
+        pvAlgorithm_(-1), zeroThreshold_(0), px_(0), py_(0), pz_(0), pe_(0),
+        ps_(0){};
 
     ~BottleneckDistance(){};
 
     template <typename dataType>
     int execute(bool usePersistenceMetric);
 
+    /// Computes the distances between all the pairs of input diagrams (see
+    /// setInputDiagrams()), with the Wasserstein order, the persistence
+    /// threshold and the coefficients (setPX() to setPS()) of execute().
+    ///
+    /// The points of each diagram are sorted into classes, along with their
+    /// distances to the diagonal and their sorted births, once for all the
+    /// pairs involving the diagram. The pairs are then matched in parallel.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename dataType>
+    int computeDistanceMatrix();
+
     inline int setPersistencePercentThreshold(double t) {
       zeroThreshold_ = t;
       return 0;
@@ -94,6 +107,26 @@ namespace ttk {
       return 0;
     }
 
+    /// Input diagrams of computeDistanceMatrix(), as a
+    /// std::vector<std::vector<diagramTuple>>.
+    inline int setInputDiagrams(void *diagrams) {
+      inputDiagrams_ = diagrams;
+      return 0;
+    }
+
+    /// Output of computeDistanceMatrix(), as a std::vector<double>: the
+    /// n x n row-major matrix, or only its upper triangle, row by row, if
+    /// the matrix is condensed.
+    inline int setOutputDistanceMatrix(void *distanceMatrix) {
+      distanceMatrix_ = distanceMatrix;
+      return 0;
+    }
+
+    inline int setCondensedDistanceMatrix(const bool condensed) {
+      condensedDistanceMatrix_ = condensed;
+      return 0;
+    }
+
     inline int setAlgorithm(const std::string &algorithm) {
       algorithm_ = algorithm;
       return 0;
@@ -133,6 +166,9 @@ namespace ttk {
     void *outputCT1_;
     void *outputCT2_;
     void *matchings_; // ids from CT1 to CT2
+    void *inputDiagrams_;
+    void *distanceMatrix_;
+    bool condensedDistanceMatrix_;
     double distance_;
 
     std::string wasserstein_;
@@ -146,12 +182,61 @@ namespace ttk {
     double ps_;
 
   private:
+    // Points of one class (minima, maxima or saddles) of a diagram, with the
+    // data reused by all the matchings of the class.
+    struct ClassIndex {
+      std::vector<int> map; // ids of the points in the diagram
+      std::vector<double> diagonal; // distances to the diagonal
+      std::vector<int> order; // positions in map, by increasing birth
+      std::vector<double> births; // births, in that order
+    };
+
+    struct DiagramIndex {
+      ClassIndex min;
+      ClassIndex max;
+      ClassIndex sad;
+    };
+
     template <typename dataType>
     int computeBottleneck(const std::vector<diagramTuple> &d1,
                           const std::vector<diagramTuple> &d2,
                           std::vector<matchingTuple> &matchings,
                           bool usePersistenceMetric);
 
+    template <typename dataType>
+    int matchDiagrams(
+      const std::vector<diagramTuple> &d1,
+      const std::vector<diagramTuple> &d2,
+      const DiagramIndex &index1,
+      const DiagramIndex &index2,
+      dataType zeroThresh,
+      int wasserstein,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      std::vector<matchingTuple> &matchings);
+
+    template <typename dataType>
+    void getDistanceFunctions(
+      int wasserstein,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction)
+      const;
+
+    template <typename dataType>
+    void buildDiagramIndex(
+      const std::vector<diagramTuple> &CTDiagram,
+      dataType zeroThresh,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      DiagramIndex &index);
+
+    template <typename dataType>
+    void filterDiagramIndex(const std::vector<diagramTuple> &CTDiagram,
+                            const DiagramIndex &index,
+                            dataType zeroThresh,
+                            DiagramIndex &filtered) const;
+
     template <typename dataType>
     double computeGeometricalRange(const std::vector<diagramTuple> &CTDiagram1,
                                    const std::vector<diagramTuple> &CTDiagram2,
@@ -203,13 +288,28 @@ namespace ttk {
                            Munkres &solver);
 
     template <typename dataType>
-    void solveInfinityWasserstein(int nbRow,
-                                  int nbCol,
-                                  int nbRowToCut,
-                                  int nbColToCut,
-                                  std::vector<std::vector<dataType>> &matrix,
-                                  std::vector<matchingTuple> &matchings,
-                                  GabowTarjan &solver);
+    void buildMatchingGraph(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const ClassIndex &rows,
+      const ClassIndex &cols,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      bool isSaddle,
+      double maxDistance,
+      std::vector<Edge> &candidates) const;
+
+    template <typename dataType>
+    void solveInfinityWasserstein(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const ClassIndex &rows,
+      const ClassIndex &cols,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      bool isSaddle,
+      std::vector<matchingTuple> &matchings,
+      GabowTarjan &solver);
 
     template <typename dataType>
     dataType buildMappings(const std::vector<matchingTuple> &inputMatchings,
@@ -256,6 +256,72 @@ void BottleneckDistance::computeMinMaxSaddleNumberAndMapping(
   }
 }
 
+template <typename dataType>
+void BottleneckDistance::buildDiagramIndex(
+  const std::vector<diagramTuple> &CTDiagram,
+  const dataType zeroThresh,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  DiagramIndex &index) {
+  int nbMin = 0, nbMax = 0, nbSad = 0;
+  this->computeMinMaxSaddleNumberAndMapping(
+    CTDiagram, (int)CTDiagram.size(), nbMin, nbMax, nbSad, index.min.map,
+    index.max.map, index.sad.map, zeroThresh);
+
+  for(ClassIndex *c : {&index.min, &index.max, &index.sad}) {
+    const std::vector<int> &map = c->map;
+    const int nbPoints = (int)map.size();
+
+    c->diagonal.resize(nbPoints);
+    for(int k = 0; k < nbPoints; ++k)
+      c->diagonal[k] = diagonalDistanceFunction(CTDiagram[map[k]]);
+
+    c->order.resize(nbPoints);
+    for(int k = 0; k < nbPoints; ++k)
+      c->order[k] = k;
+    std::sort(c->order.begin(), c->order.end(), [&](const int a, const int b) {
+      return std::get<6>(CTDiagram[map[a]]) < std::get<6>(CTDiagram[map[b]]);
+    });
+
+    c->births.resize(nbPoints);
+    for(int k = 0; k < nbPoints; ++k)
+      c->births[k] = std::get<6>(CTDiagram[map[c->order[k]]]);
+  }
+}
+
+template <typename dataType>
+void BottleneckDistance::filterDiagramIndex(
+  const std::vector<diagramTuple> &CTDiagram,
+  const DiagramIndex &index,
+  const dataType zeroThresh,
+  DiagramIndex &filtered) const {
+  auto filterClass = [&](const ClassIndex &c, ClassIndex &f) {
+    const int nbPoints = (int)c.map.size();
+
+    // new positions of the kept points (-1: removed)
+    std::vector<int> positions(nbPoints, -1);
+    for(int k = 0; k < nbPoints; ++k) {
+      if(abs<dataType>(std::get<4>(CTDiagram[c.map[k]])) < zeroThresh)
+        continue;
+      positions[k] = (int)f.map.size();
+      f.map.push_back(c.map[k]);
+      f.diagonal.push_back(c.diagonal[k]);
+    }
+
+    // the kept points remain sorted by birth
+    for(int k = 0; k < nbPoints; ++k) {
+      if(positions[c.order[k]] == -1)
+        continue;
+      f.order.push_back(positions[c.order[k]]);
+      f.births.push_back(c.births[k]);
+    }
+  };
+
+  filtered = DiagramIndex();
+  filterClass(index.min, filtered.min);
+  filterClass(index.max, filtered.max);
+  filterClass(index.sad, filtered.sad);
+}
+
 template <typename dataType>
 void BottleneckDistance::buildCostMatrices(
   const std::vector<diagramTuple> &CTDiagram1,
@@ -443,27 +509,159 @@ void BottleneckDistance::solvePWasserstein(
   solver.clearMatrix<dataType>();
 }
 
+template <typename dataType>
+void BottleneckDistance::buildMatchingGraph(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const ClassIndex &rows,
+  const ClassIndex &cols,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  const bool isSaddle,
+  const double maxDistance,
+  std::vector<Edge> &candidates) const {
+  const int nbRow = (int)rows.map.size();
+  const int nbCol = (int)cols.map.size();
+  const std::vector<int> &map1 = rows.map;
+  const std::vector<int> &map2 = cols.map;
+  const std::vector<double> &rowDiagonal = rows.diagonal;
+  const std::vector<double> &colDiagonal = cols.diagonal;
+
+  candidates.clear();
+
+  // A pair farther apart than both of its points are from the diagonal can
+  // be swapped for the two diagonal projections without increasing the
+  // bottleneck: only the pairs closer than that (and than maxDistance) are
+  // candidates. A pair is added if its distance is in ]lower, upper].
+  const double noBound = std::numeric_limits<double>::lowest();
+  auto addCandidate
+    = [&](const int i, const int j, const double lower, const double upper) {
+        const double d
+          = distanceFunction(CTDiagram1[map1[i]], CTDiagram2[map2[j]]);
+        if(d <= upper && d > lower)
+          candidates.emplace_back(Edge(i, j, d));
+      };
+
+  // The distance between two points is at least the weighted difference of
+  // their births (and deaths), as long as the geometrical lifting is
+  // non-negative (it may not be for saddles).
+  const double pe = pe_, ps = ps_;
+  const bool canPrune
+    = pe > 0 && ps > 0 && px_ >= 0 && py_ >= 0 && pz_ >= 0
+      && (!isSaddle || (px_ == 0 && py_ == 0 && pz_ == 0));
+
+  if(!canPrune) {
+    for(int i = 0; i < nbRow; ++i)
+      for(int j = 0; j < nbCol; ++j)
+        addCandidate(
+          i, j, noBound,
+          std::min(std::max(rowDiagonal[i], colDiagonal[j]), maxDistance));
+    return;
+  }
+
+  // Spatial index: the points of each diagram sorted by birth, the
+  // candidates of a point are searched in a box around it.
+  const std::vector<int> &rowOrder = rows.order;
+  const std::vector<int> &colOrder = cols.order;
+  const std::vector<double> &rowBirths = rows.births;
+  const std::vector<double> &colBirths = cols.births;
+
+  // absorbs the rounding errors of the distance computations
+  const double slack = 1 + 1e-5;
+
+  // Pairs closer than the row point is from the diagonal.
+  for(int i = 0; i < nbRow; ++i) {
+    const diagramTuple &t1 = CTDiagram1[map1[i]];
+    const bool isMin1 = std::get<1>(t1) == BLocalMin;
+    const bool isMax1 = std::get<3>(t1) == BLocalMax;
+    const double upper = std::min(rowDiagonal[i], maxDistance);
+    const double rx = slack * upper / ((isMin1 && !isMax1) ? pe : ps);
+    const double ry = slack * upper / (isMax1 ? pe : ps);
+    const double x = std::get<6>(t1), y = std::get<10>(t1);
+
+    auto k = std::lower_bound(colBirths.begin(), colBirths.end(), x - rx)
+             - colBirths.begin();
+    for(; k < nbCol && colBirths[k] <= x + rx; ++k) {
+      const int j = colOrder[k];
+      if(abs_diff<double>(std::get<10>(CTDiagram2[map2[j]]), y) <= ry)
+        addCandidate(i, j, noBound, upper);
+    }
+  }
+
+  // Pairs closer than the column point is from the diagonal (and not
+  // already added).
+  const double c = std::min(pe, ps);
+  for(int j = 0; j < nbCol; ++j) {
+    const diagramTuple &t2 = CTDiagram2[map2[j]];
+    const double upper = std::min(colDiagonal[j], maxDistance);
+    const double r = slack * upper / c;
+    const double x = std::get<6>(t2), y = std::get<10>(t2);
+
+    auto k = std::lower_bound(rowBirths.begin(), rowBirths.end(), x - r)
+             - rowBirths.begin();
+    for(; k < nbRow && rowBirths[k] <= x + r; ++k) {
+      const int i = rowOrder[k];
+      if(abs_diff<double>(std::get<10>(CTDiagram1[map1[i]]), y) <= r)
+        addCandidate(
+          i, j, std::min(rowDiagonal[i], maxDistance), upper);
+    }
+  }
+}
+
 template <typename dataType>
 void BottleneckDistance::solveInfinityWasserstein(
-  const int nbRow,
-  const int nbCol,
-  const int nbRowToCut,
-  const int nbColToCut,
-  std::vector<std::vector<dataType>> &matrix,
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const ClassIndex &rows,
+  const ClassIndex &cols,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  const bool isSaddle,
   std::vector<matchingTuple> &matchings,
   GabowTarjan &solver) {
-  std::vector<std::vector<dataType>> bottleneckMatrix(
-    nbRow, std::vector<dataType>(nbCol));
+  const int nbRow = (int)rows.map.size();
+  const int nbCol = (int)cols.map.size();
+
+  // Matching all the points with the diagonal is an upper bound of the
+  // distance.
+  double maxDiagonal = 0;
+  for(const double d : rows.diagonal)
+    maxDiagonal = std::max(maxDiagonal, d);
+  for(const double d : cols.diagonal)
+    maxDiagonal = std::max(maxDiagonal, d);
+
+  // Exponential search of a tighter upper bound: the matching graph is
+  // restricted to the pairs closer than the bound, which is doubled until
+  // it admits a perfect matching. The solver then finds the exact distance
+  // among these pairs.
+  double maxDistance = maxDiagonal / (1 << 20);
+  std::vector<Edge> candidates;
+  while(true) {
+    if(maxDistance >= maxDiagonal)
+      maxDistance = std::numeric_limits<double>::max();
+
+    this->buildMatchingGraph(CTDiagram1, CTDiagram2, rows, cols,
+                             distanceFunction, isSaddle, maxDistance,
+                             candidates);
+    solver.setInput(nbRow, nbCol, candidates, rows.diagonal, cols.diagonal);
+
+    if(maxDistance == std::numeric_limits<double>::max()
+       || solver.hasPerfectMatching(maxDistance))
+      break;
+
+    maxDistance *= 2;
+  }
 
-  // Copy input matrix.
-  for(int i = 0; i < nbRow; ++i)
-    for(int j = 0; j < nbCol; ++j)
-      bottleneckMatrix[i][j] = matrix[i][j];
+  {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] Matching graph: " << candidates.size()
+        << " candidate pairs (" << nbRow << "x" << nbCol << " points)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), infoMsg);
+  }
 
-  // Solve.
-  solver.setInput<dataType>(nbRow, nbCol, (void *)&bottleneckMatrix);
-  solver.run<dataType>(matchings);
-  solver.clear<dataType>();
+  solver.run<double>(matchings);
+  solver.clear<double>();
 }
 
 template <typename dataType>
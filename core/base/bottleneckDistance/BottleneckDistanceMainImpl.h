@@ -16,88 +16,172 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
                                           const std::vector<diagramTuple> &d2,
                                           std::vector<matchingTuple> &matchings,
                                           const bool usePersistenceMetric) {
-  auto d1Size = (int)d1.size();
-  auto d2Size = (int)d2.size();
-
-  bool transposeOriginal = d1Size > d2Size;
-  const std::vector<diagramTuple> &CTDiagram1 = transposeOriginal ? d2 : d1;
-  const std::vector<diagramTuple> &CTDiagram2 = transposeOriginal ? d1 : d2;
-  if(transposeOriginal) {
-    int temp = d1Size;
-    d1Size = d2Size;
-    d2Size = temp;
-  }
-
-  if(transposeOriginal) {
-    std::stringstream msg;
-    msg << "[BottleneckDistance] The first persistence diagram is larger than "
-           "the second."
-        << std::endl;
-    msg << "[BottleneckDistance] Solving the transposed problem." << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
-  }
-
   // Check user parameters.
   const int wasserstein = (wasserstein_ == "inf") ? -1 : stoi(wasserstein_);
   if(wasserstein < 0 && wasserstein != -1)
     return -4;
 
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    distanceFunction;
+  std::function<dataType(const diagramTuple)> diagonalDistanceFunction;
+  this->getDistanceFunctions(
+    wasserstein, distanceFunction, diagonalDistanceFunction);
+
   // Needed to limit computation time.
   const dataType zeroThresh = this->computeMinimumRelevantPersistence<dataType>(
-    CTDiagram1, CTDiagram2, d1Size, d2Size);
+    d1, d2, (int)d1.size(), (int)d2.size());
 
-  // Initialize solvers.
-  std::vector<matchingTuple> minMatchings;
-  std::vector<matchingTuple> maxMatchings;
-  std::vector<matchingTuple> sadMatchings;
+  DiagramIndex index1, index2;
+  this->buildDiagramIndex(d1, zeroThresh, diagonalDistanceFunction, index1);
+  this->buildDiagramIndex(d2, zeroThresh, diagonalDistanceFunction, index2);
 
-  // Initialize cost matrices.
-  int nbRowMin = 0, nbColMin = 0;
-  int maxRowColMin = 0, minRowColMin = 0;
-  int nbRowMax = 0, nbColMax = 0;
-  int maxRowColMax = 0, minRowColMax = 0;
-  int nbRowSad = 0, nbColSad = 0;
-  int maxRowColSad = 0, minRowColSad = 0;
+  return this->matchDiagrams(d1, d2, index1, index2, zeroThresh, wasserstein,
+                             distanceFunction, diagonalDistanceFunction,
+                             matchings);
+}
 
-  // Remap for matchings.
-  std::vector<int> minMap1;
-  std::vector<int> minMap2;
-  std::vector<int> maxMap1;
-  std::vector<int> maxMap2;
-  std::vector<int> sadMap1;
-  std::vector<int> sadMap2;
-
-  this->computeMinMaxSaddleNumberAndMapping(CTDiagram1, d1Size, nbRowMin,
-                                            nbRowMax, nbRowSad, minMap1,
-                                            maxMap1, sadMap1, zeroThresh);
-  this->computeMinMaxSaddleNumberAndMapping(CTDiagram2, d2Size, nbColMin,
-                                            nbColMax, nbColSad, minMap2,
-                                            maxMap2, sadMap2, zeroThresh);
+template <typename dataType>
+int BottleneckDistance::computeDistanceMatrix() {
+  Timer t;
 
-  // Automatically transpose if nb rows > nb cols
-  maxRowColMin = std::max(nbRowMin + 1, nbColMin + 1);
-  maxRowColMax = std::max(nbRowMax + 1, nbColMax + 1);
-  maxRowColSad = std::max(nbRowSad + 1, nbColSad + 1);
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!inputDiagrams_)
+    return -1;
+  if(!distanceMatrix_)
+    return -2;
+#endif
+
+  const std::vector<std::vector<diagramTuple>> &diagrams
+    = *static_cast<const std::vector<std::vector<diagramTuple>> *>(
+      inputDiagrams_);
+  std::vector<double> &distances
+    = *static_cast<std::vector<double> *>(distanceMatrix_);
+  const int nbDiagrams = (int)diagrams.size();
+
+  const int wasserstein = (wasserstein_ == "inf") ? -1 : stoi(wasserstein_);
+  if(wasserstein < 0 && wasserstein != -1)
+    return -4;
+
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    distanceFunction;
+  std::function<dataType(const diagramTuple)> diagonalDistanceFunction;
+  this->getDistanceFunctions(
+    wasserstein, distanceFunction, diagonalDistanceFunction);
+
+  // Per-diagram preprocessing, shared by all the pairs of diagrams: the
+  // points are indexed without persistence threshold, the threshold of
+  // each pair is applied by filtering these indices.
+  std::vector<DiagramIndex> indices(nbDiagrams);
+  std::vector<double> minPersistence(nbDiagrams);
+  std::vector<double> maxPersistence(nbDiagrams);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(int i = 0; i < nbDiagrams; ++i) {
+    this->buildDiagramIndex(
+      diagrams[i], (dataType)0, diagonalDistanceFunction, indices[i]);
+    minPersistence[i] = std::numeric_limits<double>::max();
+    maxPersistence[i] = std::numeric_limits<double>::lowest();
+    for(const diagramTuple &pair : diagrams[i]) {
+      const double persistence = abs<dataType>(std::get<4>(pair));
+      minPersistence[i] = std::min(minPersistence[i], persistence);
+      maxPersistence[i] = std::max(maxPersistence[i], persistence);
+    }
+  }
+
+  const double sp = zeroThreshold_;
+  const double s = sp > 0.0 && sp < 100.0 ? sp / 100.0 : 0;
+
+  std::vector<std::pair<int, int>> pairs;
+  pairs.reserve((size_t)nbDiagrams * (nbDiagrams - 1) / 2);
+  for(int i = 0; i < nbDiagrams; ++i)
+    for(int j = i + 1; j < nbDiagrams; ++j)
+      pairs.emplace_back(i, j);
+
+  if(condensedDistanceMatrix_)
+    distances.assign(pairs.size(), 0);
+  else
+    distances.assign((size_t)nbDiagrams * nbDiagrams, 0);
+
+  int status = 0;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t p = 0; p < pairs.size(); ++p) {
+    const int i = pairs[p].first;
+    const int j = pairs[p].second;
+
+    // same threshold as computeMinimumRelevantPersistence()
+    dataType zeroThresh = 0;
+    if(s > 0 && (!diagrams[i].empty() || !diagrams[j].empty())) {
+      zeroThresh = s
+                   * (std::max(maxPersistence[i], maxPersistence[j])
+                      - std::min(minPersistence[i], minPersistence[j]));
+    }
+
+    const DiagramIndex *index1 = &indices[i];
+    const DiagramIndex *index2 = &indices[j];
+    DiagramIndex filtered1, filtered2;
+    if(zeroThresh > 0) {
+      this->filterDiagramIndex(diagrams[i], indices[i], zeroThresh, filtered1);
+      this->filterDiagramIndex(diagrams[j], indices[j], zeroThresh, filtered2);
+      index1 = &filtered1;
+      index2 = &filtered2;
+    }
+
+    // one (quiet) solver per pair, the pairs being matched concurrently
+    BottleneckDistance pairSolver(*this);
+    pairSolver.setDebugLevel(fatalMsg);
+
+    std::vector<matchingTuple> matchings;
+    const int ret = pairSolver.matchDiagrams(
+      diagrams[i], diagrams[j], *index1, *index2, zeroThresh, wasserstein,
+      distanceFunction, diagonalDistanceFunction, matchings);
+    if(ret < 0) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif // TTK_ENABLE_OPENMP
+      status = ret;
+      continue;
+    }
+
+    const double distance = pairSolver.getDistance();
+    if(condensedDistanceMatrix_) {
+      distances[p] = distance;
+    } else {
+      distances[(size_t)i * nbDiagrams + j] = distance;
+      distances[(size_t)j * nbDiagrams + i] = distance;
+    }
+  }
 
-  minRowColMin = std::min(nbRowMin + 1, nbColMin + 1);
-  minRowColMax = std::min(nbRowMax + 1, nbColMax + 1);
-  minRowColSad = std::min(nbRowSad + 1, nbColSad + 1);
+  {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] Distance matrix of " << nbDiagrams
+        << " diagrams (" << pairs.size() << " pairs) computed in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
 
-  std::vector<std::vector<dataType>> minMatrix(
-    (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
-  std::vector<std::vector<dataType>> maxMatrix(
-    (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
-  std::vector<std::vector<dataType>> sadMatrix(
-    (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
+  return status;
+}
 
+template <typename dataType>
+void BottleneckDistance::getDistanceFunctions(
+  const int wasserstein,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction)
+  const {
   double px = px_;
   double py = py_;
   double pz = pz_;
   double pe = pe_;
   double ps = ps_;
 
-  std::function<dataType(const diagramTuple, const diagramTuple)>
-    distanceFunction
+  distanceFunction
     = [wasserstein, px, py, pz, pe, ps](
         const diagramTuple a, const diagramTuple b) -> dataType {
     BNodeType ta1 = std::get<1>(a);
@@ -146,7 +230,7 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     return val;
   };
 
-  std::function<dataType(const diagramTuple)> diagonalDistanceFunction
+  diagonalDistanceFunction
     = [wasserstein, px, py, pz, ps, pe](const diagramTuple a) -> dataType {
     BNodeType ta1 = std::get<1>(a);
     BNodeType ta2 = std::get<3>(a);
@@ -170,20 +254,91 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     double val = infDistance + geoDistance;
     return pow(val, 1 / w);
   };
+}
 
-  const bool transposeMin = nbRowMin > nbColMin;
-  const bool transposeMax = nbRowMax > nbColMax;
-  const bool transposeSad = nbRowSad > nbColSad;
+template <typename dataType>
+int BottleneckDistance::matchDiagrams(
+  const std::vector<diagramTuple> &d1,
+  const std::vector<diagramTuple> &d2,
+  const DiagramIndex &index1,
+  const DiagramIndex &index2,
+  const dataType zeroThresh,
+  const int wasserstein,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  std::vector<matchingTuple> &matchings) {
+  auto d1Size = (int)d1.size();
+  auto d2Size = (int)d2.size();
 
-  Timer t;
+  bool transposeOriginal = d1Size > d2Size;
+  const std::vector<diagramTuple> &CTDiagram1 = transposeOriginal ? d2 : d1;
+  const std::vector<diagramTuple> &CTDiagram2 = transposeOriginal ? d1 : d2;
+  const DiagramIndex &CTIndex1 = transposeOriginal ? index2 : index1;
+  const DiagramIndex &CTIndex2 = transposeOriginal ? index1 : index2;
+  if(transposeOriginal) {
+    int temp = d1Size;
+    d1Size = d2Size;
+    d2Size = temp;
+  }
 
-  this->buildCostMatrices(
-    CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
-    diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
-    transposeMin, transposeMax, transposeSad, wasserstein);
+  if(transposeOriginal) {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] The first persistence diagram is larger than "
+           "the second."
+        << std::endl;
+    msg << "[BottleneckDistance] Solving the transposed problem." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  // Initialize solvers.
+  std::vector<matchingTuple> minMatchings;
+  std::vector<matchingTuple> maxMatchings;
+  std::vector<matchingTuple> sadMatchings;
+
+  // Remap for matchings.
+  const std::vector<int> &minMap1 = CTIndex1.min.map;
+  const std::vector<int> &minMap2 = CTIndex2.min.map;
+  const std::vector<int> &maxMap1 = CTIndex1.max.map;
+  const std::vector<int> &maxMap2 = CTIndex2.max.map;
+  const std::vector<int> &sadMap1 = CTIndex1.sad.map;
+  const std::vector<int> &sadMap2 = CTIndex2.sad.map;
+
+  // Initialize cost matrices.
+  const int nbRowMin = (int)minMap1.size(), nbColMin = (int)minMap2.size();
+  const int nbRowMax = (int)maxMap1.size(), nbColMax = (int)maxMap2.size();
+  const int nbRowSad = (int)sadMap1.size(), nbColSad = (int)sadMap2.size();
+
+  // Automatically transpose if nb rows > nb cols
+  const int maxRowColMin = std::max(nbRowMin + 1, nbColMin + 1);
+  const int maxRowColMax = std::max(nbRowMax + 1, nbColMax + 1);
+  const int maxRowColSad = std::max(nbRowSad + 1, nbColSad + 1);
+
+  const int minRowColMin = std::min(nbRowMin + 1, nbColMin + 1);
+  const int minRowColMax = std::min(nbRowMax + 1, nbColMax + 1);
+  const int minRowColSad = std::min(nbRowSad + 1, nbColSad + 1);
+
+  // Only the dense cost matrices of the Munkres solver are transposed.
+  const bool transposeMin = wasserstein > 0 && nbRowMin > nbColMin;
+  const bool transposeMax = wasserstein > 0 && nbRowMax > nbColMax;
+  const bool transposeSad = wasserstein > 0 && nbRowSad > nbColSad;
+
+  Timer t;
 
   if(wasserstein > 0) {
 
+    std::vector<std::vector<dataType>> minMatrix(
+      (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
+    std::vector<std::vector<dataType>> maxMatrix(
+      (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
+    std::vector<std::vector<dataType>> sadMatrix(
+      (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
+
+    this->buildCostMatrices(
+      CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
+      diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
+      transposeMin, transposeMax, transposeSad, wasserstein);
+
     if(nbRowMin > 0 && nbColMin > 0) {
       Munkres solverMin;
       dMsg(std::cout, "[BottleneckDistance] Affecting minima...\n", timeMsg);
@@ -211,27 +366,27 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     if(nbRowMin > 0 && nbColMin > 0) {
       GabowTarjan solverMin;
       dMsg(std::cout, "[BottleneckDistance] Affecting minima...\n", timeMsg);
-      this->solveInfinityWasserstein(minRowColMin, maxRowColMin, nbRowMin,
-                                     nbColMin, minMatrix, minMatchings,
-                                     solverMin);
+      this->solveInfinityWasserstein(CTDiagram1, CTDiagram2, CTIndex1.min,
+                                     CTIndex2.min, distanceFunction,
+                                     false, minMatchings, solverMin);
     }
 
     // Launch solving for maxima.
     if(nbRowMax > 0 && nbColMax > 0) {
       GabowTarjan solverMax;
       dMsg(std::cout, "[BottleneckDistance] Affecting maxima...\n", timeMsg);
-      this->solveInfinityWasserstein(minRowColMax, maxRowColMax, nbRowMax,
-                                     nbColMax, maxMatrix, maxMatchings,
-                                     solverMax);
+      this->solveInfinityWasserstein(CTDiagram1, CTDiagram2, CTIndex1.max,
+                                     CTIndex2.max, distanceFunction,
+                                     false, maxMatchings, solverMax);
     }
 
     // Launch solving for saddles.
     if(nbRowSad > 0 && nbColSad > 0) {
       GabowTarjan solverSad;
       dMsg(std::cout, "[BottleneckDistance] Affecting saddles...\n", timeMsg);
-      this->solveInfinityWasserstein(minRowColSad, maxRowColSad, nbRowSad,
-                                     nbColSad, sadMatrix, sadMatchings,
-                                     solverSad);
+      this->solveInfinityWasserstein(CTDiagram1, CTDiagram2, CTIndex1.sad,
+                                     CTIndex2.sad, distanceFunction,
+                                     true, sadMatchings, solverSad);
     }
   }
 
@@ -295,7 +450,7 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     if(wasserstein > 0)
       d += partialDistance;
     else
-      d = partialDistance;
+      d = std::max(d, partialDistance);
   }
 
   if(numberOfMismatches > 0) {
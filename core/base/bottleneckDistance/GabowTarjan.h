@@ -5,6 +5,7 @@
 #include <Debug.h>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <queue>
 #include <vector>
@@ -29,47 +30,88 @@ namespace ttk {
     template <typename dataType>
     int run(std::vector<matchingTuple> &matchings);
 
+    // Return true if the edges of weight at most maxWeight admit a perfect
+    // matching.
+    bool hasPerfectMatching(double maxWeight);
+
+    /*
+     * Dense input: \p C_ is a (rowSize_ x colSize_) cost matrix whose last
+     * column (resp. row) holds the distances of the rows (resp. columns) to
+     * the diagonal.
+     */
     template <typename dataType>
     inline void setInput(int rowSize_, int colSize_, void *C_) {
-      Cptr = C_;
+      auto C = (std::vector<std::vector<dataType>> *)C_;
+      const int nbRow = rowSize_ - 1;
+      const int nbCol = colSize_ - 1;
+
+      std::vector<Edge> candidates;
+      candidates.reserve((size_t)std::max(nbRow, 0) * std::max(nbCol, 0));
+      for(int i = 0; i < nbRow; ++i)
+        for(int j = 0; j < nbCol; ++j)
+          candidates.emplace_back(Edge(i, j, (double)(*C)[i][j]));
+
+      std::vector<double> rowDiagonal(std::max(nbRow, 0));
+      for(int i = 0; i < nbRow; ++i)
+        rowDiagonal[i] = (double)(*C)[i][nbCol];
 
-      auto C = (std::vector<std::vector<dataType>> *)Cptr;
-      Size1 = (unsigned int)rowSize_ - 1;
-      Size2 = (unsigned int)colSize_ - 1;
-      if(Size1 <= 0 || Size2 <= 0) {
+      std::vector<double> colDiagonal(std::max(nbCol, 0));
+      for(int j = 0; j < nbCol; ++j)
+        colDiagonal[j] = (double)(*C)[nbRow][j];
+
+      setInput(nbRow, nbCol, candidates, rowDiagonal, colDiagonal);
+    }
+
+    /*
+     * Sparse input: \p candidates are the (row, column, weight) edges
+     * between the points of the two diagrams which may be part of an
+     * optimal matching, \p rowDiagonal and \p colDiagonal the distances
+     * of the points to the diagonal.
+     */
+    inline void setInput(const int nbRow,
+                         const int nbCol,
+                         const std::vector<Edge> &candidates,
+                         const std::vector<double> &rowDiagonal,
+                         const std::vector<double> &colDiagonal) {
+      if(nbRow <= 0 || nbCol <= 0) {
         ttk::Debug d;
         std::stringstream msg;
         msg << "[Gabow-Tarjan] One or more empty diagram(s)." << std::endl;
         d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
       }
 
+      Size1 = (unsigned int)std::max(nbRow, 0);
+      Size2 = (unsigned int)std::max(nbCol, 0);
       MaxSize = Size1 + Size2;
-      Edges.clear();
 
-      // Connect diagonal points.
-      for(unsigned int i = Size1; i < MaxSize; ++i)
-        for(unsigned int j = MaxSize + Size2; j < 2 * MaxSize; ++j)
-          Edges.emplace_back(Edge(i, j, (double)0));
-
-      // Connect real points.
-      for(unsigned int i = 0; i < Size1; ++i) {
-        unsigned int k = MaxSize;
-        for(unsigned int j = 0; j < Size2; ++j) {
-          auto val = (double)(*C)[i][j];
-          Edges.emplace_back(Edge(i, k++, val));
-        }
+      RowDiagonal = rowDiagonal;
+      ColDiagonal = colDiagonal;
+
+      // Weights of the candidates, sorted by row and column for lookups.
+      Candidates = candidates;
+      std::sort(Candidates.begin(), Candidates.end(),
+                [](const Edge &a, const Edge &b) {
+                  return a.v1 < b.v1 || (a.v1 == b.v1 && a.v2 < b.v2);
+                });
+
+      Edges.clear();
+      Edges.reserve(2 * Candidates.size() + MaxSize);
+
+      for(const auto &e : Candidates) {
+        // Connect real points.
+        Edges.emplace_back(Edge(e.v1, MaxSize + e.v2, e.weight));
+        // Connect the diagonal points of a candidate pair: when the two
+        // points are matched together, their projections onto the diagonal
+        // are matched together as well.
+        Edges.emplace_back(Edge(Size1 + e.v2, MaxSize + Size2 + e.v1, 0.0));
       }
 
       // Connect real points with their diagonal.
-      for(unsigned int i = 0; i < Size1; ++i) {
-        auto val = (double)(*C)[i][Size2];
-        Edges.emplace_back(Edge(i, MaxSize + Size2 + i, val));
-      }
+      for(unsigned int i = 0; i < Size1; ++i)
+        Edges.emplace_back(Edge(i, MaxSize + Size2 + i, RowDiagonal[i]));
 
-      for(unsigned int j = 0, k = MaxSize; j < Size2; ++j, ++k) {
-        auto val = (double)(*C)[Size1][j];
-        Edges.emplace_back(Edge(Size1 + (k - MaxSize), k, val));
-      }
+      for(unsigned int j = 0; j < Size2; ++j)
+        Edges.emplace_back(Edge(Size1 + j, MaxSize + j, ColDiagonal[j]));
 
       std::sort(Edges.begin(), Edges.end());
     }
@@ -80,14 +122,21 @@ namespace ttk {
       Size1 = 0;
       Size2 = 0;
       Edges.clear();
+      Candidates.clear();
+      RowDiagonal.clear();
+      ColDiagonal.clear();
       Pair.clear();
       Connections.clear();
       Layers.clear();
     }
 
   private:
-    // Original cost matrix.
-    void *Cptr;
+    // Candidate edges between real points, sorted by row and column.
+    std::vector<Edge> Candidates;
+
+    // Distances of the points of both diagrams to the diagonal.
+    std::vector<double> RowDiagonal;
+    std::vector<double> ColDiagonal;
 
     /*
      * Total number of persistencePairs
@@ -126,6 +175,9 @@ namespace ttk {
      */
     std::vector<int> Layers;
 
+    // Weight of the candidate edge between row i and column j.
+    double getWeight(int i, int j) const;
+
     template <typename dataType>
     bool DFS(int v);
 
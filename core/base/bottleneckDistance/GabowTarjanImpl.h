@@ -5,6 +5,17 @@
 #include <iostream>
 #include <vector>
 
+inline double GabowTarjan::getWeight(const int i, const int j) const {
+  const auto it = std::lower_bound(
+    Candidates.begin(), Candidates.end(), Edge(i, j, 0.0),
+    [](const Edge &a, const Edge &b) {
+      return a.v1 < b.v1 || (a.v1 == b.v1 && a.v2 < b.v2);
+    });
+  if(it == Candidates.end() || it->v1 != i || it->v2 != j)
+    return std::numeric_limits<double>::max();
+  return it->weight;
+}
+
 template <typename dataType>
 bool GabowTarjan::DFS(int v) {
   if(v < 0)
@@ -81,6 +92,23 @@ void GabowTarjan::HopcroftKarp(unsigned int &matching) {
     }
 }
 
+inline bool GabowTarjan::hasPerfectMatching(const double maxWeight) {
+  Pair.assign(2 * MaxSize, -1);
+  Layers.assign(MaxSize + 1, 0);
+
+  Connections.clear();
+  Connections.resize(MaxSize);
+  for(const auto &e : Edges) {
+    if(e.weight > maxWeight)
+      break;
+    Connections[e.v1].push_back(e.v2);
+  }
+
+  unsigned int matching = 0;
+  HopcroftKarp<double>(matching);
+  return matching >= MaxSize;
+}
+
 template <typename dataType>
 dataType GabowTarjan::Distance(dataType maxLevel) {
   // Clear the pairing
@@ -91,132 +119,85 @@ dataType GabowTarjan::Distance(dataType maxLevel) {
   Layers.clear();
   Layers.resize(MaxSize + 1);
 
-  // No vertices are matched
-  unsigned int matching = 0;
-  unsigned int matching0 = 0;
-
-  // Clear the connection matrix and set it to the right size
-  Connections.clear();
-  Connections.resize(MaxSize);
-
-  // The maximal weight of the edges which are used for the matching
-  double currentWeight = 0;
-
-  // First non added edge is an iterator pointing to the first edge
-  // in Edges which was added to the Connections
-  unsigned int firstNotAddedEdge = 0;
-  unsigned int nbEdges = (unsigned int)Edges.size();
-
-  unsigned int lowerBound = 0;
-  unsigned int upperBound = nbEdges;
-  unsigned int guessEdge = (lowerBound + nbEdges) / 2;
-
-  std::map<int, int> offPairings;
-
-  // Repeat till all the vertices are matched
-  while(matching < MaxSize) {
-    // Save initial matching.
-    matching0 = matching;
-    unsigned int oldGuessEdge = guessEdge;
-
-    currentWeight = Edges[guessEdge].weight;
-    while(Edges[guessEdge].weight == currentWeight && guessEdge < nbEdges)
+  const unsigned int nbEdges = (unsigned int)Edges.size();
+  if(!nbEdges)
+    return 0;
+
+  // Matchings of the largest guess without a perfect matching (still valid
+  // for any larger guess, hence a warm start for the next guesses) and of
+  // the smallest guess with a perfect matching.
+  std::vector<int> lowerPair(2 * MaxSize, -1);
+  unsigned int lowerMatching = 0;
+  std::vector<int> upperPair;
+
+  // Is there a perfect matching made of the edges up to guessEdge (and of
+  // the edges of the same weight)?
+  auto isPerfect = [&](unsigned int guessEdge) {
+    const double currentWeight = Edges[guessEdge].weight;
+    while(guessEdge + 1 < nbEdges
+          && Edges[guessEdge + 1].weight == currentWeight)
       ++guessEdge;
 
-    if(guessEdge >= nbEdges) {
-      std::stringstream msg;
-      ttk::Debug d;
-      msg << "[Gabow-Tarjan] ran out of edges." << std::endl;
-      d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-    }
-
-    // Add the edges with the current weight (distance) to the connection matrix
-    while(firstNotAddedEdge >= guessEdge) {
-      int v1 = Edges[firstNotAddedEdge].v1;
-      int v2 = Edges[firstNotAddedEdge].v2;
-
-      std::vector<int> vec1 = Connections[v1];
-      vec1.erase(std::remove(vec1.begin(), vec1.end(), v2), vec1.end());
-      Connections[v1] = vec1;
-
-      --firstNotAddedEdge;
-    }
-
-    // Edges[firstNotAddedEdge].weight == currentWeight && firstNotAddedEdge <
-    // nbEdges
-    while(firstNotAddedEdge < guessEdge) {
-      int v1 = Edges[firstNotAddedEdge].v1;
-      int v2 = Edges[firstNotAddedEdge].v2;
-
-      Connections[v1].push_back(v2);
-      ++firstNotAddedEdge;
-    }
-
-    // Clear the pairing
-    Pair.clear();
-    Pair.assign(2 * MaxSize, -1);
-    // Clearing Layers
-    Layers.clear();
-    Layers.resize(MaxSize + 1);
-
-    // Temporarily augment matching.
     {
       std::stringstream msg;
       ttk::Debug d;
-      msg << "[Gabow-Tarjan] Guessing for " << guessEdge << "..." << std::endl;
+      msg << "[Gabow-Tarjan] Guessing for " << guessEdge << "..."
+          << std::endl;
       d.dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
     }
 
-    matching = 0;
+    // Clear the connection matrix and add the edges of the guess
+    Connections.clear();
+    Connections.resize(MaxSize);
+    for(unsigned int e = 0; e <= guessEdge; ++e)
+      Connections[Edges[e].v1].push_back(Edges[e].v2);
+
+    // Start from the matching of the lower bound
+    Pair = lowerPair;
+    unsigned int matching = lowerMatching;
     HopcroftKarp<dataType>(matching);
-    // printCurrentMatching<dataType>();
 
     if(matching >= MaxSize) {
+      upperPair = Pair;
+      return true;
+    }
 
-      // Reset matching.
-      matching = matching0;
-      upperBound = guessEdge;
-      guessEdge = (lowerBound + guessEdge) / 2;
-
-      // Ended binary search.
-      if(oldGuessEdge == guessEdge) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Binary search success." << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        return Edges[(guessEdge > 0 ? guessEdge - 1 : guessEdge)].weight;
-      }
+    lowerPair = Pair;
+    lowerMatching = matching;
+    return false;
+  };
 
-    } else {
+  // Binary search of the smallest edge weight admitting a perfect matching
+  unsigned int lowerBound = 0;
+  unsigned int upperBound = nbEdges - 1;
+  if(!isPerfect(upperBound)) {
+    std::stringstream msg;
+    ttk::Debug d;
+    msg << "[Gabow-Tarjan] Not enough edges to find the matching!"
+        << std::endl;
+    d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
+    return Edges[upperBound].weight;
+  }
 
-      // Check if we did not run out of edges. This should never happen.
-      if(firstNotAddedEdge == nbEdges) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Not enough edges to find the matching!"
-            << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        // return -1;
-        return currentWeight;
-      }
+  while(lowerBound < upperBound) {
+    const unsigned int guessEdge = (lowerBound + upperBound) / 2;
+    if(isPerfect(guessEdge))
+      upperBound = guessEdge;
+    else
+      lowerBound = guessEdge + 1;
+  }
 
-      lowerBound = guessEdge;
-      guessEdge = (guessEdge + upperBound) / 2;
-      // Increase the value of the current weight
-      // currentWeight = Edges[firstNotAddedEdge].weight;
-
-      // Ended binary search.
-      if(oldGuessEdge == guessEdge) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Binary search success." << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        return Edges[(guessEdge > 0 ? guessEdge - 1 : guessEdge)].weight;
-      }
-    }
+  // Report the last perfect matching.
+  Pair = upperPair;
+
+  {
+    std::stringstream msg;
+    ttk::Debug d;
+    msg << "[Gabow-Tarjan] Binary search success." << std::endl;
+    d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
   }
 
-  return -1;
+  return Edges[upperBound].weight;
 }
 
 template <typename dataType>
@@ -266,7 +247,6 @@ int GabowTarjan::run(std::vector<matchingTuple> &matchings) {
 
   // Fill matchings.
   matchings.clear();
-  auto C = (std::vector<std::vector<dataType>> *)Cptr;
 
   for(unsigned int i = 0; i < Size1; ++i) {
     if(Pair[i] == -1)
@@ -283,10 +263,10 @@ int GabowTarjan::run(std::vector<matchingTuple> &matchings) {
     }
 
     if(j >= (int)Size2) {
-      matchingTuple t = std::make_tuple(i, j, (*C)[i][Size2]);
+      matchingTuple t = std::make_tuple(i, j, RowDiagonal[i]);
       matchings.push_back(t);
     } else {
-      matchingTuple t = std::make_tuple(i, j, (*C)[i][j]);
+      matchingTuple t = std::make_tuple(i, j, getWeight(i, j));
       matchings.push_back(t);
     }
   }
@@ -305,14 +285,13 @@ int GabowTarjan::run(std::vector<matchingTuple> &matchings) {
       // return -1;
     }
 
-    if(i <= -1) {
-      matchingTuple t = std::make_tuple(i, j - Size1, (*C)[Size1][j - Size1]);
-      matchings.push_back(t);
-    } else {
-      // Already added by symmetry.
-      matchingTuple t = std::make_tuple(i, j - Size1, (*C)[i][j - Size1]);
-      matchings.push_back(t);
-    }
+    // Two diagonal points matched together: nothing to report, the real
+    // points were reported above.
+    if(i > -1)
+      continue;
+
+    matchingTuple t = std::make_tuple(i, j - Size1, ColDiagonal[j - Size1]);
+    matchings.push_back(t);
   }
 
   return 0;
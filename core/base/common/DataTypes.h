@@ -19,6 +19,10 @@ namespace ttk {
   using SimplexId = int;
 #endif
 
+  /// \brief Narrow identifier type, used to store the relations of meshes
+  /// whose simplex counts fit in it (see FlatJaggedArray::compact()).
+  using CompactSimplexId = int;
+
   /// \brief Identifier type for threads (i.e. with OpenMP).
   using ThreadId = int;
 
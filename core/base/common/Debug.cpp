@@ -86,6 +86,24 @@ int Debug::msg(const char *msg, const int &debugLevel) const {
   return dMsg(cout, string(msg), debugLevel);
 }
 
+int Debug::getMemoryReport(MemoryReport &report) const {
+  // no internal buffer by default
+  (void)report;
+  return 0;
+}
+
+int Debug::printMemoryReport() const {
+
+  MemoryReport report;
+  int ret = getMemoryReport(report);
+
+  stringstream msg;
+  report.print(msg, "[MemoryReport] ");
+  dMsg(cout, msg.str(), memoryMsg);
+
+  return ret;
+}
+
 int Debug::setDebugLevel(const int &debugLevel) {
   debugLevel_ = debugLevel;
   return 0;
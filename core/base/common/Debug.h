@@ -24,6 +24,7 @@
 #define _DEBUG_H
 
 #include <BaseClass.h>
+#include <MemoryReport.h>
 #include <cerrno>
 #include <fstream>
 #include <iostream>
@@ -81,6 +82,19 @@ namespace ttk {
     /// \sa dMsg(), msg()
     int msg(const char *msg, const int &debugLevel = infoMsg) const;
 
+    /// Fill \p report with the memory footprint of the internal buffers of
+    /// the object (one entry per buffer). Classes owning large buffers
+    /// override this function.
+    /// \param report Report to complete.
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa printMemoryReport()
+    virtual int getMemoryReport(MemoryReport &report) const;
+
+    /// Print the memory report of the object as a table (memory messages).
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa getMemoryReport()
+    int printMemoryReport() const;
+
     /// Set the debug level of a particular object. The global variable
     /// globalDebugLevel_ will over-ride this setting if it has a lower value.
     /// \return Returns 0 upon success, negative values otherwise.
@@ -0,0 +1,428 @@
+/// \ingroup base
+/// \class ttk::FlatJaggedArray
+/// \date October 2019.
+///
+/// \brief Compressed (CSR) storage for jagged tables of simplex identifiers.
+///
+/// %FlatJaggedArray replaces std::vector<std::vector<SimplexId>> tables with
+/// two contiguous buffers: an offset buffer (of size the number of rows plus
+/// one) and a data buffer holding all the rows back to back. Row i spans
+/// data[offsets[i]] to data[offsets[i + 1]] (excluded).
+///
+/// Tables are built in two passes: first the number of items per row is
+/// stored with setRowSize(), then prefixSum() turns these counts into offsets
+/// and allocates the data buffer, which can then be filled row by row (in
+/// parallel if needed) through the pointers returned by rowData().
+///
+/// A table can also be a read-only view on external buffers (for instance a
+/// memory-mapped file, see setExternalData()). Any modification of the table
+/// turns it back into a table owning its buffers.
+///
+/// In builds with 64-bit identifiers (TTK_ENABLE_64BIT_IDS), a complete
+/// table can be stored with narrow identifiers (CompactSimplexId) with
+/// compact(), if all its offsets and items fit. This halves the footprint and
+/// the memory traffic of the tables of small and medium meshes. The access
+/// functions are the same for both widths.
+///
+/// \sa ttk::ExplicitTriangulation
+
+#ifndef _FLATJAGGEDARRAY_H
+#define _FLATJAGGEDARRAY_H
+
+#include <DataTypes.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  class FlatJaggedArray {
+
+  public:
+    FlatJaggedArray() {
+      updatePointers();
+    }
+
+    FlatJaggedArray(const FlatJaggedArray &rhs)
+      : offsets_{rhs.offsets_}, data_{rhs.data_} {
+#ifdef TTK_ENABLE_64BIT_IDS
+      compactOffsets_ = rhs.compactOffsets_;
+      compactData_ = rhs.compactData_;
+#endif
+      updatePointers(rhs);
+    }
+
+    FlatJaggedArray(FlatJaggedArray &&rhs)
+      : offsets_{std::move(rhs.offsets_)}, data_{std::move(rhs.data_)} {
+#ifdef TTK_ENABLE_64BIT_IDS
+      compactOffsets_ = std::move(rhs.compactOffsets_);
+      compactData_ = std::move(rhs.compactData_);
+#endif
+      updatePointers(rhs);
+      rhs.clear();
+    }
+
+    FlatJaggedArray &operator=(const FlatJaggedArray &rhs) {
+      if(this != &rhs) {
+        offsets_ = rhs.offsets_;
+        data_ = rhs.data_;
+#ifdef TTK_ENABLE_64BIT_IDS
+        compactOffsets_ = rhs.compactOffsets_;
+        compactData_ = rhs.compactData_;
+#endif
+        updatePointers(rhs);
+      }
+      return *this;
+    }
+
+    FlatJaggedArray &operator=(FlatJaggedArray &&rhs) {
+      if(this != &rhs) {
+        offsets_ = std::move(rhs.offsets_);
+        data_ = std::move(rhs.data_);
+#ifdef TTK_ENABLE_64BIT_IDS
+        compactOffsets_ = std::move(rhs.compactOffsets_);
+        compactData_ = std::move(rhs.compactData_);
+#endif
+        updatePointers(rhs);
+        rhs.clear();
+      }
+      return *this;
+    }
+
+    /// Read-only view on one row of the table.
+    class CRow {
+    public:
+      CRow(const FlatJaggedArray *table, const SimplexId id)
+        : table_{table}, begin_{table->offset(id)}, size_{table->size(id)} {
+      }
+
+      inline SimplexId size() const {
+        return size_;
+      }
+      inline bool empty() const {
+        return size_ == 0;
+      }
+      inline SimplexId operator[](const SimplexId &i) const {
+        return table_->item(begin_ + i);
+      }
+
+    private:
+      const FlatJaggedArray *table_;
+      SimplexId begin_, size_;
+    };
+
+    /// Remove all the rows and release the memory.
+    inline void clear() {
+      std::vector<SimplexId>().swap(offsets_);
+      std::vector<SimplexId>().swap(data_);
+      releaseCompactData();
+      updatePointers();
+    }
+
+    /// Store the table with narrow identifiers (CompactSimplexId) if all its
+    /// offsets and items fit, to halve its footprint. The table must be
+    /// complete: any later modification turns it back into a wide table.
+    /// This is a no-op in builds with 32-bit identifiers, and on views.
+    /// \return Returns true if the table is stored with narrow identifiers.
+    inline bool compact() {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if((isCompact_) || (isExternal_) || (offsets_.empty()))
+        return isCompact_;
+
+      const SimplexId lowest = std::numeric_limits<CompactSimplexId>::lowest();
+      const SimplexId highest = std::numeric_limits<CompactSimplexId>::max();
+      if(offsets_.back() > highest)
+        return false;
+      for(const auto &item : data_) {
+        if((item < lowest) || (item > highest))
+          return false;
+      }
+
+      compactOffsets_.assign(offsets_.begin(), offsets_.end());
+      compactData_.assign(data_.begin(), data_.end());
+      std::vector<SimplexId>().swap(offsets_);
+      std::vector<SimplexId>().swap(data_);
+      updatePointers();
+#endif
+      return isCompact_;
+    }
+
+    /// Returns true if the table is stored with narrow identifiers (see
+    /// compact()).
+    inline bool isCompact() const {
+      return isCompact_;
+    }
+
+    /// Returns true if no row has been stored.
+    inline bool empty() const {
+      return rowNumber_ == 0;
+    }
+
+    /// Number of rows in the table.
+    inline SimplexId size() const {
+      return rowNumber_;
+    }
+
+    /// Number of items in the \p id-th row.
+    inline SimplexId size(const SimplexId &id) const {
+      return offset(id + 1) - offset(id);
+    }
+
+    /// Total number of items stored in the table.
+    inline SimplexId dataSize() const {
+      return rowNumber_ ? offset(rowNumber_) : 0;
+    }
+
+    /// Get the \p local-th item of the \p id-th row.
+    inline SimplexId get(const SimplexId &id, const SimplexId &local) const {
+      return item(offset(id) + local);
+    }
+
+    inline CRow operator[](const SimplexId &id) const {
+      return CRow(this, id);
+    }
+
+    /// Position in the data buffer of the first item of the \p id-th row.
+    inline SimplexId offset(const SimplexId &id) const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(isCompact_)
+        return compactOffsetBuffer_[id];
+#endif
+      return offsetBuffer_[id];
+    }
+
+    /// Get the \p i-th item of the data buffer.
+    inline SimplexId item(const SimplexId &i) const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(isCompact_)
+        return compactDataBuffer_[i];
+#endif
+      return dataBuffer_[i];
+    }
+
+    /// Size (in bytes) of the offsets and items of the buffers returned by
+    /// offsets() and data().
+    inline size_t itemSize() const {
+      return isCompact_ ? sizeof(CompactSimplexId) : sizeof(SimplexId);
+    }
+
+    /// First pass of a two-pass construction: allocate \p rowNumber empty
+    /// rows. Row sizes are then set with setRowSize() or incrementRowSize().
+    inline void resize(const SimplexId &rowNumber) {
+      offsets_.assign(rowNumber + 1, 0);
+      data_.clear();
+      releaseCompactData();
+      updatePointers();
+    }
+
+    inline void setRowSize(const SimplexId &id, const SimplexId &rowSize) {
+      offsets_[id + 1] = rowSize;
+    }
+
+    inline void incrementRowSize(const SimplexId &id) {
+      offsets_[id + 1]++;
+    }
+
+    /// Turn the row sizes into offsets and allocate the data buffer
+    /// (initialized to \p value).
+    inline void prefixSum(const SimplexId &value = -1) {
+      for(size_t i = 1; i < offsets_.size(); i++) {
+        offsets_[i] += offsets_[i - 1];
+      }
+      data_.assign(offsets_.empty() ? 0 : offsets_.back(), value);
+      releaseCompactData();
+      updatePointers();
+    }
+
+    /// Allocate \p rowNumber rows of \p rowSize items each (for instance for
+    /// the edges of each tetrahedron), initialized to \p value.
+    inline void setUniform(const SimplexId &rowNumber,
+                           const SimplexId &rowSize,
+                           const SimplexId &value = -1) {
+      offsets_.resize(rowNumber + 1);
+      for(SimplexId i = 0; i <= rowNumber; i++) {
+        offsets_[i] = i * rowSize;
+      }
+      data_.assign(rowNumber * rowSize, value);
+      releaseCompactData();
+      updatePointers();
+    }
+
+    /// Mutable access to the first item of the \p id-th row, to fill the
+    /// table after prefixSum() or setUniform().
+    inline SimplexId *rowData(const SimplexId &id) {
+      return data_.data() + offsets_[id];
+    }
+
+    /// Take ownership of already computed buffers.
+    inline void setData(std::vector<SimplexId> &&data,
+                        std::vector<SimplexId> &&offsets) {
+      data_ = std::move(data);
+      offsets_ = std::move(offsets);
+      releaseCompactData();
+      updatePointers();
+    }
+
+    /// Make the table a read-only view on external buffers (for instance a
+    /// memory-mapped file), without copy. \p offsets holds \p rowNumber + 1
+    /// offsets, \p data holds offsets[rowNumber] items.
+    /// \warning The buffers must outlive the table (and its copies).
+    inline void setExternalData(const SimplexId *data,
+                                const SimplexId *offsets,
+                                const SimplexId &rowNumber) {
+      std::vector<SimplexId>().swap(offsets_);
+      std::vector<SimplexId>().swap(data_);
+      releaseCompactData();
+      updatePointers();
+      offsetBuffer_ = offsets;
+      dataBuffer_ = data;
+      rowNumber_ = rowNumber;
+      isExternal_ = true;
+    }
+
+#ifdef TTK_ENABLE_64BIT_IDS
+    /// Same as above, for external buffers of narrow identifiers (for
+    /// instance written from a compact table).
+    inline void setExternalData(const CompactSimplexId *data,
+                                const CompactSimplexId *offsets,
+                                const SimplexId &rowNumber) {
+      setExternalData((const SimplexId *)NULL, NULL, rowNumber);
+      compactOffsetBuffer_ = offsets;
+      compactDataBuffer_ = data;
+      isCompact_ = true;
+    }
+#endif
+
+    /// Returns true if the table is a view on external buffers.
+    inline bool isExternal() const {
+      return isExternal_;
+    }
+
+    /// Build the table from a legacy jagged table.
+    template <class itemType>
+    inline void fillFrom(const std::vector<std::vector<itemType>> &table) {
+      resize(table.size());
+      for(size_t i = 0; i < table.size(); i++) {
+        offsets_[i + 1] = table[i].size();
+      }
+      prefixSum();
+      for(size_t i = 0; i < table.size(); i++) {
+        for(size_t j = 0; j < table[i].size(); j++) {
+          data_[offsets_[i] + j] = table[i][j];
+        }
+      }
+    }
+
+    /// Copy the table into a legacy jagged table (for the
+    /// AbstractTriangulation interface functions returning such tables).
+    inline void copyTo(std::vector<std::vector<SimplexId>> &table,
+                       const int &threadNumber = 1) const {
+      table.resize(size());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(SimplexId i = 0; i < size(); i++) {
+        const SimplexId begin = offset(i), end = offset(i + 1);
+        table[i].resize(end - begin);
+        for(SimplexId j = begin; j < end; j++) {
+          table[i][j - begin] = item(j);
+        }
+      }
+    }
+
+    /// Memory footprint of the table (in bytes). The external buffers of a
+    /// view are not accounted for.
+    inline size_t footprint() const {
+      size_t footprint = (offsets_.size() + data_.size()) * sizeof(SimplexId);
+#ifdef TTK_ENABLE_64BIT_IDS
+      footprint += (compactOffsets_.size() + compactData_.size())
+                   * sizeof(CompactSimplexId);
+#endif
+      return footprint;
+    }
+
+    /// Offset buffer (size() + 1 offsets of itemSize() bytes, NULL if the
+    /// table is empty).
+    inline const void *offsets() const {
+      if(!rowNumber_)
+        return NULL;
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(isCompact_)
+        return compactOffsetBuffer_;
+#endif
+      return offsetBuffer_;
+    }
+
+    /// Data buffer (dataSize() items of itemSize() bytes).
+    inline const void *data() const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(isCompact_)
+        return compactDataBuffer_;
+#endif
+      return dataBuffer_;
+    }
+
+  protected:
+    inline void releaseCompactData() {
+#ifdef TTK_ENABLE_64BIT_IDS
+      std::vector<CompactSimplexId>().swap(compactOffsets_);
+      std::vector<CompactSimplexId>().swap(compactData_);
+#endif
+    }
+
+    // point the access buffers to the owned vectors
+    inline void updatePointers() {
+      offsetBuffer_ = offsets_.data();
+      dataBuffer_ = data_.data();
+      rowNumber_ = offsets_.empty() ? 0 : offsets_.size() - 1;
+      isExternal_ = false;
+      isCompact_ = false;
+#ifdef TTK_ENABLE_64BIT_IDS
+      compactOffsetBuffer_ = compactOffsets_.data();
+      compactDataBuffer_ = compactData_.data();
+      if(!compactOffsets_.empty()) {
+        rowNumber_ = compactOffsets_.size() - 1;
+        isCompact_ = true;
+      }
+#endif
+    }
+
+    // same, after a copy or a move from rhs (views share rhs' buffers)
+    inline void updatePointers(const FlatJaggedArray &rhs) {
+      updatePointers();
+      if(rhs.isExternal_) {
+        offsetBuffer_ = rhs.offsetBuffer_;
+        dataBuffer_ = rhs.dataBuffer_;
+        rowNumber_ = rhs.rowNumber_;
+        isExternal_ = true;
+#ifdef TTK_ENABLE_64BIT_IDS
+        compactOffsetBuffer_ = rhs.compactOffsetBuffer_;
+        compactDataBuffer_ = rhs.compactDataBuffer_;
+        isCompact_ = rhs.isCompact_;
+#endif
+      }
+    }
+
+    std::vector<SimplexId> offsets_;
+    std::vector<SimplexId> data_;
+#ifdef TTK_ENABLE_64BIT_IDS
+    std::vector<CompactSimplexId> compactOffsets_;
+    std::vector<CompactSimplexId> compactData_;
+#endif
+
+    // buffers actually accessed: the owned vectors or external buffers, of
+    // wide or narrow identifiers
+    const SimplexId *offsetBuffer_;
+    const SimplexId *dataBuffer_;
+#ifdef TTK_ENABLE_64BIT_IDS
+    const CompactSimplexId *compactOffsetBuffer_;
+    const CompactSimplexId *compactDataBuffer_;
+#endif
+    SimplexId rowNumber_;
+    bool isExternal_, isCompact_;
+  };
+} // namespace ttk
+
+#endif // _FLATJAGGEDARRAY_H
@@ -0,0 +1,79 @@
+#include <MemoryReport.h>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+using namespace ttk;
+
+void MemoryReport::print(ostream &stream, const string &prefix) const {
+
+  const string totalName = "Total";
+
+  size_t componentWidth = totalName.length(), bufferWidth = 6;
+  for(const auto &entry : entries_) {
+    if(entry.component.length() > componentWidth)
+      componentWidth = entry.component.length();
+    if(entry.buffer.length() > bufferWidth)
+      bufferWidth = entry.buffer.length();
+  }
+
+  auto printLine = [&](const string &component, const string &buffer,
+                       const size_t &bytes, const string &note) {
+    stringstream line;
+    line << prefix << left << setw(componentWidth) << component << "  "
+         << setw(bufferWidth) << buffer << "  " << right << setw(14) << bytes
+         << " B  " << setw(10) << fixed << setprecision(2)
+         << (bytes / 1024.0) / 1024.0 << " MB";
+    if(!note.empty())
+      line << "  (" << note << ")";
+    stream << line.str() << endl;
+  };
+
+  stream << prefix << left << setw(componentWidth) << "Component" << "  "
+         << setw(bufferWidth) << "Buffer" << "  " << right << setw(16)
+         << "Bytes" << "  " << setw(13) << "Size" << endl;
+
+  // entries grouped by component, in order of first appearance
+  vector<string> components;
+  for(const auto &entry : entries_) {
+    bool isNew = true;
+    for(const auto &component : components) {
+      if(component == entry.component)
+        isNew = false;
+    }
+    if(isNew)
+      components.push_back(entry.component);
+  }
+
+  for(const auto &component : components) {
+    for(const auto &entry : entries_) {
+      if(entry.component == component)
+        printLine(entry.component, entry.buffer, entry.bytes, entry.note);
+    }
+    if(components.size() > 1)
+      printLine(component, "(total)", getTotal(component), "");
+  }
+
+  printLine(totalName, "", getTotal(), "");
+}
+
+void MemoryReport::writeCsv(ostream &stream) const {
+
+  // quote the fields which could contain separators
+  auto quote = [](const string &field) {
+    string quoted = "\"";
+    for(const auto &c : field) {
+      if(c == '"')
+        quoted += '"';
+      quoted += c;
+    }
+    return quoted + "\"";
+  };
+
+  stream << "Component,Buffer,Bytes,Note" << endl;
+  for(const auto &entry : entries_) {
+    stream << quote(entry.component) << "," << quote(entry.buffer) << ","
+           << entry.bytes << "," << quote(entry.note) << endl;
+  }
+}
@@ -0,0 +1,114 @@
+/// \ingroup base
+/// \class ttk::MemoryReport
+/// \date October 2019.
+///
+/// \brief Structured report of the memory footprint of TTK objects.
+///
+/// Each entry of a report gives the number of bytes used by one internal
+/// buffer (a relation of a triangulation, a vector of a merge tree, etc.) of
+/// a component. Objects deriving from ttk::Debug fill reports with
+/// Debug::getMemoryReport(). A report can then be printed as a table, to size
+/// jobs, or exported as CSV, to track memory regressions across versions.
+///
+/// Unlike Memory, which measures the resident memory of the whole process,
+/// the entries are computed from the sizes of the containers: they do not
+/// depend on the allocator and are deterministic.
+///
+/// \sa ttk::Debug
+
+#ifndef _MEMORYREPORT_H
+#define _MEMORYREPORT_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ttk {
+
+  class MemoryReport {
+
+  public:
+    struct Entry {
+      std::string component;
+      std::string buffer;
+      size_t bytes;
+      // extra information (storage mode, etc.)
+      std::string note;
+    };
+
+    /// Add an entry to the report. Empty buffers are skipped, unless a note
+    /// is given (for instance for memory-mapped buffers).
+    inline void add(const std::string &component,
+                    const std::string &buffer,
+                    const size_t &bytes,
+                    const std::string &note = "") {
+      if((bytes) || (!note.empty())) {
+        Entry entry;
+        entry.component = component;
+        entry.buffer = buffer;
+        entry.bytes = bytes;
+        entry.note = note;
+        entries_.push_back(entry);
+      }
+    }
+
+    inline void clear() {
+      entries_.clear();
+    }
+
+    inline const std::vector<Entry> &getEntries() const {
+      return entries_;
+    }
+
+    /// Total number of bytes of the report.
+    inline size_t getTotal() const {
+      size_t total = 0;
+      for(const auto &entry : entries_)
+        total += entry.bytes;
+      return total;
+    }
+
+    /// Total number of bytes of the entries of a component.
+    inline size_t getTotal(const std::string &component) const {
+      size_t total = 0;
+      for(const auto &entry : entries_) {
+        if(entry.component == component)
+          total += entry.bytes;
+      }
+      return total;
+    }
+
+    /// Print the report as a table (one line per buffer, plus one total per
+    /// component and an overall total). Each line starts with \p prefix.
+    void print(std::ostream &stream, const std::string &prefix = "") const;
+
+    /// Write the report in CSV format (with a header line).
+    void writeCsv(std::ostream &stream) const;
+
+    /// Heap memory of a vector (its capacity).
+    template <class itemType>
+    static inline size_t bytes(const std::vector<itemType> &buffer) {
+      return buffer.capacity() * sizeof(itemType);
+    }
+
+    /// Heap memory of a jagged table (the outer vector and all the rows).
+    template <class itemType>
+    static inline size_t
+      bytes(const std::vector<std::vector<itemType>> &buffer) {
+      size_t byteNumber = buffer.capacity() * sizeof(std::vector<itemType>);
+      for(const auto &row : buffer)
+        byteNumber += bytes(row);
+      return byteNumber;
+    }
+
+    static inline size_t bytes(const std::vector<bool> &buffer) {
+      return (buffer.capacity() + 7) / 8;
+    }
+
+  protected:
+    std::vector<Entry> entries_;
+  };
+} // namespace ttk
+
+#endif // _MEMORYREPORT_H
@@ -21,6 +21,8 @@
 #elif defined(__unix__) || defined(__APPLE__)
 
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -255,4 +257,94 @@ namespace ttk {
     return system(cmd.str().data());
   }
 
+  MappedFile::MappedFile() : data_{NULL}, size_{0} {
+#ifdef _WIN32
+    fileHandle_ = NULL;
+    mappingHandle_ = NULL;
+#endif
+  }
+
+  MappedFile::~MappedFile() {
+    close();
+  }
+
+  int MappedFile::close() {
+
+    if(!data_)
+      return 0;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(mappingHandle_);
+    CloseHandle(fileHandle_);
+    mappingHandle_ = NULL;
+    fileHandle_ = NULL;
+#else
+    munmap((void *)data_, size_);
+#endif
+
+    data_ = NULL;
+    size_ = 0;
+
+    return 0;
+  }
+
+  int MappedFile::open(const std::string &fileName) {
+
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName.data(), GENERIC_READ, FILE_SHARE_READ,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE)
+      return -1;
+
+    LARGE_INTEGER fileSize;
+    if((!GetFileSizeEx(file, &fileSize)) || (fileSize.QuadPart == 0)) {
+      CloseHandle(file);
+      return -2;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(!mapping) {
+      CloseHandle(file);
+      return -3;
+    }
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!view) {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return -4;
+    }
+
+    fileHandle_ = file;
+    mappingHandle_ = mapping;
+    data_ = (const char *)view;
+    size_ = (size_t)fileSize.QuadPart;
+#else
+    const int file = ::open(fileName.data(), O_RDONLY);
+    if(file == -1)
+      return -1;
+
+    struct stat fileStat;
+    if((fstat(file, &fileStat) == -1) || (fileStat.st_size == 0)) {
+      ::close(file);
+      return -2;
+    }
+
+    void *view
+      = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    // the mapping remains valid after the file is closed
+    ::close(file);
+    if(view == MAP_FAILED)
+      return -3;
+
+    data_ = (const char *)view;
+    size_ = (size_t)fileStat.st_size;
+#endif
+
+    return 0;
+  }
+
 } // namespace ttk
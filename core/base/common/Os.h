@@ -155,6 +155,42 @@ namespace ttk {
 
     double start_;
   };
+
+  /// Read-only memory mapping of a whole file.
+  class MappedFile {
+
+  public:
+    MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    /// Unmap the file (if any).
+    int close();
+
+    /// First byte of the mapped file (NULL if no file is mapped).
+    inline const char *data() const {
+      return data_;
+    }
+
+    /// Map the file \p fileName.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int open(const std::string &fileName);
+
+    /// Size of the mapped file (in bytes).
+    inline size_t size() const {
+      return size_;
+    }
+
+  protected:
+    const char *data_;
+    size_t size_;
+#ifdef _WIN32
+    void *fileHandle_, *mappingHandle_;
+#endif
+  };
 } // namespace ttk
 
 #endif
@@ -0,0 +1,149 @@
+/// \ingroup base
+/// \class ttk::RadixSort
+/// \date October 2019.
+///
+/// \brief Parallel, stable LSD radix sort on unsigned integer keys.
+///
+/// The items are sorted by the key returned by a user functor, 8 bits at a
+/// time, starting from the least significant byte. Each pass builds one
+/// histogram per thread, computes the scatter offsets with a prefix sum over
+/// (digit, thread) and scatters the items in parallel. Since every pass is
+/// stable and the threads process contiguous chunks in order, the output
+/// does not depend on the number of threads.
+///
+/// Passes where all the items share the same digit are skipped.
+///
+/// Sorting on a composite key (for instance a triangle given by three vertex
+/// identifiers) is achieved by calling sort() successively on the keys, from
+/// the least significant to the most significant one.
+
+#ifndef _RADIXSORT_H
+#define _RADIXSORT_H
+
+#ifdef TTK_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+#include <DataTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ttk {
+
+  namespace RadixSort {
+
+    /// Number of bits needed to represent any value in [0, maxValue].
+    inline int keyBits(const unsigned long long &maxValue) {
+      int bits = 0;
+      while((bits < 64) && ((maxValue >> bits) != 0))
+        bits++;
+      return bits;
+    }
+
+    /// Sort \p items by increasing key (stable).
+    /// \param items Items to sort.
+    /// \param buffer Scratch buffer (resized to the number of items). It can
+    /// be reused across calls to avoid re-allocations.
+    /// \param getKey Functor returning the (unsigned integer) key of an item.
+    /// \param bitNumber Number of significant bits of the keys (see
+    /// keyBits()).
+    /// \param threadNumber Number of threads.
+    template <class itemType, class keyFunctor>
+    void sort(std::vector<itemType> &items,
+              std::vector<itemType> &buffer,
+              const keyFunctor &getKey,
+              const int &bitNumber,
+              const ThreadId &threadNumber = 1) {
+
+      const int digitBits = 8;
+      const int digitNumber = 1 << digitBits;
+      const size_t itemNumber = items.size();
+
+      if(itemNumber < 2)
+        return;
+
+      ThreadId localThreadNumber = 1;
+#ifdef TTK_ENABLE_OPENMP
+      localThreadNumber = threadNumber;
+      // no need to spawn threads for tiny chunks
+      if(itemNumber < 4096 * (size_t)localThreadNumber)
+        localThreadNumber = 1 + itemNumber / 4096;
+      if(localThreadNumber > threadNumber)
+        localThreadNumber = threadNumber;
+      if(localThreadNumber < 1)
+        localThreadNumber = 1;
+#else
+      (void)threadNumber;
+#endif
+
+      buffer.resize(itemNumber);
+      std::vector<size_t> histograms(localThreadNumber * digitNumber);
+
+      for(int shift = 0; shift < bitNumber; shift += digitBits) {
+
+        bool isSortedDigit = false;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(localThreadNumber)
+#endif
+        {
+          // the team may be smaller than requested (nested parallelism,
+          // thread limit): the chunks follow the actual team size
+          ThreadId threadId = 0;
+          ThreadId teamSize = 1;
+#ifdef TTK_ENABLE_OPENMP
+          threadId = omp_get_thread_num();
+          teamSize = omp_get_num_threads();
+#endif
+          const size_t begin = (itemNumber * threadId) / teamSize;
+          const size_t end = (itemNumber * (threadId + 1)) / teamSize;
+          size_t *histogram = &(histograms[threadId * digitNumber]);
+
+          for(int i = 0; i < digitNumber; i++)
+            histogram[i] = 0;
+
+          for(size_t i = begin; i < end; i++) {
+            histogram[(getKey(items[i]) >> shift) & (digitNumber - 1)]++;
+          }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+          {
+            // exclusive prefix sum, digit major, thread minor
+            size_t offset = 0;
+            for(int i = 0; i < digitNumber; i++) {
+              size_t digitCount = 0;
+              for(ThreadId j = 0; j < teamSize; j++) {
+                const size_t count = histograms[j * digitNumber + i];
+                histograms[j * digitNumber + i] = offset;
+                offset += count;
+                digitCount += count;
+              }
+              if(digitCount == itemNumber)
+                isSortedDigit = true;
+            }
+          }
+          // implicit barrier at the end of the single section
+
+          if(!isSortedDigit) {
+            for(size_t i = begin; i < end; i++) {
+              buffer[histogram[(getKey(items[i]) >> shift)
+                               & (digitNumber - 1)]++]
+                = items[i];
+            }
+          }
+        }
+
+        if(!isSortedDigit)
+          items.swap(buffer);
+      }
+    }
+
+  } // namespace RadixSort
+} // namespace ttk
+
+#endif // _RADIXSORT_H
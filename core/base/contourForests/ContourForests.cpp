@@ -23,6 +23,7 @@ ContourForests::ContourForests()
   : ContourForestsTree(new Params(), nullptr, new Scalars()), parallelParams_(),
     parallelData_() {
   params_->treeType = TreeType::Contour;
+  params_->taskRuntime = TaskRuntime::create(TaskRuntime::getDefaultType());
   stringstream msg;
   msg << "[ContourForests]: DEPRECATED This module will be removed in a future"
       << "release, please use FTM instead for contour trees"
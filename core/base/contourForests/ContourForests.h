@@ -149,6 +149,23 @@ namespace ttk {
         parallelParams_.lessPartition = l;
       }
 
+      /// Runtime executing the partition tasks (see ttk::TaskRuntime).
+      /// Default: OpenMP tasks.
+      inline void setTaskRuntime(const std::shared_ptr<TaskRuntime> &runtime) {
+        params_->taskRuntime = runtime;
+      }
+
+      inline const std::shared_ptr<TaskRuntime> &getTaskRuntime(void) const {
+        return params_->taskRuntime;
+      }
+
+      /// Select the task runtime by type (see ttk::TaskRuntime::create()).
+      /// The current runtime is kept if it already has this type.
+      inline void setTaskRuntimeType(const TaskRuntime::Type &type) {
+        if(!params_->taskRuntime || params_->taskRuntime->getType() != type)
+          setTaskRuntime(TaskRuntime::create(type));
+      }
+
       // range of partitions, position of seeds , ...
 
       inline std::tuple<SimplexId, SimplexId>
@@ -22,6 +22,8 @@
 
 #include "ContourForests.h"
 
+#include <mutex>
+
 namespace ttk {
   namespace cf {
 
@@ -286,28 +288,15 @@ namespace ttk {
       std::vector<float> speedProcess(parallelParams_.nbPartitions * 2, 0);
 #ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
       SimplexId nbPairMerged = 0;
+      std::mutex simplifyMutex;
 #endif
 
-#ifdef TTK_ENABLE_OPENMP
-      omp_set_nested(1);
-#endif
+      const std::shared_ptr<TaskRuntime> &runtime = params_->taskRuntime;
 
-// std::cout << "NO PARALLEL DEBUG MODE" << std::endl;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(parallelParams_.nbPartitions) \
-  schedule(static)
-#endif
-      for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+      // one task per partition, each building its JT and ST
+      auto buildPartition = [&](const idPartition i) {
         DebugTimer timerMergeTree;
 
-        // ------------------------------------------------------
-        // Skip partition that are not asked to compute if needed
-        // ------------------------------------------------------
-
-        if(parallelParams_.partitionNum != -1
-           && parallelParams_.partitionNum != i)
-          continue;
-
         // ------------------------------------------------------
         // Retrieve boundary & overlap list for current partition
         // ------------------------------------------------------
@@ -325,187 +314,196 @@ namespace ttk {
         // Build JT and ST
         // ---------------
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel sections num_threads(2) if(parallelParams_.lessPartition)
-#endif
-        {
+        auto buildJT = [&]() {
+          if(params_->treeType == TreeType::Join
+             || params_->treeType == TreeType::Contour
+             || params_->treeType == TreeType::JoinAndSplit) {
+            DebugTimer timerSimplify;
+            DebugTimer timerBuild;
+            parallelData_.trees[i].getJoinTree()->build(
+              vect_baseUF_JT[i], std::get<0>(overlaps), std::get<1>(overlaps),
+              std::get<0>(rangeJT), std::get<1>(rangeJT),
+              std::get<0>(seedsPos), std::get<1>(seedsPos));
+            speedProcess[i] = partitionSize / timerBuild.getElapsedTime();
 
-        // if less partition : we built JT and ST in parallel
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp section
+#ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
+            timerSimplify.reStart();
+            const SimplexId tmpMerge =
+
+              parallelData_.trees[i].getJoinTree()->localSimplify<scalarType>(
+                std::get<0>(seedsPos), std::get<1>(seedsPos));
+            std::lock_guard<std::mutex> lock(simplifyMutex);
+            timeSimplify[i] += timerSimplify.getElapsedTime();
+            nbPairMerged += tmpMerge;
 #endif
-          {if(params_->treeType == TreeType::Join
-              || params_->treeType == TreeType::Contour
-              || params_->treeType
-                   == TreeType::JoinAndSplit){DebugTimer timerSimplify;
-        DebugTimer timerBuild;
-        parallelData_.trees[i].getJoinTree()->build(
-          vect_baseUF_JT[i], std::get<0>(overlaps), std::get<1>(overlaps),
-          std::get<0>(rangeJT), std::get<1>(rangeJT), std::get<0>(seedsPos),
-          std::get<1>(seedsPos));
-        speedProcess[i] = partitionSize / timerBuild.getElapsedTime();
+          }
+        };
+
+        auto buildST = [&]() {
+          if(params_->treeType == TreeType::Split
+             || params_->treeType == TreeType::Contour
+             || params_->treeType == TreeType::JoinAndSplit) {
+            DebugTimer timerSimplify;
+            DebugTimer timerBuild;
+            parallelData_.trees[i].getSplitTree()->build(
+              vect_baseUF_ST[i], std::get<1>(overlaps), std::get<0>(overlaps),
+              std::get<0>(rangeST), std::get<1>(rangeST),
+              std::get<0>(seedsPos), std::get<1>(seedsPos));
+            speedProcess[parallelParams_.nbPartitions + i]
+              = partitionSize / timerBuild.getElapsedTime();
 
 #ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
-        timerSimplify.reStart();
-        const SimplexId tmpMerge =
-
-          parallelData_.trees[i].getJoinTree()->localSimplify<scalarType>(
-            std::get<0>(seedsPos), std::get<1>(seedsPos));
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
+            timerSimplify.reStart();
+            const SimplexId tmpMerge =
+
+              parallelData_.trees[i].getSplitTree()->localSimplify<scalarType>(
+                std::get<0>(seedsPos), std::get<1>(seedsPos));
+            std::lock_guard<std::mutex> lock(simplifyMutex);
+            timeSimplify[i] += timerSimplify.getElapsedTime();
+            nbPairMerged += tmpMerge;
 #endif
-        timeSimplify[i] += timerSimplify.getElapsedTime();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-        nbPairMerged += tmpMerge;
-#endif
-      }
-    }
+          }
+        };
+
+        if(parallelParams_.lessPartition) {
+          // if less partition : we built JT and ST in parallel
+          TaskGroup trees(runtime);
+          trees.spawn(buildJT);
+          buildST();
+          trees.wait();
+        } else {
+          buildJT();
+          buildST();
+        }
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp section
-#endif
-    {
-      if(params_->treeType == TreeType::Split
-         || params_->treeType == TreeType::Contour
-         || params_->treeType == TreeType::JoinAndSplit) {
-        DebugTimer timerSimplify;
-        DebugTimer timerBuild;
-        parallelData_.trees[i].getSplitTree()->build(
-          vect_baseUF_ST[i], std::get<1>(overlaps), std::get<0>(overlaps),
-          std::get<0>(rangeST), std::get<1>(rangeST), std::get<0>(seedsPos),
-          std::get<1>(seedsPos));
-        speedProcess[parallelParams_.nbPartitions + i]
-          = partitionSize / timerBuild.getElapsedTime();
+        {
+          std::stringstream mt;
+          mt << "[ParallelBuild] Merge Tree " << static_cast<unsigned>(i)
+             << " constructed in : " << timerMergeTree.getElapsedTime()
+             << std::endl;
+          dMsg(std::cout, mt.str(), infoMsg);
+        }
 
-#ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
-        timerSimplify.reStart();
-        const SimplexId tmpMerge =
+        // Update segmentation of each arc if needed
+        if(params_->simplifyThreshold
+           || params_->treeType != TreeType::Contour) {
+          DebugTimer timerUpdateSegm;
+          parallelData_.trees[i].getJoinTree()->updateSegmentation();
+          parallelData_.trees[i].getSplitTree()->updateSegmentation();
 
-          parallelData_.trees[i].getSplitTree()->localSimplify<scalarType>(
-            std::get<0>(seedsPos), std::get<1>(seedsPos));
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-        timeSimplify[i] += timerSimplify.getElapsedTime();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-        nbPairMerged += tmpMerge;
-#endif
-      }
-    }
+          if(params_->debugLevel >= 3) {
+            std::cout << "Local MT : updated in "
+                      << timerUpdateSegm.getElapsedTime() << std::endl;
+          }
+        }
 
-  } // namespace cf
+        // ---------------
+        // Combine JT & ST
+        // ---------------
 
-  {
-    std::stringstream mt;
-    mt << "[ParallelBuild] Merge Tree " << static_cast<unsigned>(i)
-       << " constructed in : " << timerMergeTree.getElapsedTime() << std::endl;
-    dMsg(std::cout, mt.str(), infoMsg);
-  }
-
-  // Update segmentation of each arc if needed
-  if(params_->simplifyThreshold || params_->treeType != TreeType::Contour) {
-    DebugTimer timerUpdateSegm;
-    parallelData_.trees[i].getJoinTree()->updateSegmentation();
-    parallelData_.trees[i].getSplitTree()->updateSegmentation();
-
-    if(params_->debugLevel >= 3) {
-      std::cout << "Local MT : updated in " << timerUpdateSegm.getElapsedTime()
-                << std::endl;
-    }
-  }
-
-  // ---------------
-  // Combine JT & ST
-  // ---------------
-
-  if(params_->treeType == TreeType::Contour) {
-    DebugTimer timerCombine;
-
-    // clone here if we do not want to destry original merge trees!
-    auto *jt = parallelData_.trees[i].getJoinTree();
-    auto *st = parallelData_.trees[i].getSplitTree();
-
-    // Copy missing nodes of a tree to the other one
-    // Maintain this traversal order for good insertion
-    for(idNode t = 0; t < st->getNumberOfNodes(); ++t) {
-      if(!st->getNode(t)->isHidden()) {
-        // std::cout << "insert in jt : " <<
-        // st->getNode(t)->getVertexId() << std::endl;
-        jt->insertNode(st->getNode(t), true);
-      }
-    }
-    // and vice versa
-    for(idNode t = 0; t < jt->getNumberOfNodes(); ++t) {
-      if(!jt->getNode(t)->isHidden()) {
-        // std::cout << "insert in st : " <<
-        // jt->getNode(t)->getVertexId() << std::endl;
-        st->insertNode(jt->getNode(t), true);
-      }
-    }
+        if(params_->treeType == TreeType::Contour) {
+          DebugTimer timerCombine;
+
+          // clone here if we do not want to destry original merge trees!
+          auto *jt = parallelData_.trees[i].getJoinTree();
+          auto *st = parallelData_.trees[i].getSplitTree();
+
+          // Copy missing nodes of a tree to the other one
+          // Maintain this traversal order for good insertion
+          for(idNode t = 0; t < st->getNumberOfNodes(); ++t) {
+            if(!st->getNode(t)->isHidden()) {
+              // std::cout << "insert in jt : " <<
+              // st->getNode(t)->getVertexId() << std::endl;
+              jt->insertNode(st->getNode(t), true);
+            }
+          }
+          // and vice versa
+          for(idNode t = 0; t < jt->getNumberOfNodes(); ++t) {
+            if(!jt->getNode(t)->isHidden()) {
+              // std::cout << "insert in st : " <<
+              // jt->getNode(t)->getVertexId() << std::endl;
+              st->insertNode(jt->getNode(t), true);
+            }
+          }
 
-    // debug print current JT / ST
-    if(params_->debugLevel >= 6) {
-      std::cout << "Local JT :" << std::endl;
-      parallelData_.trees[i].getJoinTree()->printTree2();
-      std::cout << "Local ST :" << std::endl;
-      parallelData_.trees[i].getSplitTree()->printTree2();
-      std::cout << "combine" << std::endl;
-    }
+          // debug print current JT / ST
+          if(params_->debugLevel >= 6) {
+            std::cout << "Local JT :" << std::endl;
+            parallelData_.trees[i].getJoinTree()->printTree2();
+            std::cout << "Local ST :" << std::endl;
+            parallelData_.trees[i].getSplitTree()->printTree2();
+            std::cout << "combine" << std::endl;
+          }
 
-    // Combine, destroy JT and ST to compute CT
-    parallelData_.trees[i].combine(
-      std::get<0>(seedsPos), std::get<1>(seedsPos));
-    parallelData_.trees[i].updateSegmentation();
+          // Combine, destroy JT and ST to compute CT
+          parallelData_.trees[i].combine(
+            std::get<0>(seedsPos), std::get<1>(seedsPos));
+          parallelData_.trees[i].updateSegmentation();
 
-    if(params_->debugLevel > 2) {
-      printDebug(timerCombine, "Trees combined   in    ");
-    }
+          if(params_->debugLevel > 2) {
+            printDebug(timerCombine, "Trees combined   in    ");
+          }
 
-    // debug print CT
-    if(params_->debugLevel >= 4) {
-      parallelData_.trees[i].printTree2();
-    }
-  } else {
-    if(params_->debugLevel >= 6) {
-      std::cout << "Local JT :" << std::endl;
-      parallelData_.trees[i].getJoinTree()->printTree2();
-      std::cout << "Local ST :" << std::endl;
-      parallelData_.trees[i].getSplitTree()->printTree2();
-      std::cout << "combine" << std::endl;
-    }
-  }
-} // namespace ttk
+          // debug print CT
+          if(params_->debugLevel >= 4) {
+            parallelData_.trees[i].printTree2();
+          }
+        } else {
+          if(params_->debugLevel >= 6) {
+            std::cout << "Local JT :" << std::endl;
+            parallelData_.trees[i].getJoinTree()->printTree2();
+            std::cout << "Local ST :" << std::endl;
+            parallelData_.trees[i].getSplitTree()->printTree2();
+            std::cout << "combine" << std::endl;
+          }
+        }
+      };
+
+      // std::cout << "NO PARALLEL DEBUG MODE" << std::endl;
+      runtime->run(
+        [&]() {
+          TaskGroup partitions(runtime);
+          for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+            // Skip partition that are not asked to compute if needed
+            if(parallelParams_.partitionNum != -1
+               && parallelParams_.partitionNum != i)
+              continue;
+
+            partitions.spawn([&buildPartition, i]() { buildPartition(i); });
+          }
+          partitions.wait();
+        },
+        parallelParams_.nbThreads);
 
-// -------------------------------------
-// Print process speed and simplify info
-// -------------------------------------
+      // -------------------------------------
+      // Print process speed and simplify info
+      // -------------------------------------
 
-if(params_->debugLevel > 2) {
+      if(params_->debugLevel > 2) {
 #ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
-  if(params_->simplifyThreshold) {
-    auto maxSimplifIt = max_element(timeSimplify.cbegin(), timeSimplify.cend());
-    float maxSimplif = *maxSimplifIt;
-    std::cout << "Local simplification maximum time :" << maxSimplif;
-    std::cout << " ( " << nbPairMerged << " pairs merged )" << std::endl;
-  }
+        if(params_->simplifyThreshold) {
+          auto maxSimplifIt
+            = max_element(timeSimplify.cbegin(), timeSimplify.cend());
+          float maxSimplif = *maxSimplifIt;
+          std::cout << "Local simplification maximum time :" << maxSimplif;
+          std::cout << " ( " << nbPairMerged << " pairs merged )" << std::endl;
+        }
 #endif
-  auto maxProcSpeed = max_element(speedProcess.cbegin(), speedProcess.cend());
-  auto minProcSpeed = min_element(speedProcess.cbegin(), speedProcess.cend());
-  std::cout << "process speed : ";
-  std::cout << " min is " << *minProcSpeed << " vert/sec";
-  std::cout << " max is " << *maxProcSpeed << " vert/sec";
-  std::cout << std::endl;
-}
-
-return 0;
-}
-
-//}
-}
-}
+        auto maxProcSpeed
+          = max_element(speedProcess.cbegin(), speedProcess.cend());
+        auto minProcSpeed
+          = min_element(speedProcess.cbegin(), speedProcess.cend());
+        std::cout << "process speed : ";
+        std::cout << " min is " << *minProcSpeed << " vert/sec";
+        std::cout << " max is " << *maxProcSpeed << " vert/sec";
+        std::cout << std::endl;
+      }
+
+      return 0;
+    }
+
+    //}
+  } // namespace cf
+} // namespace ttk
 
 #endif /* end of include guard: _CONTOURFORESTSTEMPLATE_H */
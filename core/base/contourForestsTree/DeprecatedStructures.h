@@ -15,6 +15,9 @@
 #define STRUCTURES_H
 
 #include <iterator>
+#include <memory>
+
+#include <TaskRuntime.h>
 
 #include "DeprecatedDataTypes.h"
 #include "DeprecatedNode.h"
@@ -29,6 +32,8 @@ namespace ttk {
       TreeType treeType;
       SimplifMethod simplifyMethod;
       double simplifyThreshold;
+      // shared by the trees of all the partitions
+      std::shared_ptr<TaskRuntime> taskRuntime;
     };
 
     // Scalar related containers (global)
@@ -7,10 +7,15 @@
 
 #include "MergeTree.h"
 
+#include <mutex>
+
 using namespace std;
 using namespace ttk;
 using namespace cf;
 
+// serialize the debug prints of the concurrent partitions
+static mutex printMutex;
+
 // Constructors & destructors
 
 MergeTree::MergeTree(Params *const params,
@@ -75,10 +80,8 @@ int MergeTree::build(vector<ExtendedUnionFind *> &vect_baseUF,
 
   // print debug
   if(params_->debugLevel >= 3) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
     {
+      lock_guard<mutex> lock(printMutex);
       cout << "partition : " << static_cast<unsigned>(treeData_.partition);
       cout << ", isJT : " << isJT;
       cout << ",  size : ";
@@ -1290,10 +1293,8 @@ idSuperArc MergeTree::hideAndClearLeadingTo(const idNode &baseNode,
 
 // Print
 void MergeTree::printTree2() {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
   {
+    lock_guard<mutex> lock(printMutex);
     cout << "Partition : " << static_cast<unsigned>(treeData_.partition)
          << endl;
 
@@ -1608,10 +1609,8 @@ tuple<idNode, idNode, SimplexId> MergeTree::createReceptArc(
 bool MergeTree::verifyTree(void) {
   bool res = true;
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
   {
+    lock_guard<mutex> lock(printMutex);
     const idSuperArc &nbArcs = getNumberOfSuperArcs();
     const idSuperArc &nbNodes = getNumberOfNodes();
 
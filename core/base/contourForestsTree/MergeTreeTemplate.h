@@ -590,61 +590,42 @@ namespace ttk {
       std::vector<ExtendedUnionFind *> vect_JoinUF(nbNode, nullptr);
       std::vector<ExtendedUnionFind *> vect_SplitUF(nbNode, nullptr);
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel sections num_threads(2)
-#endif
-      {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp section
-#endif
-        {
-          pairsJT.reserve(treeData_.leaves.size());
-          // For the biggest pair of the component
-          std::map<SimplexId, SimplexId> pendingMinMax;
-
-          for(auto it = sortedNodes.cbegin(); it != sortedNodes.cend(); ++it) {
-            const idNode &n = *it;
-            const SimplexId &v = getNode(n)->getVertexId();
-
-            const auto &nbUp = getNode(n)->getNumberOfUpSuperArcs();
-            const auto &nbDown = getNode(n)->getNumberOfDownSuperArcs();
-
-            if(nbDown == 0) {
-              // leaf
-              vect_JoinUF[n] = new ExtendedUnionFind(getNode(n)->getVertexId());
-              vect_JoinUF[n]->setOrigin(v);
-              // std::cout << " jt origin : " << v << std::endl;
-            } else {
-              // first descendant
-              const idSuperArc firstSaId = getNode(n)->getDownSuperArcId(0);
-              const SuperArc *firstSA = getSuperArc(firstSaId);
-              const idNode &firstChildNodeId = firstSA->getDownNodeId();
-
-              ExtendedUnionFind *merge = vect_JoinUF[firstChildNodeId]->find();
-              SimplexId further = merge->getOrigin();
-              idSuperArc furtherI = 0;
-
-              // Find the most persistant way
-              for(idSuperArc ni = 1; ni < nbDown; ++ni) {
-                const idSuperArc curSaId = getNode(n)->getDownSuperArcId(ni);
-                const SuperArc *curSA = getSuperArc(curSaId);
-                const idNode &neigh = curSA->getDownNodeId();
-
-                // fix
-                if(neigh == n)
-                  continue;
-
-                ExtendedUnionFind *neighUF = vect_JoinUF[neigh]->find();
-
-                if(isLower(neighUF->getOrigin(), further)) {
-                  further = neighUF->getOrigin();
-                  furtherI = ni;
-                }
-              }
-
-              if(nbDown > 1) {
-                // close finish pair and make union
-                for(idSuperArc ni = 0; ni < nbDown; ++ni) {
+      // JT and ST pairs are recovered in parallel
+      params_->taskRuntime->run(
+        [&]() {
+          TaskGroup sections(params_->taskRuntime);
+          sections.spawn([&]() {
+            pairsJT.reserve(treeData_.leaves.size());
+            // For the biggest pair of the component
+            std::map<SimplexId, SimplexId> pendingMinMax;
+
+            for(auto it = sortedNodes.cbegin(); it != sortedNodes.cend();
+                ++it) {
+              const idNode &n = *it;
+              const SimplexId &v = getNode(n)->getVertexId();
+
+              const auto &nbUp = getNode(n)->getNumberOfUpSuperArcs();
+              const auto &nbDown = getNode(n)->getNumberOfDownSuperArcs();
+
+              if(nbDown == 0) {
+                // leaf
+                vect_JoinUF[n]
+                  = new ExtendedUnionFind(getNode(n)->getVertexId());
+                vect_JoinUF[n]->setOrigin(v);
+                // std::cout << " jt origin : " << v << std::endl;
+              } else {
+                // first descendant
+                const idSuperArc firstSaId = getNode(n)->getDownSuperArcId(0);
+                const SuperArc *firstSA = getSuperArc(firstSaId);
+                const idNode &firstChildNodeId = firstSA->getDownNodeId();
+
+                ExtendedUnionFind *merge
+                  = vect_JoinUF[firstChildNodeId]->find();
+                SimplexId further = merge->getOrigin();
+                idSuperArc furtherI = 0;
+
+                // Find the most persistant way
+                for(idSuperArc ni = 1; ni < nbDown; ++ni) {
                   const idSuperArc curSaId = getNode(n)->getDownSuperArcId(ni);
                   const SuperArc *curSA = getSuperArc(curSaId);
                   const idNode &neigh = curSA->getDownNodeId();
@@ -655,147 +636,168 @@ namespace ttk {
 
                   ExtendedUnionFind *neighUF = vect_JoinUF[neigh]->find();
 
-                  if(ni != furtherI) { // keep the more persitent pair
-                    addPair<scalarType>(pairsJT, neighUF->getOrigin(), v, true);
-                    pendingMinMax.erase(neighUF->getOrigin());
-
-                    // std::cout << " jt make pair : " <<
-                    // neighUF->getOrigin() << " - " << v <<
-                    // std::endl;
+                  if(isLower(neighUF->getOrigin(), further)) {
+                    further = neighUF->getOrigin();
+                    furtherI = ni;
                   }
-
-                  ExtendedUnionFind::makeUnion(merge, neighUF)
-                    ->setOrigin(further);
                 }
-              }
 
-              merge->find()->setOrigin(further);
-              vect_JoinUF[n] = merge->find();
+                if(nbDown > 1) {
+                  // close finish pair and make union
+                  for(idSuperArc ni = 0; ni < nbDown; ++ni) {
+                    const idSuperArc curSaId
+                      = getNode(n)->getDownSuperArcId(ni);
+                    const SuperArc *curSA = getSuperArc(curSaId);
+                    const idNode &neigh = curSA->getDownNodeId();
 
-              if(!nbUp) {
-                // potential close of the component
-                // std::cout << "pending for " << further << " is " << v <<
-                // std::endl;
-                pendingMinMax[further] = v;
-              }
-            }
-          } // end for each node
+                    // fix
+                    if(neigh == n)
+                      continue;
 
-          // Add the pending biggest pair of each component
-          for(const auto &pair_vert : pendingMinMax) {
-            if(isCorrespondingNode(pair_vert.second)) {
-              // std::cout << " add : " << pair_vert.first << " - " <<
-              // pair_vert.second << std::endl;
-              addPair<scalarType>(
-                pairsJT, pair_vert.first, pair_vert.second, true);
-            }
-          }
-        } // end para section
+                    ExtendedUnionFind *neighUF = vect_JoinUF[neigh]->find();
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp section
-#endif
-        {
-          pairsST.reserve(treeData_.leaves.size());
-          // For the biggest pair of the component
-          std::map<SimplexId, SimplexId> pendingMinMax;
-
-          for(auto it = sortedNodes.crbegin(); it != sortedNodes.crend();
-              ++it) {
-            const idNode &n = *it;
-            const SimplexId &v = getNode(n)->getVertexId();
-
-            const auto &nbUp = getNode(n)->getNumberOfUpSuperArcs();
-            const auto &nbDown = getNode(n)->getNumberOfDownSuperArcs();
-
-            if(nbUp == 0) {
-              // leaf
-              vect_SplitUF[n]
-                = new ExtendedUnionFind(getNode(n)->getVertexId());
-              vect_SplitUF[n]->setOrigin(v);
-              // std::cout << " st origin : " << v << std::endl;
-            } else {
-              // first descendant
-              const idSuperArc firstSaId = getNode(n)->getUpSuperArcId(0);
-              const SuperArc *firstSA = getSuperArc(firstSaId);
-              const idNode &firstChildNodeId = firstSA->getUpNodeId();
-
-              ExtendedUnionFind *merge = vect_SplitUF[firstChildNodeId]->find();
-              SimplexId further = merge->getOrigin();
-              idSuperArc furtherI = 0;
-
-              for(idSuperArc ni = 1; ni < nbUp; ++ni) {
-                // find the more persistant way
-                const idSuperArc curSaId = getNode(n)->getUpSuperArcId(ni);
-                const SuperArc *curSA = getSuperArc(curSaId);
-                // Ignore hidden / simplified arc
-                if(!curSA->isVisible())
-                  continue;
-                const idNode &neigh = curSA->getUpNodeId();
-
-                // fix
-                if(neigh == n)
-                  continue;
-
-                // std::cout << "visit neighbor : " << ni << " which is " <<
-                // getNode(neigh)->getVertexId() << std::endl;
-
-                ExtendedUnionFind *neighUF = vect_SplitUF[neigh]->find();
-
-                if(isHigher(neighUF->getOrigin(), further)) {
-                  further = neighUF->getOrigin();
-                  furtherI = ni;
+                    if(ni != furtherI) { // keep the more persitent pair
+                      addPair<scalarType>(
+                        pairsJT, neighUF->getOrigin(), v, true);
+                      pendingMinMax.erase(neighUF->getOrigin());
+
+                      // std::cout << " jt make pair : " <<
+                      // neighUF->getOrigin() << " - " << v <<
+                      // std::endl;
+                    }
+
+                    ExtendedUnionFind::makeUnion(merge, neighUF)
+                      ->setOrigin(further);
+                  }
                 }
-              }
 
-              if(nbUp > 1) {
-                // close finsh pair and make union
-                for(idSuperArc ni = 0; ni < nbUp; ++ni) {
+                merge->find()->setOrigin(further);
+                vect_JoinUF[n] = merge->find();
+
+                if(!nbUp) {
+                  // potential close of the component
+                  // std::cout << "pending for " << further << " is " << v <<
+                  // std::endl;
+                  pendingMinMax[further] = v;
+                }
+              }
+            } // end for each node
+
+            // Add the pending biggest pair of each component
+            for(const auto &pair_vert : pendingMinMax) {
+              if(isCorrespondingNode(pair_vert.second)) {
+                // std::cout << " add : " << pair_vert.first << " - " <<
+                // pair_vert.second << std::endl;
+                addPair<scalarType>(
+                  pairsJT, pair_vert.first, pair_vert.second, true);
+              }
+            }
+          }); // end para section
+
+          sections.spawn([&]() {
+            pairsST.reserve(treeData_.leaves.size());
+            // For the biggest pair of the component
+            std::map<SimplexId, SimplexId> pendingMinMax;
+
+            for(auto it = sortedNodes.crbegin(); it != sortedNodes.crend();
+                ++it) {
+              const idNode &n = *it;
+              const SimplexId &v = getNode(n)->getVertexId();
+
+              const auto &nbUp = getNode(n)->getNumberOfUpSuperArcs();
+              const auto &nbDown = getNode(n)->getNumberOfDownSuperArcs();
+
+              if(nbUp == 0) {
+                // leaf
+                vect_SplitUF[n]
+                  = new ExtendedUnionFind(getNode(n)->getVertexId());
+                vect_SplitUF[n]->setOrigin(v);
+                // std::cout << " st origin : " << v << std::endl;
+              } else {
+                // first descendant
+                const idSuperArc firstSaId = getNode(n)->getUpSuperArcId(0);
+                const SuperArc *firstSA = getSuperArc(firstSaId);
+                const idNode &firstChildNodeId = firstSA->getUpNodeId();
+
+                ExtendedUnionFind *merge
+                  = vect_SplitUF[firstChildNodeId]->find();
+                SimplexId further = merge->getOrigin();
+                idSuperArc furtherI = 0;
+
+                for(idSuperArc ni = 1; ni < nbUp; ++ni) {
+                  // find the more persistant way
                   const idSuperArc curSaId = getNode(n)->getUpSuperArcId(ni);
                   const SuperArc *curSA = getSuperArc(curSaId);
+                  // Ignore hidden / simplified arc
+                  if(!curSA->isVisible())
+                    continue;
                   const idNode &neigh = curSA->getUpNodeId();
 
                   // fix
                   if(neigh == n)
                     continue;
 
+                  // std::cout << "visit neighbor : " << ni << " which is " <<
+                  // getNode(neigh)->getVertexId() << std::endl;
+
                   ExtendedUnionFind *neighUF = vect_SplitUF[neigh]->find();
 
-                  if(ni != furtherI) {
-                    addPair<scalarType>(
-                      pairsST, neighUF->getOrigin(), v, false);
+                  if(isHigher(neighUF->getOrigin(), further)) {
+                    further = neighUF->getOrigin();
+                    furtherI = ni;
+                  }
+                }
 
-                    pendingMinMax.erase(neighUF->getOrigin());
+                if(nbUp > 1) {
+                  // close finsh pair and make union
+                  for(idSuperArc ni = 0; ni < nbUp; ++ni) {
+                    const idSuperArc curSaId = getNode(n)->getUpSuperArcId(ni);
+                    const SuperArc *curSA = getSuperArc(curSaId);
+                    const idNode &neigh = curSA->getUpNodeId();
 
-                    // std::cout << " st make pair : " <<
-                    // neighUF->getOrigin() << " - " << v
-                    //<< " for neighbor " <<
-                    // getNode(neigh)->getVertexId() << std::endl;
-                  }
+                    // fix
+                    if(neigh == n)
+                      continue;
+
+                    ExtendedUnionFind *neighUF = vect_SplitUF[neigh]->find();
 
-                  ExtendedUnionFind::makeUnion(merge, neighUF)
-                    ->setOrigin(further);
-                  // Re-visit after merge lead to add the most persistant
-                  // pair....
+                    if(ni != furtherI) {
+                      addPair<scalarType>(
+                        pairsST, neighUF->getOrigin(), v, false);
+
+                      pendingMinMax.erase(neighUF->getOrigin());
+
+                      // std::cout << " st make pair : " <<
+                      // neighUF->getOrigin() << " - " << v
+                      //<< " for neighbor " <<
+                      // getNode(neigh)->getVertexId() << std::endl;
+                    }
+
+                    ExtendedUnionFind::makeUnion(merge, neighUF)
+                      ->setOrigin(further);
+                    // Re-visit after merge lead to add the most persistant
+                    // pair....
+                  }
                 }
-              }
-              merge->find()->setOrigin(further);
-              vect_SplitUF[n] = merge->find();
+                merge->find()->setOrigin(further);
+                vect_SplitUF[n] = merge->find();
 
-              if(!nbDown) {
-                pendingMinMax[further] = v;
-              }
+                if(!nbDown) {
+                  pendingMinMax[further] = v;
+                }
 
-            } // end nbUp == 0 else
-          } // end for each node
+              } // end nbUp == 0 else
+            } // end for each node
 
-          // Add the pending biggest pair of each component
-          for(const auto &pair_vert : pendingMinMax) {
-            addPair<scalarType>(
-              pairsST, pair_vert.first, pair_vert.second, false);
-          }
-        } // end para section
-      } // end para
+            // Add the pending biggest pair of each component
+            for(const auto &pair_vert : pendingMinMax) {
+              addPair<scalarType>(
+                pairsST, pair_vert.first, pair_vert.second, false);
+            }
+          }); // end para section
+          sections.wait();
+        },
+        2);
     }
 
     // }
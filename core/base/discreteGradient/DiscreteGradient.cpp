@@ -1,9 +1,124 @@
 #include <DiscreteGradient.h>
 
+#include <cstdint>
+#include <cstring>
+
 using namespace std;
 using namespace ttk;
 using namespace dcg;
 
+namespace {
+  // layout of the gradient files (see PackedGradient::writeToFile()): a
+  // header, the numberOfDimensions + 1 offsets of the dimensions, the
+  // (index, cofacet) pairs of the large cofacets, then the codes of all the
+  // cells. Native byte order.
+  const char gradientFileMagic[8] = "TTKDGRD";
+  const uint32_t gradientFileVersion = 1;
+
+  struct GradientFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t simplexIdSize;
+    uint64_t dimensionNumber;
+    uint64_t largeCofacetNumber;
+  };
+} // namespace
+
+int PackedGradient::writeToFile(const string &fileName) const {
+
+  if(offsets_.empty())
+    return -1;
+
+  GradientFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, gradientFileMagic, sizeof(gradientFileMagic));
+  header.version = gradientFileVersion;
+  header.simplexIdSize = sizeof(SimplexId);
+  header.dimensionNumber = offsets_.size() - 1;
+  header.largeCofacetNumber = largeCofacets_.size();
+
+  ofstream file(fileName.data(), ios::out | ios::binary);
+  if(!file)
+    return -2;
+
+  file.write((const char *)&header, sizeof(header));
+  for(const size_t offset : offsets_) {
+    const uint64_t value = offset;
+    file.write((const char *)&value, sizeof(value));
+  }
+  for(const auto &largeCofacet : largeCofacets_) {
+    const uint64_t entry[2]
+      = {largeCofacet.first, (uint64_t)largeCofacet.second};
+    file.write((const char *)entry, sizeof(entry));
+  }
+  file.write((const char *)data_, offsets_.back());
+
+  if(!file)
+    return -3;
+
+  return 0;
+}
+
+int PackedGradient::readFromFile(const string &fileName) {
+
+  shared_ptr<MappedFile> file = make_shared<MappedFile>();
+  if(file->open(fileName))
+    return -1;
+
+  const char *fileData = file->data();
+  const uint64_t fileSize = file->size();
+
+  GradientFileHeader header;
+  if(fileSize < sizeof(header))
+    return -2;
+  memcpy(&header, fileData, sizeof(header));
+
+  if((memcmp(header.magic, gradientFileMagic, sizeof(gradientFileMagic)))
+     || (header.version != gradientFileVersion)
+     || (header.simplexIdSize != sizeof(SimplexId)))
+    return -3;
+
+  // check the whole layout before modifying the gradient
+  if((header.dimensionNumber > 4) || (header.largeCofacetNumber > fileSize))
+    return -4;
+
+  vector<uint64_t> offsets(header.dimensionNumber + 1);
+  const uint64_t offsetsSize = offsets.size() * sizeof(uint64_t);
+  const uint64_t largeCofacetsSize
+    = header.largeCofacetNumber * 2 * sizeof(uint64_t);
+  if(sizeof(header) + offsetsSize + largeCofacetsSize > fileSize)
+    return -4;
+  memcpy(offsets.data(), fileData + sizeof(header), offsetsSize);
+
+  const uint64_t codesPosition
+    = sizeof(header) + offsetsSize + largeCofacetsSize;
+  if((offsets[0] != 0) || (offsets.back() != fileSize - codesPosition))
+    return -4;
+  for(size_t i = 1; i < offsets.size(); ++i) {
+    if(offsets[i] < offsets[i - 1])
+      return -4;
+  }
+
+  unordered_map<size_t, SimplexId> largeCofacets;
+  const char *entries = fileData + sizeof(header) + offsetsSize;
+  for(uint64_t i = 0; i < header.largeCofacetNumber; ++i) {
+    uint64_t entry[2];
+    memcpy(entry, entries + i * sizeof(entry), sizeof(entry));
+    if(entry[0] >= offsets.back())
+      return -4;
+    largeCofacets[entry[0]] = (SimplexId)entry[1];
+  }
+
+  offsets_.assign(offsets.begin(), offsets.end());
+  largeCofacets_.swap(largeCofacets);
+  codes_.clear();
+  codes_.shrink_to_fit();
+  data_ = (const unsigned char *)fileData + codesPosition;
+  file_ = file;
+
+  return 0;
+}
+
 DiscreteGradient::DiscreteGradient()
   : IterationThreshold{-1}, ReverseSaddleMaximumConnection{false},
     ReverseSaddleSaddleConnection{false}, CollectPersistencePairs{false},
@@ -12,7 +127,7 @@ DiscreteGradient::DiscreteGradient()
     dimensionality_{-1}, numberOfVertices_{0}, gradient_{}, dmtMax2PL_{},
 
     inputScalarField_{nullptr}, inputOffsets_{nullptr},
-    inputTriangulation_{nullptr},
+    inputModificationTime_{0}, inputTriangulation_{nullptr},
 
     outputCriticalPoints_numberOfPoints_{nullptr},
     outputCriticalPoints_points_{nullptr},
@@ -36,6 +151,79 @@ DiscreteGradient::DiscreteGradient()
 DiscreteGradient::~DiscreteGradient() {
 }
 
+int DiscreteGradient::getMemoryReport(MemoryReport &report) const {
+
+  const string component = "DiscreteGradient";
+
+  report.add(component, "gradient_", gradient_.footprint());
+  report.add(component, "dmtMax2PL_", MemoryReport::bytes(dmtMax2PL_));
+  report.add(
+    component, "dmt1Saddle2PL_", MemoryReport::bytes(dmt1Saddle2PL_));
+  report.add(
+    component, "dmt2Saddle2PL_", MemoryReport::bytes(dmt2Saddle2PL_));
+
+  return 0;
+}
+
+int DiscreteGradient::writeGradientToFile(const string &fileName) const {
+
+  const int ret = gradient_.writeToFile(fileName);
+  if(ret) {
+    stringstream msg;
+    msg << "[DiscreteGradient] Could not write gradient file `" << fileName
+        << "'." << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+  }
+
+  return ret;
+}
+
+int DiscreteGradient::readGradientFromFile(const string &fileName) {
+
+  Timer t;
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!inputTriangulation_)
+    return -1;
+#endif
+
+  PackedGradient gradient;
+  if(gradient.readFromFile(fileName)) {
+    stringstream msg;
+    msg << "[DiscreteGradient] Could not map gradient file `" << fileName
+        << "'." << endl;
+    dMsg(cerr, msg.str(), detailedInfoMsg);
+    return -2;
+  }
+
+  const int numberOfDimensions = getNumberOfDimensions();
+  bool isCompatible = (gradient.getNumberOfDimensions() == numberOfDimensions);
+  for(int i = 0; isCompatible and i < numberOfDimensions; ++i)
+    isCompatible = (gradient.getNumberOfCells(i) == getNumberOfCells(i));
+
+  if(!isCompatible) {
+    stringstream msg;
+    msg << "[DiscreteGradient] Gradient file `" << fileName
+        << "' was written for another triangulation." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -3;
+  }
+
+  dmtMax2PL_.clear();
+  dmt1Saddle2PL_.clear();
+  dmt2Saddle2PL_.clear();
+  gradient_ = gradient;
+
+  {
+    stringstream msg;
+    msg << "[DiscreteGradient] Gradient file `" << fileName << "' mapped in "
+        << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 int DiscreteGradient::getDimensionality() const {
   return dimensionality_;
 }
@@ -84,76 +272,38 @@ SimplexId DiscreteGradient::getNumberOfCells(const int dimension) const {
 
 bool DiscreteGradient::isMinimum(const Cell &cell) const {
   if(cell.dim_ == 0)
-    return (gradient_[0][0][cell.id_] == -1);
+    return gradient_.isCritical(0, cell.id_);
 
   return false;
 }
 
 bool DiscreteGradient::isSaddle1(const Cell &cell) const {
   if(cell.dim_ == 1)
-    return (gradient_[0][1][cell.id_] == -1
-            and gradient_[1][1][cell.id_] == -1);
+    return gradient_.isCritical(1, cell.id_);
 
   return false;
 }
 
 bool DiscreteGradient::isSaddle2(const Cell &cell) const {
   if(dimensionality_ == 3 and cell.dim_ == 2)
-    return (gradient_[1][2][cell.id_] == -1
-            and gradient_[2][2][cell.id_] == -1);
+    return gradient_.isCritical(2, cell.id_);
 
   return false;
 }
 
 bool DiscreteGradient::isMaximum(const Cell &cell) const {
-  if(dimensionality_ == 2 and cell.dim_ == 2)
-    return (gradient_[1][2][cell.id_] == -1);
-
-  if(dimensionality_ == 3 and cell.dim_ == 3)
-    return (gradient_[2][3][cell.id_] == -1);
+  if(cell.dim_ == dimensionality_)
+    return gradient_.isCritical(cell.dim_, cell.id_);
 
   return false;
 }
 
 bool DiscreteGradient::isCellCritical(const int cellDim,
                                       const SimplexId cellId) const {
-  if(dimensionality_ == 2) {
-    switch(cellDim) {
-      case 0:
-        return (gradient_[0][0][cellId] == -1);
-        break;
-
-      case 1:
-        return (gradient_[0][1][cellId] == -1
-                and gradient_[1][1][cellId] == -1);
-        break;
-
-      case 2:
-        return (gradient_[1][2][cellId] == -1);
-        break;
-    }
-  } else if(dimensionality_ == 3) {
-    switch(cellDim) {
-      case 0:
-        return (gradient_[0][0][cellId] == -1);
-        break;
+  if(cellDim < 0 or cellDim > dimensionality_)
+    return false;
 
-      case 1:
-        return (gradient_[0][1][cellId] == -1
-                and gradient_[1][1][cellId] == -1);
-        break;
-
-      case 2:
-        return (gradient_[1][2][cellId] == -1
-                and gradient_[2][2][cellId] == -1);
-        break;
-
-      case 3:
-        return (gradient_[2][3][cellId] == -1);
-        break;
-    }
-  }
-  return false;
+  return gradient_.isCritical(cellDim, cellId);
 }
 
 bool DiscreteGradient::isCellCritical(const Cell &cell) const {
@@ -205,111 +355,218 @@ bool DiscreteGradient::isBoundary(const Cell &cell) const {
   return false;
 }
 
-SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
-                                          bool isReverse) const {
+SimplexId DiscreteGradient::getCellVertex(const Cell &cell,
+                                          const SimplexId localId) const {
   SimplexId id{-1};
-  if(dimensionality_ == 2) {
-    switch(cell.dim_) {
-      case 0:
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getVertexEdge(
-          cell.id_, gradient_[0][0][cell.id_], id);
-#else
-        return gradient_[0][0][cell.id_];
-#endif
-        break;
 
-      case 1:
-        if(isReverse) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getEdgeVertex(
-            cell.id_, gradient_[0][1][cell.id_], id);
-          return id;
-#else
-          return gradient_[0][1][cell.id_];
-#endif
-        }
+  if(cell.dim_ == 0)
+    id = cell.id_;
+  else if(cell.dim_ == 1)
+    inputTriangulation_->getEdgeVertex(cell.id_, localId, id);
+  else if(cell.dim_ == dimensionality_)
+    inputTriangulation_->getCellVertex(cell.id_, localId, id);
+  else if(cell.dim_ == 2)
+    inputTriangulation_->getTriangleVertex(cell.id_, localId, id);
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getEdgeStar(
-          cell.id_, gradient_[1][1][cell.id_], id);
-#else
-        return gradient_[1][1][cell.id_];
-#endif
-        break;
+  return id;
+}
 
-      case 2:
-        if(isReverse) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getCellEdge(
-            cell.id_, gradient_[1][2][cell.id_], id);
-          return id;
-#else
-          return gradient_[1][2][cell.id_];
-#endif
-        }
-        break;
+SimplexId DiscreteGradient::getCellCofacetNumber(const Cell &cell) const {
+  if(cell.dim_ == 0)
+    return inputTriangulation_->getVertexEdgeNumber(cell.id_);
+  else if(cell.dim_ == dimensionality_ - 1)
+    return (cell.dim_ == 1)
+             ? inputTriangulation_->getEdgeStarNumber(cell.id_)
+             : inputTriangulation_->getTriangleStarNumber(cell.id_);
+  else if(cell.dim_ == 1)
+    return inputTriangulation_->getEdgeTriangleNumber(cell.id_);
+
+  return 0;
+}
+
+SimplexId DiscreteGradient::getCellCofacet(const Cell &cell,
+                                           const SimplexId localId) const {
+  SimplexId id{-1};
+
+  if(cell.dim_ == 0)
+    inputTriangulation_->getVertexEdge(cell.id_, localId, id);
+  else if(cell.dim_ == dimensionality_ - 1) {
+    if(cell.dim_ == 1)
+      inputTriangulation_->getEdgeStar(cell.id_, localId, id);
+    else
+      inputTriangulation_->getTriangleStar(cell.id_, localId, id);
+  } else if(cell.dim_ == 1)
+    inputTriangulation_->getEdgeTriangle(cell.id_, localId, id);
+
+  return id;
+}
+
+SimplexId DiscreteGradient::getCellFacet(const Cell &cell,
+                                         const SimplexId localId) const {
+  SimplexId id{-1};
+
+  if(cell.dim_ == 1)
+    inputTriangulation_->getEdgeVertex(cell.id_, localId, id);
+  else if(cell.dim_ == dimensionality_) {
+    if(cell.dim_ == 2)
+      inputTriangulation_->getCellEdge(cell.id_, localId, id);
+    else
+      inputTriangulation_->getCellTriangle(cell.id_, localId, id);
+  } else if(cell.dim_ == 2)
+    inputTriangulation_->getTriangleEdge(cell.id_, localId, id);
+
+  return id;
+}
+
+int DiscreteGradient::getGridStencils(
+  const int alphaDim,
+  const SimplexId dimensions[3],
+  vector<GridStencil> &stencils) const {
+  stencils.clear();
+
+  // central vertex of the grid: the cells around it and their stars are
+  // away from the boundary
+  SimplexId referenceVertex = 0;
+  SimplexId shift = 1;
+  for(int k = 0; k < 3; ++k) {
+    if(dimensions[k] > 1) {
+      if(dimensions[k] < 5)
+        return -1;
+      referenceVertex += (dimensions[k] / 2) * shift;
     }
-  } else if(dimensionality_ == 3) {
-    switch(cell.dim_) {
-      case 0:
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getVertexEdge(
-          cell.id_, gradient_[0][0][cell.id_], id);
-#else
-        return gradient_[0][0][cell.id_];
-#endif
-        break;
+    shift *= dimensions[k];
+  }
 
-      case 1:
-        if(isReverse) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getEdgeVertex(
-            cell.id_, gradient_[0][1][cell.id_], id);
-          return id;
-#else
-          return gradient_[0][1][cell.id_];
-#endif
-        }
+  // one cell of each type has the reference vertex as a vertex
+  vector<SimplexId> cells;
+  if(alphaDim == 0) {
+    cells.push_back(referenceVertex);
+  } else if(alphaDim == 1) {
+    const SimplexId edgeNumber
+      = inputTriangulation_->getVertexEdgeNumber(referenceVertex);
+    cells.resize(edgeNumber);
+    for(SimplexId i = 0; i < edgeNumber; ++i)
+      inputTriangulation_->getVertexEdge(referenceVertex, i, cells[i]);
+  } else if(alphaDim == 2 and dimensionality_ == 3) {
+    const SimplexId triangleNumber
+      = inputTriangulation_->getVertexTriangleNumber(referenceVertex);
+    cells.resize(triangleNumber);
+    for(SimplexId i = 0; i < triangleNumber; ++i)
+      inputTriangulation_->getVertexTriangle(referenceVertex, i, cells[i]);
+  } else {
+    return -2;
+  }
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getEdgeTriangle(
-          cell.id_, gradient_[1][1][cell.id_], id);
-#else
-        return gradient_[1][1][cell.id_];
-#endif
-        break;
+  for(const SimplexId alpha : cells) {
+    const Cell cell{alphaDim, alpha};
 
-      case 2:
-        if(isReverse) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getTriangleEdge(
-            cell.id_, gradient_[1][2][cell.id_], id);
-          return id;
-#else
-          return gradient_[1][2][cell.id_];
-#endif
-        }
+    SimplexId vertices[3]{};
+    for(int i = 0; i <= alphaDim; ++i)
+      vertices[i] = getCellVertex(cell, i);
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getTriangleStar(
-          cell.id_, gradient_[2][2][cell.id_], id);
-#else
-        return gradient_[2][2][cell.id_];
-#endif
-        break;
+    bool isKnown = false;
+    for(const auto &stencil : stencils)
+      isKnown = isKnown or stencil.matches(alphaDim, vertices);
+    if(isKnown)
+      continue;
 
-      case 3:
-        if(isReverse) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getCellTriangle(
-            cell.id_, gradient_[2][3][cell.id_], id);
-          return id;
-#else
-          return gradient_[2][3][cell.id_];
-#endif
+    GridStencil stencil{};
+    for(int i = 0; i < alphaDim; ++i)
+      stencil.vertexOffsets[i] = vertices[i + 1] - vertices[0];
+
+    const SimplexId cofacetNumber = getCellCofacetNumber(cell);
+    for(SimplexId k = 0; k < cofacetNumber; ++k) {
+      const Cell cofacet{alphaDim + 1, getCellCofacet(cell, k)};
+
+      for(int i = 0; i <= alphaDim + 1; ++i) {
+        const SimplexId vertexId = getCellVertex(cofacet, i);
+        if(find(vertices, vertices + alphaDim + 1, vertexId)
+           == vertices + alphaDim + 1)
+          stencil.cofacetOffsets.push_back(vertexId - vertices[0]);
+      }
+
+      for(int i = 0; i <= alphaDim + 1; ++i) {
+        if(getCellFacet(cofacet, i) == alpha) {
+          stencil.facetIds.push_back(i);
+          break;
         }
-        break;
+      }
+    }
+
+    if((SimplexId)stencil.cofacetOffsets.size() != cofacetNumber
+       or (SimplexId)stencil.facetIds.size() != cofacetNumber)
+      return -3;
+
+    stencils.push_back(stencil);
+  }
+
+  return 0;
+}
+
+SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
+                                          bool isReverse) const {
+  SimplexId id{-1};
+
+  // a vertex is paired with an edge whatever the direction
+  if(isReverse and cell.dim_ > 0) {
+    const SimplexId facet = gradient_.getFacet(cell.dim_, cell.id_);
+    if(facet == -1)
+      return -1;
+
+    if(dimensionality_ == 2) {
+      switch(cell.dim_) {
+        case 1:
+          inputTriangulation_->getEdgeVertex(cell.id_, facet, id);
+          break;
+
+        case 2:
+          inputTriangulation_->getCellEdge(cell.id_, facet, id);
+          break;
+      }
+    } else if(dimensionality_ == 3) {
+      switch(cell.dim_) {
+        case 1:
+          inputTriangulation_->getEdgeVertex(cell.id_, facet, id);
+          break;
+
+        case 2:
+          inputTriangulation_->getTriangleEdge(cell.id_, facet, id);
+          break;
+
+        case 3:
+          inputTriangulation_->getCellTriangle(cell.id_, facet, id);
+          break;
+      }
+    }
+  } else {
+    const SimplexId cofacet = gradient_.getCofacet(cell.dim_, cell.id_);
+    if(cofacet == -1)
+      return -1;
+
+    if(dimensionality_ == 2) {
+      switch(cell.dim_) {
+        case 0:
+          inputTriangulation_->getVertexEdge(cell.id_, cofacet, id);
+          break;
+
+        case 1:
+          inputTriangulation_->getEdgeStar(cell.id_, cofacet, id);
+          break;
+      }
+    } else if(dimensionality_ == 3) {
+      switch(cell.dim_) {
+        case 0:
+          inputTriangulation_->getVertexEdge(cell.id_, cofacet, id);
+          break;
+
+        case 1:
+          inputTriangulation_->getEdgeTriangle(cell.id_, cofacet, id);
+          break;
+
+        case 2:
+          inputTriangulation_->getTriangleStar(cell.id_, cofacet, id);
+          break;
+      }
     }
   }
 
@@ -811,6 +1068,8 @@ int DiscreteGradient::getAscendingWall(const wallId_t wallId,
 }
 
 int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
+  gradient_.detach();
+
   if(dimensionality_ == 2) {
     // assume that the first cell is an edge
     const SimplexId numberOfCellsInPath = vpath.size();
@@ -818,12 +1077,11 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
       const SimplexId edgeId = vpath[i].id_;
       const SimplexId triangleId = vpath[i + 1].id_;
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
         inputTriangulation_->getCellEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[1][2][triangleId] = k;
+          gradient_.setFacet(2, triangleId, k);
           break;
         }
       }
@@ -831,14 +1089,10 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
         SimplexId tmp;
         inputTriangulation_->getEdgeStar(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[1][1][edgeId] = k;
+          gradient_.setCofacet(1, edgeId, k);
           break;
         }
       }
-#else
-      gradient_[1][2][triangleId] = edgeId;
-      gradient_[1][1][edgeId] = triangleId;
-#endif
     }
   } else if(dimensionality_ == 3) {
     // assume that the first cell is a triangle
@@ -847,12 +1101,11 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
       const SimplexId triangleId = vpath[i].id_;
       const SimplexId tetraId = vpath[i + 1].id_;
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 4; ++k) {
         SimplexId tmp;
         inputTriangulation_->getCellTriangle(tetraId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[2][3][tetraId] = k;
+          gradient_.setFacet(3, tetraId, k);
           break;
         }
       }
@@ -861,14 +1114,10 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
         SimplexId tmp;
         inputTriangulation_->getTriangleStar(triangleId, k, tmp);
         if(tmp == tetraId) {
-          gradient_[2][2][triangleId] = k;
+          gradient_.setCofacet(2, triangleId, k);
           break;
         }
       }
-#else
-      gradient_[2][3][tetraId] = triangleId;
-      gradient_[2][2][triangleId] = tetraId;
-#endif
     }
   }
 
@@ -876,6 +1125,8 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
 }
 
 int DiscreteGradient::reverseAscendingPathOnWall(const vector<Cell> &vpath) {
+  gradient_.detach();
+
   if(dimensionality_ == 3) {
     // assume that the first cell is an edge
     const SimplexId numberOfCellsInPath = vpath.size();
@@ -883,12 +1134,11 @@ int DiscreteGradient::reverseAscendingPathOnWall(const vector<Cell> &vpath) {
       const SimplexId edgeId = vpath[i].id_;
       const SimplexId triangleId = vpath[i + 1].id_;
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
         inputTriangulation_->getTriangleEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[1][2][triangleId] = k;
+          gradient_.setFacet(2, triangleId, k);
           break;
         }
       }
@@ -897,14 +1147,10 @@ int DiscreteGradient::reverseAscendingPathOnWall(const vector<Cell> &vpath) {
         SimplexId tmp;
         inputTriangulation_->getEdgeTriangle(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[1][1][edgeId] = k;
+          gradient_.setCofacet(1, edgeId, k);
           break;
         }
       }
-#else
-      gradient_[1][2][triangleId] = edgeId;
-      gradient_[1][1][edgeId] = triangleId;
-#endif
     }
   }
 
@@ -912,6 +1158,8 @@ int DiscreteGradient::reverseAscendingPathOnWall(const vector<Cell> &vpath) {
 }
 
 int DiscreteGradient::reverseDescendingPathOnWall(const vector<Cell> &vpath) {
+  gradient_.detach();
+
   if(dimensionality_ == 3) {
     // assume that the first cell is a triangle
     const SimplexId numberOfCellsInPath = vpath.size();
@@ -919,12 +1167,11 @@ int DiscreteGradient::reverseDescendingPathOnWall(const vector<Cell> &vpath) {
       const SimplexId triangleId = vpath[i].id_;
       const SimplexId edgeId = vpath[i + 1].id_;
 
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
         inputTriangulation_->getTriangleEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[1][2][triangleId] = k;
+          gradient_.setFacet(2, triangleId, k);
           break;
         }
       }
@@ -933,14 +1180,10 @@ int DiscreteGradient::reverseDescendingPathOnWall(const vector<Cell> &vpath) {
         SimplexId tmp;
         inputTriangulation_->getEdgeTriangle(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[1][1][edgeId] = k;
+          gradient_.setCofacet(1, edgeId, k);
           break;
         }
       }
-#else
-      gradient_[1][1][edgeId] = triangleId;
-      gradient_[1][2][triangleId] = edgeId;
-#endif
     }
   }
 
@@ -22,7 +22,11 @@
 #include <Wrapper.h>
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 namespace ttk {
   namespace dcg {
@@ -324,6 +328,207 @@ namespace ttk {
       };
     };
 
+    /**
+     * Flat storage of a discrete gradient. A cell is paired with at most one
+     * of its facets or cofacets: a single byte per cell, all dimensions
+     * stored contiguously, encodes the local index of that facet (in the
+     * facets of the cell) or cofacet (in the cofacets of the cell), 0 meaning
+     * that the cell is critical. The few cofacet indices which do not fit in
+     * that byte (cells with more than 250 cofacets) are stored aside. The
+     * codes are bytes rather than a few bits: the cofacet indices of edges
+     * and vertices are unbounded, and the parallel loops write the codes of
+     * neighbouring cells without atomic operations.
+     *
+     * The codes can be saved to a file and mapped back from it (see
+     * writeToFile() and readFromFile()). A mapped gradient is read-only
+     * until detach() copies its codes into memory.
+     */
+    class PackedGradient {
+    public:
+      PackedGradient() : data_{nullptr} {
+      }
+
+      PackedGradient(const PackedGradient &gradient)
+        : codes_{gradient.codes_}, offsets_{gradient.offsets_},
+          largeCofacets_{gradient.largeCofacets_}, file_{gradient.file_} {
+        data_ = file_ ? gradient.data_ : codes_.data();
+      }
+
+      PackedGradient &operator=(const PackedGradient &gradient) {
+        codes_ = gradient.codes_;
+        offsets_ = gradient.offsets_;
+        largeCofacets_ = gradient.largeCofacets_;
+        file_ = gradient.file_;
+        data_ = file_ ? gradient.data_ : codes_.data();
+        return *this;
+      }
+
+      /**
+       * Allocate \p numberOfCells[i] critical cells of dimension i.
+       */
+      void resize(const std::vector<SimplexId> &numberOfCells) {
+        offsets_.resize(numberOfCells.size() + 1);
+        offsets_[0] = 0;
+        for(size_t i = 0; i < numberOfCells.size(); ++i)
+          offsets_[i + 1] = offsets_[i] + numberOfCells[i];
+        file_.reset();
+        codes_.assign(offsets_.back(), criticalCode);
+        data_ = codes_.data();
+        largeCofacets_.clear();
+      }
+
+      /**
+       * Copy the codes of a mapped gradient into memory, so that the
+       * gradient can be modified. Nothing is done otherwise.
+       */
+      void detach() {
+        if(!file_)
+          return;
+        codes_.assign(data_, data_ + offsets_.back());
+        data_ = codes_.data();
+        file_.reset();
+      }
+
+      /**
+       * Return true if the codes are read from a mapped file.
+       */
+      inline bool isMapped() const {
+        return file_ != nullptr;
+      }
+
+      /**
+       * Number of cells of dimension \p dim.
+       */
+      inline SimplexId getNumberOfCells(const int dim) const {
+        return offsets_[dim + 1] - offsets_[dim];
+      }
+
+      /**
+       * Number of dimensions of the cells.
+       */
+      inline int getNumberOfDimensions() const {
+        return offsets_.empty() ? 0 : (int)offsets_.size() - 1;
+      }
+
+      inline bool isCritical(const int dim, const SimplexId id) const {
+        return data_[offsets_[dim] + id] == criticalCode;
+      }
+
+      /**
+       * Local index of the facet paired with the cell, -1 if none.
+       */
+      inline SimplexId getFacet(const int dim, const SimplexId id) const {
+        const unsigned char code = data_[offsets_[dim] + id];
+        if(code == criticalCode or code >= firstCofacetCode)
+          return -1;
+        return code - firstFacetCode;
+      }
+
+      /**
+       * Local index of the cofacet paired with the cell, -1 if none.
+       */
+      inline SimplexId getCofacet(const int dim, const SimplexId id) const {
+        const size_t index = offsets_[dim] + id;
+        const unsigned char code = data_[index];
+        if(code < firstCofacetCode)
+          return -1;
+        if(code == largeCofacetCode) {
+          // the parallel loops may insert into the map meanwhile
+          std::lock_guard<std::mutex> lock(largeCofacetsMutex_);
+          return largeCofacets_.at(index);
+        }
+        return code - firstCofacetCode;
+      }
+
+      inline void
+        setFacet(const int dim, const SimplexId id, const SimplexId facet) {
+        codes_[offsets_[dim] + id] = firstFacetCode + facet;
+      }
+
+      inline void
+        setCofacet(const int dim, const SimplexId id, const SimplexId cofacet) {
+        const size_t index = offsets_[dim] + id;
+        if(cofacet < largeCofacetCode - firstCofacetCode) {
+          codes_[index] = firstCofacetCode + cofacet;
+        } else {
+          std::lock_guard<std::mutex> lock(largeCofacetsMutex_);
+          largeCofacets_[index] = cofacet;
+          codes_[index] = largeCofacetCode;
+        }
+      }
+
+      /**
+       * Save the gradient to the file \p fileName.
+       * \return Returns 0 upon success, negative values otherwise.
+       */
+      int writeToFile(const std::string &fileName) const;
+
+      /**
+       * Map the gradient saved in the file \p fileName. The codes are read
+       * from the mapping, which is shared by the copies of the gradient.
+       * \return Returns 0 upon success, negative values otherwise (the
+       * gradient is then left unchanged).
+       */
+      int readFromFile(const std::string &fileName);
+
+      /**
+       * Memory used by the gradient (in bytes), mapped codes excluded.
+       */
+      size_t footprint() const {
+        return codes_.capacity() + offsets_.capacity() * sizeof(size_t)
+               + largeCofacets_.size()
+                   * (sizeof(size_t) + sizeof(SimplexId) + sizeof(void *));
+      }
+
+    protected:
+      // a cell has at most 4 facets (tetrahedron)
+      enum : unsigned char {
+        criticalCode = 0,
+        firstFacetCode = 1,
+        firstCofacetCode = 5,
+        largeCofacetCode = 255
+      };
+
+      // codes of the cells, unused if the gradient is mapped
+      std::vector<unsigned char> codes_;
+      // index of the first cell of each dimension in the codes
+      std::vector<size_t> offsets_;
+      // cofacets too large for a code, by index of the cell
+      std::unordered_map<size_t, SimplexId> largeCofacets_;
+      // guards largeCofacets_ (not copied with the gradient)
+      mutable std::mutex largeCofacetsMutex_;
+      // mapped file holding the codes (if any)
+      std::shared_ptr<MappedFile> file_;
+      // codes read by the getters, in codes_ or in the mapped file
+      const unsigned char *data_;
+    };
+
+    /**
+     * Star of the interior cells of a given type of a regular grid. The
+     * cells of a regular grid are translates of a few reference cells: the
+     * star of an interior cell is described once for all by vertex
+     * identifier offsets relative to the first vertex of the cell.
+     */
+    struct GridStencil {
+      /**
+       * Return true if the cell of dimension \p dim made of the given
+       * vertices has the type of the stencil.
+       */
+      inline bool matches(const int dim, const SimplexId vertices[3]) const {
+        for(int i = 0; i < dim; ++i)
+          if(vertices[i + 1] - vertices[0] != vertexOffsets[i])
+            return false;
+        return true;
+      }
+
+      // offsets of the other vertices of the cell
+      SimplexId vertexOffsets[2];
+      // offset of the vertex of the k-th cofacet which is not in the cell
+      std::vector<SimplexId> cofacetOffsets;
+      // local index of the cell in the facets of the k-th cofacet
+      std::vector<SimplexId> facetIds;
+    };
+
     /**
      * Compute and manage a discrete gradient of a function on a triangulation.
      * TTK assumes that the input dataset is made of only one connected
@@ -336,6 +541,8 @@ namespace ttk {
 
       ~DiscreteGradient();
 
+      int getMemoryReport(MemoryReport &report) const override;
+
       /**
        * Impose a threshold on the number of simplification passes.
        */
@@ -429,11 +636,7 @@ given dimension.
       int assignGradient(const int alphaDim,
                          const dataType *const scalars,
                          const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                         std::vector<std::vector<char>> &gradient) const;
-#else
-                         std::vector<std::vector<SimplexId>> &gradient) const;
-#endif
+                         PackedGradient &gradient) const;
 
       /**
        * Body of AssignGradient2 algorithm from "Parallel Computation of 3D
@@ -446,11 +649,7 @@ unpaired cells.
       int assignGradient2(const int alphaDim,
                           const dataType *const scalars,
                           const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                          std::vector<std::vector<char>> &gradient) const;
-#else
-                          std::vector<std::vector<SimplexId>> &gradient) const;
-#endif
+                          PackedGradient &gradient) const;
 
       /**
        * Brand new pass on the discrete gradient designed specifically for this
@@ -462,11 +661,33 @@ triangulation only).
       int assignGradient3(const int alphaDim,
                           const dataType *const scalars,
                           const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                          std::vector<std::vector<char>> &gradient) const;
-#else
-                          std::vector<std::vector<SimplexId>> &gradient) const;
-#endif
+                          PackedGradient &gradient) const;
+
+      /**
+       * Learn the stencils of the interior cells of dimension \p alphaDim of
+       * a regular grid of dimensions \p dimensions, from the cells around
+       * the central vertex of the grid (one stencil per cell type).
+       * \return Returns 0 upon success, negative values otherwise (grid too
+       * small to have such cells).
+       */
+      int getGridStencils(const int alphaDim,
+                          const SimplexId dimensions[3],
+                          std::vector<GridStencil> &stencils) const;
+
+      /**
+       * AssignGradient on a cell of a regular grid: if the cell lies in the
+       * interior of the grid, its lower star is read from its stencil and
+       * only the paired cofacet is queried from the triangulation.
+       * \return Returns false if the cell needs the generic code path.
+       */
+      template <typename dataType, typename idType>
+      bool assignGridGradient(const int alphaDim,
+                              const SimplexId alpha,
+                              const SimplexId dimensions[3],
+                              const std::vector<GridStencil> &stencils,
+                              const dataType *const scalars,
+                              const idType *const offsets,
+                              PackedGradient &gradient) const;
 
       /**
        * Compute the initial gradient field of the input scalar function on the
@@ -490,6 +711,20 @@ triangulation only).
       template <typename dataType, typename idType>
       int buildGradient3();
 
+      /**
+       * Save the gradient to the file \p fileName.
+       * \return Returns 0 upon success, negative values otherwise.
+       */
+      int writeGradientToFile(const std::string &fileName) const;
+
+      /**
+       * Map the gradient saved by writeGradientToFile() for the same
+       * triangulation, instead of building it. The gradient is copied into
+       * memory before being modified.
+       * \return Returns 0 upon success, negative values otherwise.
+       */
+      int readGradientFromFile(const std::string &fileName);
+
       /**
        * Get the list of maxima candidates for simplification.
        */
@@ -793,6 +1028,16 @@ according to them.
         return 0;
       }
 
+      /**
+       * Set the modification time of the scalar and offset fields. The
+       * contour tree built to filter the saddle connectors then shares its
+       * vertex order with the other modules (see ttk::VertexOrder).
+       */
+      inline int setInputModificationTime(const unsigned long long &time) {
+        inputModificationTime_ = time;
+        return 0;
+      }
+
       /**
        * Set the output data pointer to the critical points.
        */
@@ -899,6 +1144,26 @@ discrete gradient, false otherwise.
        */
       bool isBoundary(const Cell &cell) const;
 
+      /**
+       * Get the \p localId-th vertex of the given cell.
+       */
+      SimplexId getCellVertex(const Cell &cell, const SimplexId localId) const;
+
+      /**
+       * Get the number of cofacets of the given cell.
+       */
+      SimplexId getCellCofacetNumber(const Cell &cell) const;
+
+      /**
+       * Get the \p localId-th cofacet of the given cell.
+       */
+      SimplexId getCellCofacet(const Cell &cell, const SimplexId localId) const;
+
+      /**
+       * Get the \p localId-th facet of the given cell.
+       */
+      SimplexId getCellFacet(const Cell &cell, const SimplexId localId) const;
+
       /**
        * Return the identifier of the cell paired to the cell given by the user
 in the gradient.
@@ -1048,17 +1313,14 @@ tetra identifier.
 
       int dimensionality_;
       SimplexId numberOfVertices_;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-      std::vector<std::vector<std::vector<char>>> gradient_;
-#else
-      std::vector<std::vector<std::vector<SimplexId>>> gradient_;
-#endif
+      PackedGradient gradient_;
       std::vector<SimplexId> dmtMax2PL_;
       std::vector<SimplexId> dmt1Saddle2PL_;
       std::vector<SimplexId> dmt2Saddle2PL_;
 
       const void *inputScalarField_;
       const void *inputOffsets_;
+      unsigned long long inputModificationTime_;
       Triangulation *inputTriangulation_;
 
       SimplexId *outputCriticalPoints_numberOfPoints_;
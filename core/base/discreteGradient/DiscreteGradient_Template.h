@@ -182,13 +182,9 @@ int DiscreteGradient::assignGradient(
   const int alphaDim,
   const dataType *const scalars,
   const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
-#else
-  std::vector<std::vector<SimplexId>> &gradient) const {
-#endif
+  PackedGradient &gradient) const {
   const int betaDim = alphaDim + 1;
-  const SimplexId alphaNumber = gradient[alphaDim].size();
+  const SimplexId alphaNumber = getNumberOfCells(alphaDim);
 
   const auto sosLowerThan
     = [&scalars, &offsets](const SimplexId a, const SimplexId b) {
@@ -198,16 +194,26 @@ int DiscreteGradient::assignGradient(
           return offsets[a] < offsets[b];
       };
 
+  // interior cells of regular grids: lower stars read from stencils
+  SimplexId gridDimensions[3];
+  std::vector<GridStencil> stencils;
+  const bool isGrid
+    = (inputTriangulation_->getRegularGridDimensions(gridDimensions) == 0)
+      and (getGridStencils(alphaDim, gridDimensions, stencils) == 0);
+
   if(dimensionality_ == 2) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
     for(SimplexId alpha = 0; alpha < alphaNumber; ++alpha) {
+      if(isGrid
+         and assignGridGradient(alphaDim, alpha, gridDimensions, stencils,
+                                scalars, offsets, gradient))
+        continue;
+
       if(alphaDim == 0) {
         SimplexId minEdgeId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minEdgeLocalId{-1};
-#endif
+        SimplexId minEdgeLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId edgeNumber
           = inputTriangulation_->getVertexEdgeNumber(alpha);
@@ -223,24 +229,19 @@ int DiscreteGradient::assignGradient(
           if(sosLowerThan(vertexId, alpha)) {
             if(minVertexId == -1) {
               minEdgeId = edgeId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minEdgeLocalId = k;
-#endif
               minVertexId = vertexId;
             } else if(sosLowerThan(vertexId, minVertexId)) {
               minEdgeId = edgeId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minEdgeLocalId = k;
-#endif
               minVertexId = vertexId;
             }
           }
         }
         if(minEdgeId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minEdgeLocalId;
+          gradient.setCofacet(alphaDim, alpha, minEdgeLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
             inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
@@ -250,11 +251,7 @@ int DiscreteGradient::assignGradient(
             }
           }
 
-          gradient[betaDim][minEdgeId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minEdgeId;
-          gradient[betaDim][minEdgeId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minEdgeId, minAlphaLocalId);
         }
       } else if(alphaDim == 1) {
         SimplexId v0;
@@ -263,9 +260,7 @@ int DiscreteGradient::assignGradient(
         inputTriangulation_->getEdgeVertex(alpha, 1, v1);
 
         SimplexId minStarId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
-#endif
+        SimplexId minStarLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId starNumber
           = inputTriangulation_->getEdgeStarNumber(alpha);
@@ -283,24 +278,19 @@ int DiscreteGradient::assignGradient(
           if(sosLowerThan(vertexId, v0) and sosLowerThan(vertexId, v1)) {
             if(minVertexId == -1) {
               minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minStarLocalId = k;
-#endif
               minVertexId = vertexId;
             } else if(sosLowerThan(vertexId, minVertexId)) {
               minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minStarLocalId = k;
-#endif
               minVertexId = vertexId;
             }
           }
         }
         if(minStarId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minStarLocalId;
+          gradient.setCofacet(alphaDim, alpha, minStarLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellEdge(minStarId, k, tmp);
@@ -310,11 +300,7 @@ int DiscreteGradient::assignGradient(
             }
           }
 
-          gradient[betaDim][minStarId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minStarId;
-          gradient[betaDim][minStarId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minStarId, minAlphaLocalId);
         }
       }
     }
@@ -323,11 +309,14 @@ int DiscreteGradient::assignGradient(
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
     for(SimplexId alpha = 0; alpha < alphaNumber; ++alpha) {
+      if(isGrid
+         and assignGridGradient(alphaDim, alpha, gridDimensions, stencils,
+                                scalars, offsets, gradient))
+        continue;
+
       if(alphaDim == 0) {
         SimplexId minEdgeId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minEdgeLocalId{-1};
-#endif
+        SimplexId minEdgeLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId edgeNumber
           = inputTriangulation_->getVertexEdgeNumber(alpha);
@@ -343,24 +332,19 @@ int DiscreteGradient::assignGradient(
           if(sosLowerThan(vertexId, alpha)) {
             if(minVertexId == -1) {
               minEdgeId = edgeId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minEdgeLocalId = k;
-#endif
               minVertexId = vertexId;
             } else if(sosLowerThan(vertexId, minVertexId)) {
               minEdgeId = edgeId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minEdgeLocalId = k;
-#endif
               minVertexId = vertexId;
             }
           }
         }
         if(minEdgeId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minEdgeLocalId;
+          gradient.setCofacet(alphaDim, alpha, minEdgeLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
             inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
@@ -370,11 +354,7 @@ int DiscreteGradient::assignGradient(
             }
           }
 
-          gradient[betaDim][minEdgeId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minEdgeId;
-          gradient[betaDim][minEdgeId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minEdgeId, minAlphaLocalId);
         }
       } else if(alphaDim == 1) {
         SimplexId v0;
@@ -383,9 +363,7 @@ int DiscreteGradient::assignGradient(
         inputTriangulation_->getEdgeVertex(alpha, 1, v1);
 
         SimplexId minTriangleId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minTriangleLocalId{-1};
-#endif
+        SimplexId minTriangleLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId triangleNumber
           = inputTriangulation_->getEdgeTriangleNumber(alpha);
@@ -403,24 +381,19 @@ int DiscreteGradient::assignGradient(
           if(sosLowerThan(vertexId, v0) and sosLowerThan(vertexId, v1)) {
             if(minVertexId == -1) {
               minTriangleId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minTriangleLocalId = k;
-#endif
               minVertexId = vertexId;
             } else if(sosLowerThan(vertexId, minVertexId)) {
               minTriangleId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minTriangleLocalId = k;
-#endif
               minVertexId = vertexId;
             }
           }
         }
         if(minTriangleId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minTriangleLocalId;
+          gradient.setCofacet(alphaDim, alpha, minTriangleLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getTriangleEdge(minTriangleId, k, tmp);
@@ -430,11 +403,7 @@ int DiscreteGradient::assignGradient(
             }
           }
 
-          gradient[betaDim][minTriangleId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minTriangleId;
-          gradient[betaDim][minTriangleId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minTriangleId, minAlphaLocalId);
         }
       } else if(alphaDim == 2) {
         SimplexId v0;
@@ -445,9 +414,7 @@ int DiscreteGradient::assignGradient(
         inputTriangulation_->getTriangleVertex(alpha, 2, v2);
 
         SimplexId minStarId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
-#endif
+        SimplexId minStarLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId starNumber
           = inputTriangulation_->getTriangleStarNumber(alpha);
@@ -468,24 +435,19 @@ int DiscreteGradient::assignGradient(
              and sosLowerThan(vertexId, v2)) {
             if(minVertexId == -1) {
               minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minStarLocalId = k;
-#endif
               minVertexId = vertexId;
             } else if(sosLowerThan(vertexId, minVertexId)) {
               minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
               minStarLocalId = k;
-#endif
               minVertexId = vertexId;
             }
           }
         }
         if(minStarId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minStarLocalId;
+          gradient.setCofacet(alphaDim, alpha, minStarLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 4; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -495,11 +457,7 @@ int DiscreteGradient::assignGradient(
             }
           }
 
-          gradient[betaDim][minStarId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minStarId;
-          gradient[betaDim][minStarId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minStarId, minAlphaLocalId);
         }
       }
     }
@@ -508,19 +466,86 @@ int DiscreteGradient::assignGradient(
   return 0;
 }
 
+template <typename dataType, typename idType>
+bool DiscreteGradient::assignGridGradient(
+  const int alphaDim,
+  const SimplexId alpha,
+  const SimplexId dimensions[3],
+  const std::vector<GridStencil> &stencils,
+  const dataType *const scalars,
+  const idType *const offsets,
+  PackedGradient &gradient) const {
+  const Cell cell{alphaDim, alpha};
+
+  // the star of the cell is a translate of its stencil if all of its
+  // vertices are away from the boundary of the grid
+  SimplexId vertices[3]{};
+  for(int i = 0; i <= alphaDim; ++i) {
+    vertices[i] = getCellVertex(cell, i);
+
+    SimplexId coordinate = vertices[i];
+    for(int k = 0; k < 3; ++k) {
+      const SimplexId x = coordinate % dimensions[k];
+      if(dimensions[k] > 1 and (x == 0 or x == dimensions[k] - 1))
+        return false;
+      coordinate /= dimensions[k];
+    }
+  }
+
+  const GridStencil *stencil{nullptr};
+  for(const auto &s : stencils) {
+    if(s.matches(alphaDim, vertices)) {
+      stencil = &s;
+      break;
+    }
+  }
+  if(stencil == nullptr)
+    return false;
+
+  const auto sosLowerThan
+    = [&scalars, &offsets](const SimplexId a, const SimplexId b) {
+        if(scalars[a] != scalars[b])
+          return scalars[a] < scalars[b];
+        else
+          return offsets[a] < offsets[b];
+      };
+
+  // same pairing as the generic code path: the cofacet whose remaining
+  // vertex is the lowest among those lower than all the vertices of the cell
+  SimplexId minCofacetLocalId{-1};
+  SimplexId minVertexId{-1};
+  const SimplexId cofacetNumber = stencil->cofacetOffsets.size();
+  for(SimplexId k = 0; k < cofacetNumber; ++k) {
+    const SimplexId vertexId = vertices[0] + stencil->cofacetOffsets[k];
+
+    bool isLower = true;
+    for(int i = 0; i <= alphaDim; ++i)
+      isLower = isLower and sosLowerThan(vertexId, vertices[i]);
+
+    if(isLower and (minVertexId == -1 or sosLowerThan(vertexId, minVertexId))) {
+      minCofacetLocalId = k;
+      minVertexId = vertexId;
+    }
+  }
+
+  if(minCofacetLocalId != -1) {
+    gradient.setCofacet(alphaDim, alpha, minCofacetLocalId);
+    gradient.setFacet(alphaDim + 1, getCellCofacet(cell, minCofacetLocalId),
+                      stencil->facetIds[minCofacetLocalId]);
+  }
+
+  return true;
+}
+
 template <typename dataType, typename idType>
 int DiscreteGradient::assignGradient2(
   const int alphaDim,
   const dataType *const scalars,
   const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
-#else
-  std::vector<std::vector<SimplexId>> &gradient) const {
-#endif
+  PackedGradient &gradient) const {
   if(alphaDim > 0) {
     const int betaDim = alphaDim + 1;
-    const SimplexId alphaNumber = gradient[alphaDim].size();
+    const SimplexId alphaNumber = getNumberOfCells(alphaDim);
 
     const auto sosLowerThan
       = [&scalars, &offsets](const SimplexId a, const SimplexId b) {
@@ -543,9 +568,7 @@ int DiscreteGradient::assignGradient2(
         inputTriangulation_->getEdgeVertex(alpha, 1, v1);
 
         SimplexId minStarId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
-#endif
+        SimplexId minStarLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId starNumber
           = inputTriangulation_->getEdgeStarNumber(alpha);
@@ -566,25 +589,20 @@ int DiscreteGradient::assignGradient2(
                or (sosLowerThan(vertexId, v1) and sosLowerThan(v0, vertexId))) {
               if(minVertexId == -1) {
                 minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                 minStarLocalId = k;
-#endif
                 minVertexId = vertexId;
               } else if(sosLowerThan(vertexId, minVertexId)) {
                 minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                 minStarLocalId = k;
-#endif
                 minVertexId = vertexId;
               }
             }
           }
         }
         if(minStarId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minStarLocalId;
+          gradient.setCofacet(alphaDim, alpha, minStarLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellEdge(minStarId, k, tmp);
@@ -594,11 +612,7 @@ int DiscreteGradient::assignGradient2(
             }
           }
 
-          gradient[betaDim][minStarId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minStarId;
-          gradient[betaDim][minStarId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minStarId, minAlphaLocalId);
         }
       }
     } else if(dimensionality_ == 3) {
@@ -616,9 +630,7 @@ int DiscreteGradient::assignGradient2(
           inputTriangulation_->getEdgeVertex(alpha, 1, v1);
 
           SimplexId minTriangleId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          char minTriangleLocalId{-1};
-#endif
+          SimplexId minTriangleLocalId{-1};
           SimplexId minVertexId{-1};
           const SimplexId triangleNumber
             = inputTriangulation_->getEdgeTriangleNumber(alpha);
@@ -639,25 +651,20 @@ int DiscreteGradient::assignGradient2(
                      and sosLowerThan(v0, vertexId))) {
                 if(minVertexId == -1) {
                   minTriangleId = triangleId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                   minTriangleLocalId = k;
-#endif
                   minVertexId = vertexId;
                 } else if(sosLowerThan(vertexId, minVertexId)) {
                   minTriangleId = triangleId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                   minTriangleLocalId = k;
-#endif
                   minVertexId = vertexId;
                 }
               }
             }
           }
           if(minTriangleId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-            gradient[alphaDim][alpha] = minTriangleLocalId;
+            gradient.setCofacet(alphaDim, alpha, minTriangleLocalId);
 
-            char minAlphaLocalId{-1};
+            SimplexId minAlphaLocalId{-1};
             for(SimplexId k = 0; k < 3; ++k) {
               SimplexId tmp;
               inputTriangulation_->getTriangleEdge(minTriangleId, k, tmp);
@@ -667,11 +674,7 @@ int DiscreteGradient::assignGradient2(
               }
             }
 
-            gradient[betaDim][minTriangleId] = minAlphaLocalId;
-#else
-            gradient[alphaDim][alpha] = minTriangleId;
-            gradient[betaDim][minTriangleId] = alpha;
-#endif
+            gradient.setFacet(betaDim, minTriangleId, minAlphaLocalId);
           }
         } else if(alphaDim == 2) {
           SimplexId v0;
@@ -693,9 +696,7 @@ int DiscreteGradient::assignGradient2(
             vb = v2;
 
           SimplexId minStarId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          char minStarLocalId{-1};
-#endif
+          SimplexId minStarLocalId{-1};
           SimplexId minVertexId{-1};
           const SimplexId starNumber
             = inputTriangulation_->getTriangleStarNumber(alpha);
@@ -716,25 +717,20 @@ int DiscreteGradient::assignGradient2(
               if(sosLowerThan(vertexId, vb)) {
                 if(minVertexId == -1) {
                   minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                   minStarLocalId = k;
-#endif
                   minVertexId = vertexId;
                 } else if(sosLowerThan(vertexId, minVertexId)) {
                   minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                   minStarLocalId = k;
-#endif
                   minVertexId = vertexId;
                 }
               }
             }
           }
           if(minStarId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-            gradient[alphaDim][alpha] = minStarLocalId;
+            gradient.setCofacet(alphaDim, alpha, minStarLocalId);
 
-            char minAlphaLocalId{-1};
+            SimplexId minAlphaLocalId{-1};
             for(SimplexId k = 0; k < 4; ++k) {
               SimplexId tmp;
               inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -744,11 +740,7 @@ int DiscreteGradient::assignGradient2(
               }
             }
 
-            gradient[betaDim][minStarId] = minAlphaLocalId;
-#else
-            gradient[alphaDim][alpha] = minStarId;
-            gradient[betaDim][minStarId] = alpha;
-#endif
+            gradient.setFacet(betaDim, minStarId, minAlphaLocalId);
           }
         }
       }
@@ -763,14 +755,10 @@ int DiscreteGradient::assignGradient3(
   const int alphaDim,
   const dataType *const scalars,
   const idType *const offsets,
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
-#else
-  std::vector<std::vector<SimplexId>> &gradient) const {
-#endif
+  PackedGradient &gradient) const {
   if(alphaDim > 0) {
     const int betaDim = alphaDim + 1;
-    const SimplexId alphaNumber = gradient[alphaDim].size();
+    const SimplexId alphaNumber = getNumberOfCells(alphaDim);
 
     const auto sosLowerThan
       = [&scalars, &offsets](const SimplexId a, const SimplexId b) {
@@ -804,9 +792,7 @@ int DiscreteGradient::assignGradient3(
           vmax = v2;
 
         SimplexId minStarId{-1};
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
-#endif
+        SimplexId minStarLocalId{-1};
         SimplexId minVertexId{-1};
         const SimplexId starNumber
           = inputTriangulation_->getTriangleStarNumber(alpha);
@@ -827,25 +813,20 @@ int DiscreteGradient::assignGradient3(
             if(sosLowerThan(vertexId, vmax)) {
               if(minVertexId == -1) {
                 minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                 minStarLocalId = k;
-#endif
                 minVertexId = vertexId;
               } else if(sosLowerThan(vertexId, minVertexId)) {
                 minStarId = starId;
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
                 minStarLocalId = k;
-#endif
                 minVertexId = vertexId;
               }
             }
           }
         }
         if(minStarId != -1) {
-#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          gradient[alphaDim][alpha] = minStarLocalId;
+          gradient.setCofacet(alphaDim, alpha, minStarLocalId);
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 4; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -855,11 +836,7 @@ int DiscreteGradient::assignGradient3(
             }
           }
 
-          gradient[betaDim][minStarId] = minAlphaLocalId;
-#else
-          gradient[alphaDim][alpha] = minStarId;
-          gradient[betaDim][minStarId] = alpha;
-#endif
+          gradient.setFacet(betaDim, minStarId, minAlphaLocalId);
         }
       }
     }
@@ -886,17 +863,12 @@ int DiscreteGradient::buildGradient() {
   dmtMax2PL_.clear();
   dmt1Saddle2PL_.clear();
   dmt2Saddle2PL_.clear();
-  gradient_.clear();
-  gradient_.resize(dimensionality_);
-  for(int i = 0; i < dimensionality_; ++i) {
-    // init gradient memory
-    gradient_[i].resize(numberOfDimensions);
-    gradient_[i][i].resize(numberOfCells[i], -1);
-    gradient_[i][i + 1].resize(numberOfCells[i + 1], -1);
+  // init gradient memory
+  gradient_.resize(numberOfCells);
 
-    // compute gradient pairs
-    assignGradient<dataType, idType>(i, scalars, offsets, gradient_[i]);
-  }
+  // compute gradient pairs
+  for(int i = 0; i < dimensionality_; ++i)
+    assignGradient<dataType, idType>(i, scalars, offsets, gradient_);
 
   {
     std::stringstream msg;
@@ -922,12 +894,14 @@ template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient2() {
   Timer t;
 
+  gradient_.detach();
+
   const idType *const offsets = static_cast<const idType *>(inputOffsets_);
   const dataType *const scalars
     = static_cast<const dataType *>(inputScalarField_);
 
   for(int i = 1; i < dimensionality_; ++i)
-    assignGradient2<dataType, idType>(i, scalars, offsets, gradient_[i]);
+    assignGradient2<dataType, idType>(i, scalars, offsets, gradient_);
 
   {
     std::stringstream msg;
@@ -944,12 +918,14 @@ template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient3() {
   Timer t;
 
+  gradient_.detach();
+
   const idType *const offsets = static_cast<const idType *>(inputOffsets_);
   const dataType *const scalars
     = static_cast<const dataType *>(inputScalarField_);
 
   for(int i = 2; i < dimensionality_; ++i)
-    assignGradient3<dataType, idType>(i, scalars, offsets, gradient_[i]);
+    assignGradient3<dataType, idType>(i, scalars, offsets, gradient_);
 
   {
     std::stringstream msg;
@@ -3397,7 +3373,8 @@ int DiscreteGradient::filterSaddleConnectors(const bool allowBoundary) {
   contourTree.setVertexSoSoffsets(offsets);
   contourTree.setThreadNumber(threadNumber_);
   contourTree.setSegmentation(false);
-  contourTree.build<dataType, SimplexId>();
+  contourTree.setScalarsModificationTime(inputModificationTime_);
+  contourTree.build<dataType, idType>();
   ftm::FTMTree_MT *tree = contourTree.getTree(ftm::TreeType::Contour);
 
   const SimplexId numberOfNodes = tree->getNumberOfNodes();
@@ -1,10 +1,183 @@
 #include <ExplicitTriangulation.h>
+#include <RadixSort.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
 
 using namespace std;
 using namespace ttk;
 
+namespace {
+  // layout of the cache files (see ExplicitTriangulation::writeToFile()):
+  // a header, a table of sections, then the sections' payloads, each aligned
+  // on 8 bytes. A relation table section stores the rowNumber + 1 offsets of
+  // the table followed by its items. Native byte order.
+  const char cacheFileMagic[8] = "TTKTRIC";
+  const uint32_t cacheFileVersion = 1;
+
+  // sections which are not relation tables
+  enum CacheFileSection : uint32_t {
+    edgeListSection = 32,
+    boundaryVertexSection,
+    boundaryEdgeSection,
+    boundaryTriangleSection
+  };
+
+  struct CacheFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t simplexIdSize;
+    uint64_t cellsHash;
+    int64_t vertexNumber;
+    int64_t cellNumber;
+    uint64_t sectionNumber;
+  };
+
+  struct CacheFileSectionHeader {
+    uint32_t id;
+    uint32_t itemSize;
+    uint64_t offset;
+    uint64_t rowNumber;
+    uint64_t itemNumber;
+  };
+
+  inline uint64_t cacheFilePadding(const uint64_t &size) {
+    return (8 - size % 8) % 8;
+  }
+
+  // simplices indexing the rows and the items of the relation tables, in
+  // the order of ExplicitTriangulation::cacheTables_ (the links depend on
+  // the dimension, see readFromFile())
+  enum CacheFileDomain : int {
+    vertexDomain,
+    edgeDomain,
+    triangleDomain,
+    cellDomain,
+    linkDomain
+  };
+  const CacheFileDomain cacheTableRows[15]
+    = {cellDomain,     cellDomain,     cellDomain,     edgeDomain,
+       edgeDomain,     edgeDomain,     triangleDomain, triangleDomain,
+       triangleDomain, triangleDomain, vertexDomain,   vertexDomain,
+       vertexDomain,   vertexDomain,   vertexDomain};
+  const CacheFileDomain cacheTableItems[15]
+    = {edgeDomain,     cellDomain,     triangleDomain, linkDomain,
+       cellDomain,     triangleDomain, vertexDomain,   edgeDomain,
+       vertexDomain,   cellDomain,     edgeDomain,     linkDomain,
+       vertexDomain,   cellDomain,     triangleDomain};
+
+  // check that the offsets of a mapped relation table are non-decreasing
+  // from 0 to itemNumber and that its items are in [0, idNumber)
+  template <class idType>
+  bool isValidCacheTable(const char *payload,
+                         const uint64_t &rowNumber,
+                         const uint64_t &itemNumber,
+                         const int64_t &idNumber,
+                         const int &threadNumber) {
+
+#ifndef TTK_ENABLE_OPENMP
+    (void)threadNumber;
+#endif
+
+    const idType *offsets = (const idType *)payload;
+    const idType *items = offsets + rowNumber + 1;
+
+    if((offsets[0] != 0) || ((uint64_t)offsets[rowNumber] != itemNumber))
+      return false;
+
+    bool isValid = true;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) reduction(&& : isValid)
+#endif
+    for(int64_t i = 0; i < (int64_t)rowNumber; i++) {
+      if(offsets[i + 1] < offsets[i])
+        isValid = false;
+    }
+    if(!isValid)
+      return false;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) reduction(&& : isValid)
+#endif
+    for(int64_t i = 0; i < (int64_t)itemNumber; i++) {
+      if((items[i] < 0) || (items[i] >= idNumber))
+        isValid = false;
+    }
+
+    return isValid;
+  }
+
+  // index of a point along the Hilbert curve of order bitNumber in
+  // dimension dimension, from its integer coordinates (Skilling, "Programming
+  // the Hilbert curve", AIP Conference Proceedings 707, 2004).
+  inline uint64_t hilbertKey(uint64_t *coordinates,
+                             const int &dimension,
+                             const int &bitNumber) {
+
+    const uint64_t M = ((uint64_t)1) << (bitNumber - 1);
+
+    // inverse undo
+    for(uint64_t Q = M; Q > 1; Q >>= 1) {
+      const uint64_t P = Q - 1;
+      for(int i = 0; i < dimension; i++) {
+        if(coordinates[i] & Q) {
+          coordinates[0] ^= P;
+        } else {
+          const uint64_t t = (coordinates[0] ^ coordinates[i]) & P;
+          coordinates[0] ^= t;
+          coordinates[i] ^= t;
+        }
+      }
+    }
+
+    // gray encode
+    for(int i = 1; i < dimension; i++)
+      coordinates[i] ^= coordinates[i - 1];
+    uint64_t t = 0;
+    for(uint64_t Q = M; Q > 1; Q >>= 1) {
+      if(coordinates[dimension - 1] & Q)
+        t ^= Q - 1;
+    }
+    for(int i = 0; i < dimension; i++)
+      coordinates[i] ^= t;
+
+    // interleave the bits of the transposed index
+    uint64_t key = 0;
+    for(int b = bitNumber - 1; b >= 0; b--) {
+      for(int i = 0; i < dimension; i++) {
+        key = (key << 1) | ((coordinates[i] >> b) & 1);
+      }
+    }
+
+    return key;
+  }
+} // namespace
+
+FlatJaggedArray ExplicitTriangulation::*const
+  ExplicitTriangulation::cacheTables_[15]
+  = {&ExplicitTriangulation::cellEdgeData_,
+     &ExplicitTriangulation::cellNeighborData_,
+     &ExplicitTriangulation::cellTriangleData_,
+     &ExplicitTriangulation::edgeLinkData_,
+     &ExplicitTriangulation::edgeStarData_,
+     &ExplicitTriangulation::edgeTriangleData_,
+     &ExplicitTriangulation::triangleVertexData_,
+     &ExplicitTriangulation::triangleEdgeData_,
+     &ExplicitTriangulation::triangleLinkData_,
+     &ExplicitTriangulation::triangleStarData_,
+     &ExplicitTriangulation::vertexEdgeData_,
+     &ExplicitTriangulation::vertexLinkData_,
+     &ExplicitTriangulation::vertexNeighborData_,
+     &ExplicitTriangulation::vertexStarData_,
+     &ExplicitTriangulation::vertexTriangleData_};
+
 ExplicitTriangulation::ExplicitTriangulation() {
 
+  lazyBlockSize_ = 1024;
+  inputPointSet_ = nullptr;
+  inputCellArray_ = nullptr;
+
   clear();
 }
 
@@ -17,6 +190,36 @@ int ExplicitTriangulation::clear() {
   cellNumber_ = 0;
   doublePrecision_ = false;
 
+  cellEdgeData_.clear();
+  cellNeighborData_.clear();
+  cellTriangleData_.clear();
+  edgeLinkData_.clear();
+  edgeStarData_.clear();
+  edgeTriangleData_.clear();
+  triangleVertexData_.clear();
+  triangleEdgeData_.clear();
+  triangleLinkData_.clear();
+  triangleStarData_.clear();
+  vertexEdgeData_.clear();
+  vertexLinkData_.clear();
+  vertexNeighborData_.clear();
+  vertexStarData_.clear();
+  vertexTriangleData_.clear();
+
+  // after the tables, which may point to it
+  cacheFile_.reset();
+
+  if(isReordered()) {
+    pointSet_ = inputPointSet_;
+    cellArray_ = inputCellArray_;
+  }
+  reorderedPointSet_.reset();
+  reorderedCellArray_.reset();
+  inputCellIds_.clear();
+  inputVertexIds_.clear();
+  reorderedCellIds_.clear();
+  reorderedVertexIds_.clear();
+
   {
     stringstream msg;
     msg << "[ExplicitTriangulation] Triangulation cleared." << endl;
@@ -25,3 +228,628 @@ int ExplicitTriangulation::clear() {
 
   return AbstractTriangulation::clear();
 }
+
+int ExplicitTriangulation::buildLazyBlock(const LazyRelation &relation,
+                                          const SimplexId &blockId,
+                                          FlatJaggedArray &block) const {
+
+  // blocks are built upon request, possibly from within the parallel loops
+  // of the calling code: use a single thread and stay quiet.
+  const SimplexId beginId = blockId * lazyBlockSize_;
+  SimplexId endId = beginId + lazyBlockSize_;
+
+  switch(relation) {
+
+    case edgeLinkRelation: {
+      OneSkeleton oneSkeleton;
+      oneSkeleton.setThreadNumber(1);
+      oneSkeleton.setDebugLevel(fatalMsg);
+      if(endId > (SimplexId)edgeList_.size())
+        endId = edgeList_.size();
+      // the whole edge star table, or its block covering the same edges
+      SimplexId starRow;
+      const FlatJaggedArray *edgeStars
+        = getRelationTable(edgeStarData_, edgeStarRelation, beginId, starRow);
+      if(getDimensionality() == 2) {
+        return oneSkeleton.buildEdgeLinks(
+          edgeList_, *edgeStars, cellArray_, block, beginId, endId);
+      }
+      return oneSkeleton.buildEdgeLinks(
+        edgeList_, *edgeStars, cellEdgeData_, block, beginId, endId);
+    }
+
+    case edgeStarRelation: {
+      OneSkeleton oneSkeleton;
+      oneSkeleton.setThreadNumber(1);
+      oneSkeleton.setDebugLevel(fatalMsg);
+      if(endId > (SimplexId)edgeList_.size())
+        endId = edgeList_.size();
+      return oneSkeleton.buildEdgeStars(
+        edgeList_, vertexStarData_, block, beginId, endId);
+    }
+
+    case triangleLinkRelation: {
+      TwoSkeleton twoSkeleton;
+      twoSkeleton.setThreadNumber(1);
+      twoSkeleton.setDebugLevel(fatalMsg);
+      if(endId > triangleVertexData_.size())
+        endId = triangleVertexData_.size();
+      return twoSkeleton.buildTriangleLinks(triangleVertexData_,
+                                            triangleStarData_, cellArray_,
+                                            block, beginId, endId);
+    }
+
+    case vertexLinkRelation: {
+      ZeroSkeleton zeroSkeleton;
+      zeroSkeleton.setThreadNumber(1);
+      zeroSkeleton.setDebugLevel(fatalMsg);
+      if(endId > vertexNumber_)
+        endId = vertexNumber_;
+      if(getDimensionality() == 2) {
+        return zeroSkeleton.buildVertexLinks(
+          vertexStarData_, cellEdgeData_, edgeList_, block, beginId, endId);
+      }
+      return zeroSkeleton.buildVertexLinks(vertexStarData_, cellTriangleData_,
+                                           triangleVertexData_, block, beginId,
+                                           endId);
+    }
+  }
+
+  return -1;
+}
+
+int ExplicitTriangulation::getMemoryReport(MemoryReport &report) const {
+
+  AbstractTriangulation::getMemoryReport(report);
+
+  const string component = "ExplicitTriangulation";
+  // same order as cacheTables_
+  const char *tableNames[15]
+    = {"cellEdgeData_",       "cellNeighborData_",  "cellTriangleData_",
+       "edgeLinkData_",       "edgeStarData_",      "edgeTriangleData_",
+       "triangleVertexData_", "triangleEdgeData_",  "triangleLinkData_",
+       "triangleStarData_",   "vertexEdgeData_",    "vertexLinkData_",
+       "vertexNeighborData_", "vertexStarData_",    "vertexTriangleData_"};
+
+  for(int i = 0; i < 15; i++) {
+    const FlatJaggedArray &table = this->*cacheTables_[i];
+    if(table.isExternal()) {
+      report.add(component, tableNames[i], 0, "memory-mapped");
+    } else {
+      report.add(component, tableNames[i], table.footprint(),
+                 table.isCompact() ? "compact" : "");
+    }
+  }
+
+  if(reorderedPointSet_)
+    report.add(component, "reorderedPointSet_",
+               MemoryReport::bytes(*reorderedPointSet_));
+  if(reorderedCellArray_)
+    report.add(component, "reorderedCellArray_",
+               MemoryReport::bytes(*reorderedCellArray_));
+  report.add(component, "inputCellIds_", MemoryReport::bytes(inputCellIds_));
+  report.add(
+    component, "inputVertexIds_", MemoryReport::bytes(inputVertexIds_));
+  report.add(
+    component, "reorderedCellIds_", MemoryReport::bytes(reorderedCellIds_));
+  report.add(component, "reorderedVertexIds_",
+             MemoryReport::bytes(reorderedVertexIds_));
+
+  return 0;
+}
+
+unsigned long long ExplicitTriangulation::getCellsHash() const {
+
+  // 64-bit FNV-1a, one cell array entry at a time
+  uint64_t hash = 14695981039346656037ULL;
+  const uint64_t prime = 1099511628211ULL;
+
+  hash = (hash ^ (uint64_t)vertexNumber_) * prime;
+  hash = (hash ^ (uint64_t)cellNumber_) * prime;
+
+  if(cellArray_) {
+    LongSimplexId entry = 0;
+    for(SimplexId i = 0; i < cellNumber_; i++) {
+      const LongSimplexId cellSize = cellArray_[entry];
+      for(LongSimplexId j = 0; j <= cellSize; j++) {
+        hash = (hash ^ (uint64_t)cellArray_[entry + j]) * prime;
+      }
+      entry += cellSize + 1;
+    }
+  }
+
+  return hash;
+}
+
+int ExplicitTriangulation::reorderInput() {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!pointSet_) || (!cellArray_) || (vertexNumber_ <= 0)
+     || (cellNumber_ <= 0))
+    return -1;
+#endif
+
+  if(isReordered()) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Input already reordered." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -2;
+  }
+
+  bool isPreprocessed = (!edgeList_.empty()) || (!boundaryVertices_.empty())
+                        || (!boundaryEdges_.empty())
+                        || (!boundaryTriangles_.empty());
+  for(const auto table : cacheTables_) {
+    if(!(this->*table).empty())
+      isPreprocessed = true;
+  }
+  if(isPreprocessed) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Cannot reorder a pre-processed "
+        << "triangulation." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -3;
+  }
+
+  Timer t;
+
+  // 1. bounding box, to quantize the coordinates
+  double lower[3], upper[3];
+  for(int j = 0; j < 3; j++) {
+    lower[j] = numeric_limits<double>::max();
+    upper[j] = numeric_limits<double>::lowest();
+  }
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    float p[3];
+    getVertexPoint(i, p[0], p[1], p[2]);
+    for(int j = 0; j < 3; j++) {
+      if(p[j] < lower[j])
+        lower[j] = p[j];
+      if(p[j] > upper[j])
+        upper[j] = p[j];
+    }
+  }
+
+  // the Hilbert curve is built in the dimension of the bounding box (for
+  // instance, a planar mesh embedded in 3D is traversed by a 2D curve)
+  int axes[3], dimension = 0;
+  for(int j = 0; j < 3; j++) {
+    if(upper[j] > lower[j])
+      axes[dimension++] = j;
+  }
+
+  // 2. Hilbert index of each vertex
+  vector<uint64_t> keys(vertexNumber_, 0);
+  if(dimension) {
+    const int bitNumber = (dimension == 1) ? 32 : 63 / dimension;
+    const double resolution = (double)((((uint64_t)1) << bitNumber) - 1);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < vertexNumber_; i++) {
+      float p[3];
+      getVertexPoint(i, p[0], p[1], p[2]);
+      uint64_t coordinates[3];
+      for(int j = 0; j < dimension; j++) {
+        const int axis = axes[j];
+        coordinates[j] = (uint64_t)(resolution * (p[axis] - lower[axis])
+                                    / (upper[axis] - lower[axis]));
+      }
+      keys[i] = hilbertKey(coordinates, dimension, bitNumber);
+    }
+  }
+
+  // 3. new vertex order (stable: ties keep the input order)
+  uint64_t maxKey = 0;
+  for(const auto &key : keys) {
+    if(key > maxKey)
+      maxKey = key;
+  }
+  vector<SimplexId> buffer;
+  inputVertexIds_.resize(vertexNumber_);
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    inputVertexIds_[i] = i;
+  RadixSort::sort(
+    inputVertexIds_, buffer,
+    [&keys](const SimplexId &v) { return keys[v]; },
+    RadixSort::keyBits(maxKey), threadNumber_);
+
+  reorderedVertexIds_.resize(vertexNumber_);
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    reorderedVertexIds_[inputVertexIds_[i]] = i;
+
+  // 4. new cell order, by increasing smallest (new) vertex identifier
+  const LongSimplexId cellSize = cellArray_[0];
+  const LongSimplexId *inputCells = cellArray_;
+  vector<SimplexId> cellKeys(cellNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    const LongSimplexId *cell = &(inputCells[(cellSize + 1) * i + 1]);
+    SimplexId minVertex = reorderedVertexIds_[cell[0]];
+    for(LongSimplexId j = 1; j < cellSize; j++) {
+      if(reorderedVertexIds_[cell[j]] < minVertex)
+        minVertex = reorderedVertexIds_[cell[j]];
+    }
+    cellKeys[i] = minVertex;
+  }
+
+  inputCellIds_.resize(cellNumber_);
+  for(SimplexId i = 0; i < cellNumber_; i++)
+    inputCellIds_[i] = i;
+  RadixSort::sort(
+    inputCellIds_, buffer,
+    [&cellKeys](const SimplexId &c) { return (uint64_t)cellKeys[c]; },
+    RadixSort::keyBits(vertexNumber_), threadNumber_);
+
+  reorderedCellIds_.resize(cellNumber_);
+  for(SimplexId i = 0; i < cellNumber_; i++)
+    reorderedCellIds_[inputCellIds_[i]] = i;
+
+  // 5. internal copies of the points and cells, in the new order
+  const size_t pointSize = 3 * (doublePrecision_ ? sizeof(double)
+                                                 : sizeof(float));
+  auto points = make_shared<vector<char>>(pointSize * vertexNumber_);
+  auto cells
+    = make_shared<vector<LongSimplexId>>((cellSize + 1) * cellNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    memcpy(&((*points)[pointSize * i]),
+           ((const char *)pointSet_) + pointSize * inputVertexIds_[i],
+           pointSize);
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    const LongSimplexId *cell
+      = &(inputCells[(cellSize + 1) * inputCellIds_[i] + 1]);
+    LongSimplexId *newCell = &((*cells)[(cellSize + 1) * i]);
+    newCell[0] = cellSize;
+    for(LongSimplexId j = 0; j < cellSize; j++)
+      newCell[j + 1] = reorderedVertexIds_[cell[j]];
+  }
+
+  inputPointSet_ = pointSet_;
+  inputCellArray_ = cellArray_;
+  reorderedPointSet_ = points;
+  reorderedCellArray_ = cells;
+  pointSet_ = points->data();
+  cellArray_ = cells->data();
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Input reordered along a " << dimension
+        << "D Hilbert curve in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s))." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::readFromFile(const string &fileName) {
+
+  Timer t;
+
+  // the tables loaded from a previous file are views into its mapping,
+  // which must outlive them
+  if(cacheFile_) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] A cache file is already loaded, `"
+        << fileName << "' ignored." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -7;
+  }
+
+  shared_ptr<MappedFile> file = make_shared<MappedFile>();
+  if(file->open(fileName)) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Could not map cache file `" << fileName
+        << "'." << endl;
+    dMsg(cerr, msg.str(), detailedInfoMsg);
+    return -1;
+  }
+
+  const char *fileData = file->data();
+  const uint64_t fileSize = file->size();
+
+  CacheFileHeader header;
+  if(fileSize < sizeof(header))
+    return -2;
+  memcpy(&header, fileData, sizeof(header));
+
+  if((memcmp(header.magic, cacheFileMagic, sizeof(cacheFileMagic)))
+     || (header.version != cacheFileVersion)
+     || (header.simplexIdSize != sizeof(SimplexId))) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Cache file `" << fileName
+        << "' has an incompatible format." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -3;
+  }
+
+  if((header.vertexNumber != vertexNumber_)
+     || (header.cellNumber != cellNumber_)
+     || (header.cellsHash != getCellsHash())) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Cache file `" << fileName
+        << "' was written for other input cells." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -4;
+  }
+
+  const uint64_t sectionTableSize
+    = header.sectionNumber * sizeof(CacheFileSectionHeader);
+  if((header.sectionNumber > fileSize)
+     || (sizeof(header) + sectionTableSize > fileSize))
+    return -5;
+
+  vector<CacheFileSectionHeader> sections(header.sectionNumber);
+  if(sectionTableSize)
+    memcpy(sections.data(), fileData + sizeof(header), sectionTableSize);
+
+  // number of simplices of each domain: the edges and the triangles are
+  // known from the triangulation or from the file (-1: unknown)
+  int64_t domainSizes[5] = {vertexNumber_, -1, -1, cellNumber_, -1};
+  if(!edgeList_.empty())
+    domainSizes[edgeDomain] = edgeList_.size();
+  if(!triangleVertexData_.empty())
+    domainSizes[triangleDomain] = triangleVertexData_.size();
+  for(const auto &section : sections) {
+    if((section.id == edgeListSection) && (domainSizes[edgeDomain] < 0))
+      domainSizes[edgeDomain] = section.rowNumber;
+    if((section.id == 6) && (domainSizes[triangleDomain] < 0))
+      domainSizes[triangleDomain] = section.rowNumber;
+  }
+  const int dimension = getDimensionality();
+
+  // check all the sections before modifying the triangulation
+  for(const auto &section : sections) {
+    const bool isTable = (section.id < 15);
+    if((section.itemSize == 0) || (section.itemSize > 8))
+      return -6;
+    const uint64_t itemNumber
+      = section.itemNumber + (isTable ? section.rowNumber + 1 : 0);
+    const uint64_t payloadSize = section.itemSize * itemNumber;
+    if((section.offset % 8) || (section.offset > fileSize)
+       || (section.itemNumber > fileSize) || (section.rowNumber > fileSize)
+       || (payloadSize > fileSize - section.offset))
+      return -6;
+    const char *payload = fileData + section.offset;
+    if(section.id == edgeListSection) {
+      if((section.itemSize != sizeof(SimplexId))
+         || (section.itemNumber != 2 * section.rowNumber)
+         || ((int64_t)section.rowNumber != domainSizes[edgeDomain]))
+        return -6;
+      const SimplexId *edges = (const SimplexId *)payload;
+      for(uint64_t i = 0; i < section.itemNumber; i++) {
+        if((edges[i] < 0) || (edges[i] >= vertexNumber_))
+          return -6;
+      }
+    } else if((section.id >= boundaryVertexSection)
+              && (section.id <= boundaryTriangleSection)) {
+      // one flag per vertex, edge or triangle (same order as the domains)
+      const int64_t flagNumber
+        = domainSizes[section.id - boundaryVertexSection];
+      if((int64_t)section.itemNumber != flagNumber)
+        return -6;
+    }
+    if(isTable) {
+      CacheFileDomain itemDomain = cacheTableItems[section.id];
+      if(itemDomain == linkDomain) {
+        // links of the edges: vertices in 2D, edges in 3D. links of the
+        // vertices: edges in 2D, triangles in 3D
+        if(section.id == 3)
+          itemDomain = (dimension == 2) ? vertexDomain : edgeDomain;
+        else
+          itemDomain = (dimension == 2) ? edgeDomain : triangleDomain;
+      }
+      const int64_t rowNumber = domainSizes[cacheTableRows[section.id]];
+      const int64_t idNumber = domainSizes[itemDomain];
+      if((rowNumber < 0) || (idNumber < 0)
+         || ((int64_t)section.rowNumber != rowNumber))
+        return -6;
+      // tables may have been written with narrow identifiers
+      bool isValid = false;
+      if(section.itemSize == sizeof(SimplexId)) {
+        isValid = isValidCacheTable<SimplexId>(payload, section.rowNumber,
+                                               section.itemNumber, idNumber,
+                                               threadNumber_);
+      } else if(section.itemSize == sizeof(CompactSimplexId)) {
+        isValid = isValidCacheTable<CompactSimplexId>(
+          payload, section.rowNumber, section.itemNumber, idNumber,
+          threadNumber_);
+      }
+      if(!isValid)
+        return -6;
+    }
+  }
+
+  for(const auto &section : sections) {
+    const char *payload = fileData + section.offset;
+
+    if(section.id < 15) {
+      FlatJaggedArray &table = this->*cacheTables_[section.id];
+      if((table.empty()) && (section.itemSize == sizeof(SimplexId))) {
+        const SimplexId *offsets = (const SimplexId *)payload;
+        table.setExternalData(
+          offsets + section.rowNumber + 1, offsets, section.rowNumber);
+      }
+#ifdef TTK_ENABLE_64BIT_IDS
+      if((table.empty()) && (section.itemSize == sizeof(CompactSimplexId))) {
+        const CompactSimplexId *offsets = (const CompactSimplexId *)payload;
+        table.setExternalData(
+          offsets + section.rowNumber + 1, offsets, section.rowNumber);
+      }
+#endif
+    } else if(section.id == edgeListSection) {
+      if(edgeList_.empty()) {
+        const SimplexId *edges = (const SimplexId *)payload;
+        edgeList_.resize(section.rowNumber);
+        for(SimplexId i = 0; i < (SimplexId)section.rowNumber; i++) {
+          edgeList_[i].first = edges[2 * i];
+          edgeList_[i].second = edges[2 * i + 1];
+        }
+      }
+    } else {
+      vector<bool> *flags = NULL;
+      if(section.id == boundaryVertexSection)
+        flags = &boundaryVertices_;
+      else if(section.id == boundaryEdgeSection)
+        flags = &boundaryEdges_;
+      else if(section.id == boundaryTriangleSection)
+        flags = &boundaryTriangles_;
+      // unknown sections are ignored
+      if((flags) && (flags->empty())) {
+        flags->resize(section.itemNumber);
+        for(uint64_t i = 0; i < section.itemNumber; i++) {
+          (*flags)[i] = (payload[i] != 0);
+        }
+      }
+    }
+  }
+
+  cacheFile_ = file;
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Cache file `" << fileName << "' loaded in "
+        << t.getElapsedTime() << " s. (" << sections.size() << " section(s))."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::writeToFile(const string &fileName) const {
+
+  Timer t;
+
+  vector<CacheFileSectionHeader> sections;
+  vector<const char *> payloads;
+  vector<char> edgeData, boundaryData[3];
+
+  uint64_t offset = 0;
+  auto addSection = [&sections, &payloads, &offset](
+                      const uint32_t &id, const uint32_t &itemSize,
+                      const uint64_t &rowNumber, const uint64_t &itemNumber,
+                      const uint64_t &byteNumber, const char *payload) {
+    CacheFileSectionHeader section;
+    section.id = id;
+    section.itemSize = itemSize;
+    section.offset = offset;
+    section.rowNumber = rowNumber;
+    section.itemNumber = itemNumber;
+    sections.push_back(section);
+    payloads.push_back(payload);
+    offset += byteNumber + cacheFilePadding(byteNumber);
+  };
+
+  for(uint32_t i = 0; i < 15; i++) {
+    const FlatJaggedArray &table = this->*cacheTables_[i];
+    if(!table.empty()) {
+      // compact tables are written with narrow identifiers
+      addSection(i, table.itemSize(), table.size(), table.dataSize(),
+                 (table.size() + 1 + table.dataSize()) * table.itemSize(),
+                 NULL);
+    }
+  }
+
+  if(!edgeList_.empty()) {
+    edgeData.resize(2 * edgeList_.size() * sizeof(SimplexId));
+    SimplexId *edges = (SimplexId *)edgeData.data();
+    for(size_t i = 0; i < edgeList_.size(); i++) {
+      edges[2 * i] = edgeList_[i].first;
+      edges[2 * i + 1] = edgeList_[i].second;
+    }
+    addSection(edgeListSection, sizeof(SimplexId), edgeList_.size(),
+               2 * edgeList_.size(), edgeData.size(), edgeData.data());
+  }
+
+  const vector<bool> *flags[3]
+    = {&boundaryVertices_, &boundaryEdges_, &boundaryTriangles_};
+  for(int i = 0; i < 3; i++) {
+    if(!flags[i]->empty()) {
+      boundaryData[i].resize(flags[i]->size());
+      for(size_t j = 0; j < flags[i]->size(); j++) {
+        boundaryData[i][j] = (*flags[i])[j];
+      }
+      addSection(boundaryVertexSection + i, 1, 0, boundaryData[i].size(),
+                 boundaryData[i].size(), boundaryData[i].data());
+    }
+  }
+
+  CacheFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, cacheFileMagic, sizeof(cacheFileMagic));
+  header.version = cacheFileVersion;
+  header.simplexIdSize = sizeof(SimplexId);
+  header.cellsHash = getCellsHash();
+  header.vertexNumber = vertexNumber_;
+  header.cellNumber = cellNumber_;
+  header.sectionNumber = sections.size();
+
+  // the payloads follow the header and the section table
+  const uint64_t payloadOffset
+    = sizeof(header) + sections.size() * sizeof(CacheFileSectionHeader);
+  const uint64_t padding = cacheFilePadding(payloadOffset);
+  for(auto &section : sections) {
+    section.offset += payloadOffset + padding;
+  }
+
+  ofstream file(fileName.data(), ios::out | ios::binary);
+  if(!file) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Could not write cache file `" << fileName
+        << "'." << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -1;
+  }
+
+  const char zeros[8] = {0};
+  file.write((const char *)&header, sizeof(header));
+  file.write((const char *)sections.data(),
+             sections.size() * sizeof(CacheFileSectionHeader));
+  file.write(zeros, padding);
+
+  for(size_t i = 0; i < sections.size(); i++) {
+    uint64_t byteNumber = sections[i].itemNumber * sections[i].itemSize;
+    if(sections[i].id < 15) {
+      const FlatJaggedArray &table = this->*cacheTables_[sections[i].id];
+      file.write((const char *)table.offsets(),
+                 (table.size() + 1) * table.itemSize());
+      file.write((const char *)table.data(), byteNumber);
+      byteNumber += (table.size() + 1) * table.itemSize();
+    } else {
+      file.write(payloads[i], byteNumber);
+    }
+    file.write(zeros, cacheFilePadding(byteNumber));
+  }
+
+  if(!file) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Error while writing cache file `"
+        << fileName << "'." << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -2;
+  }
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Cache file `" << fileName << "' written in "
+        << t.getElapsedTime() << " s. (" << sections.size() << " section(s))."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
@@ -12,11 +12,14 @@
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <FlatJaggedArray.h>
 #include <OneSkeleton.h>
 #include <ThreeSkeleton.h>
 #include <TwoSkeleton.h>
 #include <ZeroSkeleton.h>
 
+#include <memory>
+
 namespace ttk {
 
   class ExplicitTriangulation final : public AbstractTriangulation {
@@ -26,31 +29,35 @@ namespace ttk {
 
     ~ExplicitTriangulation();
 
+    int getMemoryReport(MemoryReport &report) const override;
+
     inline int getCellEdge(const SimplexId &cellId,
                            const int &localEdgeId,
                            SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdgeData_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)cellEdgeList_[cellId].size()))
+         || (localEdgeId >= cellEdgeData_.size(cellId)))
         return -2;
 #endif
-      edgeId = cellEdgeList_[cellId][localEdgeId];
+      edgeId = cellEdgeData_.get(cellId, localEdgeId);
       return 0;
     }
 
     inline SimplexId getCellEdgeNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdgeData_.size()))
         return -1;
 #endif
-      return cellEdgeList_[cellId].size();
+      return cellEdgeData_.size(cellId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *getCellEdges() override {
 
+      if(cellEdgeList_.empty())
+        cellEdgeData_.copyTo(cellEdgeList_, threadNumber_);
       return &cellEdgeList_;
     }
 
@@ -58,27 +65,29 @@ namespace ttk {
                                const int &localNeighborId,
                                SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighborData_.size()))
         return -1;
       if((localNeighborId < 0)
-         || (localNeighborId >= (SimplexId)cellNeighborList_[cellId].size()))
+         || (localNeighborId >= cellNeighborData_.size(cellId)))
         return -2;
 #endif
-      neighborId = cellNeighborList_[cellId][localNeighborId];
+      neighborId = cellNeighborData_.get(cellId, localNeighborId);
       return 0;
     }
 
     inline SimplexId
       getCellNeighborNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighborData_.size()))
         return -1;
 #endif
-      return cellNeighborList_[cellId].size();
+      return cellNeighborData_.size(cellId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getCellNeighbors() override {
+      if(cellNeighborList_.empty())
+        cellNeighborData_.copyTo(cellNeighborList_, threadNumber_);
       return &cellNeighborList_;
     }
 
@@ -87,13 +96,13 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)cellTriangleList_[cellId].size()))
+         || (localTriangleId >= cellTriangleData_.size(cellId)))
         return -2;
 #endif
-      triangleId = cellTriangleList_[cellId][localTriangleId];
+      triangleId = cellTriangleData_.get(cellId, localTriangleId);
 
       return 0;
     }
@@ -102,16 +111,18 @@ namespace ttk {
       getCellTriangleNumber(const SimplexId &cellId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangleData_.size()))
         return -1;
 #endif
 
-      return cellTriangleList_[cellId].size();
+      return cellTriangleData_.size(cellId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getCellTriangles() override {
 
+      if(cellTriangleList_.empty())
+        cellTriangleData_.copyTo(cellTriangleList_, threadNumber_);
       return &cellTriangleList_;
     }
 
@@ -157,26 +168,38 @@ namespace ttk {
                            const int &localLinkId,
                            SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeList_.size()))
         return -1;
-      if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)edgeLinkList_[edgeId].size()))
+#endif
+      SimplexId row;
+      const FlatJaggedArray *links
+        = getRelationTable(edgeLinkData_, edgeLinkRelation, edgeId, row);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((localLinkId < 0) || (localLinkId >= links->size(row)))
         return -2;
 #endif
-      linkId = edgeLinkList_[edgeId][localLinkId];
+      linkId = links->get(row, localLinkId);
       return 0;
     }
 
     inline SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeList_.size()))
         return -1;
 #endif
-      return edgeLinkList_[edgeId].size();
+      SimplexId row;
+      return getRelationTable(edgeLinkData_, edgeLinkRelation, edgeId, row)
+        ->size(row);
     }
 
     inline const std::vector<std::vector<SimplexId>> *getEdgeLinks() override {
 
+      if(edgeLinkList_.empty()) {
+        warnLazyCopy("getEdgeLinks()", "getEdgeLink()");
+        if(edgeLinkData_.empty())
+          preprocessEagerly(&ExplicitTriangulation::preprocessEdgeLinks);
+        edgeLinkData_.copyTo(edgeLinkList_, threadNumber_);
+      }
       return &edgeLinkList_;
     }
 
@@ -184,25 +207,36 @@ namespace ttk {
                            const int &localStarId,
                            SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeList_.size()))
         return -1;
-      if((localStarId < 0)
-         || (localStarId >= (SimplexId)edgeStarList_[edgeId].size()))
+#endif
+      SimplexId row;
+      const FlatJaggedArray *stars
+        = getRelationTable(edgeStarData_, edgeStarRelation, edgeId, row);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((localStarId < 0) || (localStarId >= stars->size(row)))
         return -2;
 #endif
-      starId = edgeStarList_[edgeId][localStarId];
+      starId = stars->get(row, localStarId);
       return 0;
     }
 
     inline SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeList_.size()))
         return -1;
 #endif
-      return edgeStarList_[edgeId].size();
+      SimplexId row;
+      return getRelationTable(edgeStarData_, edgeStarRelation, edgeId, row)
+        ->size(row);
     }
 
     inline const std::vector<std::vector<SimplexId>> *getEdgeStars() override {
+      if(edgeStarList_.empty()) {
+        warnLazyCopy("getEdgeStars()", "getEdgeStar()");
+        preprocessEdgeStarData();
+        edgeStarData_.copyTo(edgeStarList_, threadNumber_);
+      }
       return &edgeStarList_;
     }
 
@@ -211,14 +245,14 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)edgeTriangleList_[edgeId].size()))
+         || (localTriangleId >= edgeTriangleData_.size(edgeId)))
         return -2;
 #endif
 
-      triangleId = edgeTriangleList_[edgeId][localTriangleId];
+      triangleId = edgeTriangleData_.get(edgeId, localTriangleId);
 
       return 0;
     }
@@ -227,16 +261,18 @@ namespace ttk {
       getEdgeTriangleNumber(const SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangleData_.size()))
         return -1;
 #endif
 
-      return edgeTriangleList_[edgeId].size();
+      return edgeTriangleData_.size(edgeId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getEdgeTriangles() override {
 
+      if(edgeTriangleList_.empty())
+        edgeTriangleData_.copyTo(edgeTriangleList_, threadNumber_);
       return &edgeTriangleList_;
     }
 
@@ -265,7 +301,7 @@ namespace ttk {
     }
 
     inline SimplexId getNumberOfTriangles() const override {
-      return triangleList_.size();
+      return triangleVertexData_.size();
     }
 
     inline SimplexId getNumberOfVertices() const override {
@@ -273,6 +309,8 @@ namespace ttk {
     }
 
     inline const std::vector<std::vector<SimplexId>> *getTriangles() override {
+      if(triangleList_.empty())
+        triangleVertexData_.copyTo(triangleList_, threadNumber_);
       return &triangleList_;
     }
 
@@ -282,13 +320,13 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdgeData_.size()))
         return -1;
       if((localEdgeId < 0) || (localEdgeId > 2))
         return -2;
 #endif
 
-      edgeId = triangleEdgeList_[triangleId][localEdgeId];
+      edgeId = triangleEdgeData_.get(triangleId, localEdgeId);
 
       return 0;
     }
@@ -298,16 +336,18 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdgeData_.size()))
         return -1;
 #endif
 
-      return triangleEdgeList_[triangleId].size();
+      return triangleEdgeData_.size(triangleId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleEdges() override {
 
+      if(triangleEdgeList_.empty())
+        triangleEdgeData_.copyTo(triangleEdgeList_, threadNumber_);
       return &triangleEdgeList_;
     }
 
@@ -315,29 +355,40 @@ namespace ttk {
                                const int &localLinkId,
                                SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+      if((triangleId < 0) || (triangleId >= triangleVertexData_.size()))
         return -1;
-      if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)triangleLinkList_[triangleId].size()))
+#endif
+      SimplexId row;
+      const FlatJaggedArray *links = getRelationTable(
+        triangleLinkData_, triangleLinkRelation, triangleId, row);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((localLinkId < 0) || (localLinkId >= links->size(row)))
         return -2;
 #endif
-      linkId = triangleLinkList_[triangleId][localLinkId];
+      linkId = links->get(row, localLinkId);
       return 0;
     }
 
     inline SimplexId
       getTriangleLinkNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+      if((triangleId < 0) || (triangleId >= triangleVertexData_.size()))
         return -1;
 #endif
-      return triangleLinkList_[triangleId].size();
+      SimplexId row;
+      return getRelationTable(
+               triangleLinkData_, triangleLinkRelation, triangleId, row)
+        ->size(row);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleLinks() override {
+      if(triangleLinkList_.empty()) {
+        warnLazyCopy("getTriangleLinks()", "getTriangleLink()");
+        if(triangleLinkData_.empty())
+          preprocessEagerly(&ExplicitTriangulation::preprocessTriangleLinks);
+        triangleLinkData_.copyTo(triangleLinkList_, threadNumber_);
+      }
       return &triangleLinkList_;
     }
 
@@ -346,13 +397,13 @@ namespace ttk {
                                SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStarData_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)triangleStarList_[triangleId].size()))
+         || (localStarId >= triangleStarData_.size(triangleId)))
         return -2;
 #endif
-      starId = triangleStarList_[triangleId][localStarId];
+      starId = triangleStarData_.get(triangleId, localStarId);
       return 0;
     }
 
@@ -360,14 +411,16 @@ namespace ttk {
       getTriangleStarNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStarData_.size()))
         return -1;
 #endif
-      return triangleStarList_[triangleId].size();
+      return triangleStarData_.size(triangleId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleStars() override {
+      if(triangleStarList_.empty())
+        triangleStarData_.copyTo(triangleStarList_, threadNumber_);
       return &triangleStarList_;
     }
 
@@ -375,13 +428,13 @@ namespace ttk {
                                  const int &localVertexId,
                                  SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0) || (triangleId >= (SimplexId)triangleList_.size()))
+      if((triangleId < 0) || (triangleId >= triangleVertexData_.size()))
         return -1;
       if((localVertexId < 0)
-         || (localVertexId >= (SimplexId)triangleList_[triangleId].size()))
+         || (localVertexId >= triangleVertexData_.size(triangleId)))
         return -2;
 #endif
-      vertexId = triangleList_[triangleId][localVertexId];
+      vertexId = triangleVertexData_.get(triangleId, localVertexId);
       return 0;
     }
 
@@ -389,13 +442,13 @@ namespace ttk {
                              const int &localEdgeId,
                              SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdgeData_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)vertexEdgeList_[vertexId].size()))
+         || (localEdgeId >= vertexEdgeData_.size(vertexId)))
         return -2;
 #endif
-      edgeId = vertexEdgeList_[vertexId][localEdgeId];
+      edgeId = vertexEdgeData_.get(vertexId, localEdgeId);
       return 0;
     }
 
@@ -403,14 +456,16 @@ namespace ttk {
       getVertexEdgeNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdgeData_.size()))
         return -1;
 #endif
-      return vertexEdgeList_[vertexId].size();
+      return vertexEdgeData_.size(vertexId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexEdges() override {
+      if(vertexEdgeList_.empty())
+        vertexEdgeData_.copyTo(vertexEdgeList_, threadNumber_);
       return &vertexEdgeList_;
     }
 
@@ -419,13 +474,17 @@ namespace ttk {
                              SimplexId &linkId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
-      if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)vertexLinkList_[vertexId].size()))
+#endif
+      SimplexId row;
+      const FlatJaggedArray *links
+        = getRelationTable(vertexLinkData_, vertexLinkRelation, vertexId, row);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((localLinkId < 0) || (localLinkId >= links->size(row)))
         return -2;
 #endif
-      linkId = vertexLinkList_[vertexId][localLinkId];
+      linkId = links->get(row, localLinkId);
 
       return 0;
     }
@@ -433,14 +492,23 @@ namespace ttk {
     inline SimplexId
       getVertexLinkNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
 #endif
-      return vertexLinkList_[vertexId].size();
+      SimplexId row;
+      return getRelationTable(
+               vertexLinkData_, vertexLinkRelation, vertexId, row)
+        ->size(row);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexLinks() override {
+      if(vertexLinkList_.empty()) {
+        warnLazyCopy("getVertexLinks()", "getVertexLink()");
+        if(vertexLinkData_.empty())
+          preprocessEagerly(&ExplicitTriangulation::preprocessVertexLinks);
+        vertexLinkData_.copyTo(vertexLinkList_, threadNumber_);
+      }
       return &vertexLinkList_;
     }
 
@@ -448,14 +516,14 @@ namespace ttk {
                                  const int &localNeighborId,
                                  SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexNeighborList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexNeighborData_.size()))
         return -1;
       if((localNeighborId < 0)
          || (localNeighborId
-             >= (SimplexId)vertexNeighborList_[vertexId].size()))
+             >= vertexNeighborData_.size(vertexId)))
         return -2;
 #endif
-      neighborId = vertexNeighborList_[vertexId][localNeighborId];
+      neighborId = vertexNeighborData_.get(vertexId, localNeighborId);
       return 0;
     }
 
@@ -465,11 +533,13 @@ namespace ttk {
       if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
 #endif
-      return vertexNeighborList_[vertexId].size();
+      return vertexNeighborData_.size(vertexId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexNeighbors() override {
+      if(vertexNeighborList_.empty())
+        vertexNeighborData_.copyTo(vertexNeighborList_, threadNumber_);
       return &vertexNeighborList_;
     }
 
@@ -500,27 +570,29 @@ namespace ttk {
                              const int &localStarId,
                              SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStarData_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)vertexStarList_[vertexId].size()))
+         || (localStarId >= vertexStarData_.size(vertexId)))
         return -2;
 #endif
-      starId = vertexStarList_[vertexId][localStarId];
+      starId = vertexStarData_.get(vertexId, localStarId);
       return 0;
     }
 
     inline SimplexId
       getVertexStarNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStarData_.size()))
         return -1;
 #endif
-      return vertexStarList_[vertexId].size();
+      return vertexStarData_.size(vertexId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexStars() override {
+      if(vertexStarList_.empty())
+        vertexStarData_.copyTo(vertexStarList_, threadNumber_);
       return &vertexStarList_;
     }
 
@@ -529,14 +601,14 @@ namespace ttk {
                                  SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
          || (localTriangleId
-             >= (SimplexId)vertexTriangleList_[vertexId].size()))
+             >= vertexTriangleData_.size(vertexId)))
         return -2;
 #endif
-      triangleId = vertexTriangleList_[vertexId][localTriangleId];
+      triangleId = vertexTriangleData_.get(vertexId, localTriangleId);
       return 0;
     }
 
@@ -544,15 +616,17 @@ namespace ttk {
       getVertexTriangleNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangleData_.size()))
         return -1;
 #endif
-      return vertexTriangleList_[vertexId].size();
+      return vertexTriangleData_.size(vertexId);
     }
 
     inline const std::vector<std::vector<SimplexId>> *
       getVertexTriangles() override {
 
+      if(vertexTriangleList_.empty())
+        vertexTriangleData_.copyTo(vertexTriangleList_, threadNumber_);
       return &vertexTriangleList_;
     }
 
@@ -573,15 +647,15 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedCellEdges() const override {
-      return (cellEdgeList_.size() != 0);
+      return (cellEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedCellNeighbors() const override {
-      return (cellNeighborList_.size() != 0);
+      return (cellNeighborData_.size() != 0);
     }
 
     inline bool hasPreprocessedCellTriangles() const override {
-      return (cellTriangleList_.size() != 0);
+      return (cellTriangleData_.size() != 0);
     }
 
     inline bool hasPreprocessedEdges() const override {
@@ -589,51 +663,55 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedEdgeLinks() const override {
-      return (edgeLinkList_.size() != 0);
+      // in lazy mode, the table is filled by blocks upon request
+      return (edgeLinkData_.size() != 0) || (hasPreprocessedEdgeLinks_);
     }
 
     inline bool hasPreprocessedEdgeStars() const override {
-      return (edgeStarList_.size() != 0);
+      // in lazy mode, the table is filled by blocks upon request
+      return (edgeStarData_.size() != 0) || (hasPreprocessedEdgeStars_);
     }
 
     inline bool hasPreprocessedEdgeTriangles() const override {
-      return (edgeTriangleList_.size() != 0);
+      return (edgeTriangleData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangles() const override {
-      return (triangleList_.size() != 0);
+      return (triangleVertexData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangleEdges() const override {
-      return (triangleEdgeList_.size() != 0);
+      return (triangleEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangleLinks() const override {
-      return (triangleLinkList_.size() != 0);
+      // in lazy mode, the table is filled by blocks upon request
+      return (triangleLinkData_.size() != 0) || (hasPreprocessedTriangleLinks_);
     }
 
     inline bool hasPreprocessedTriangleStars() const override {
-      return (triangleStarList_.size() != 0);
+      return (triangleStarData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexEdges() const override {
-      return (vertexEdgeList_.size() != 0);
+      return (vertexEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexLinks() const override {
-      return (vertexLinkList_.size() != 0);
+      // in lazy mode, the table is filled by blocks upon request
+      return (vertexLinkData_.size() != 0) || (hasPreprocessedVertexLinks_);
     }
 
     inline bool hasPreprocessedVertexNeighbors() const override {
-      return (vertexNeighborList_.size() != 0);
+      return (vertexNeighborData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexStars() const override {
-      return (vertexStarList_.size() != 0);
+      return (vertexStarData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexTriangles() const override {
-      return (vertexTriangleList_.size() != 0);
+      return (vertexTriangleData_.size() != 0);
     }
 
     inline bool isEdgeOnBoundary(const SimplexId &edgeId) const override {
@@ -677,9 +755,9 @@ namespace ttk {
       boundaryEdges_.resize(edgeList_.size(), false);
 
       if(getDimensionality() == 2) {
-        preprocessEdgeStars();
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        preprocessEdgeStarData();
+        for(SimplexId i = 0; i < edgeStarData_.size(); i++) {
+          if(edgeStarData_.size(i) == 1) {
             boundaryEdges_[i] = true;
           }
         }
@@ -687,10 +765,10 @@ namespace ttk {
         preprocessTriangleStars();
         preprocessTriangleEdges();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
             for(int j = 0; j < 3; j++) {
-              boundaryEdges_[triangleEdgeList_[i][j]] = true;
+              boundaryEdges_[triangleEdgeData_.get(i, j)] = true;
             }
           }
         }
@@ -712,18 +790,19 @@ namespace ttk {
         return 0;
 
       if((!boundaryTriangles_.empty())
-         && (boundaryTriangles_.size() == triangleList_.size())) {
+         && ((SimplexId)boundaryTriangles_.size()
+             == triangleVertexData_.size())) {
         return 0;
       }
 
       preprocessTriangles();
-      boundaryTriangles_.resize(triangleList_.size(), false);
+      boundaryTriangles_.resize(triangleVertexData_.size(), false);
 
       if(getDimensionality() == 3) {
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
             boundaryTriangles_[i] = true;
           }
         }
@@ -752,17 +831,17 @@ namespace ttk {
       // look for singletons
       if(getDimensionality() == 1) {
         preprocessVertexStars();
-        for(SimplexId i = 0; i < (SimplexId)vertexStarList_.size(); i++) {
-          if(vertexStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < vertexStarData_.size(); i++) {
+          if(vertexStarData_.size(i) == 1) {
             boundaryVertices_[i] = true;
           }
         }
       } else if(getDimensionality() == 2) {
         preprocessEdges();
-        preprocessEdgeStars();
+        preprocessEdgeStarData();
 
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < edgeStarData_.size(); i++) {
+          if(edgeStarData_.size(i) == 1) {
             boundaryVertices_[edgeList_[i].first] = true;
             boundaryVertices_[edgeList_[i].second] = true;
           }
@@ -771,11 +850,11 @@ namespace ttk {
         preprocessTriangles();
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
-            boundaryVertices_[triangleList_[i][0]] = true;
-            boundaryVertices_[triangleList_[i][1]] = true;
-            boundaryVertices_[triangleList_[i][2]] = true;
+        for(SimplexId i = 0; i < triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
+            boundaryVertices_[triangleVertexData_.get(i, 0)] = true;
+            boundaryVertices_[triangleVertexData_.get(i, 1)] = true;
+            boundaryVertices_[triangleVertexData_.get(i, 2)] = true;
           }
         }
       } else {
@@ -792,14 +871,15 @@ namespace ttk {
 
     inline int preprocessCellEdges() override {
 
-      if(!cellEdgeList_.size()) {
+      if(!cellEdgeData_.size()) {
 
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         threeSkeleton.buildCellEdges(vertexNumber_, cellNumber_, cellArray_,
-                                     cellEdgeList_, &edgeList_,
-                                     &vertexEdgeList_);
+                                     cellEdgeData_, &edgeList_,
+                                     &vertexEdgeData_);
+        compactTables();
       }
 
       return 0;
@@ -807,14 +887,15 @@ namespace ttk {
 
     inline int preprocessCellNeighbors() override {
 
-      if(!cellNeighborList_.size()) {
+      if(!cellNeighborData_.size()) {
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         // choice here (for the more likely)
         threeSkeleton.buildCellNeighborsFromVertices(
-          vertexNumber_, cellNumber_, cellArray_, cellNeighborList_,
-          &vertexStarList_);
+          vertexNumber_, cellNumber_, cellArray_, cellNeighborData_,
+          &vertexStarData_);
+        compactTables();
       }
 
       return 0;
@@ -822,36 +903,37 @@ namespace ttk {
 
     inline int preprocessCellTriangles() override {
 
-      if(!cellTriangleList_.size()) {
+      if(!cellTriangleData_.size()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        if(triangleList_.size()) {
+        if(triangleVertexData_.size()) {
           // we already computed this guy, let's just get the cell triangles
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, NULL, NULL,
-                                                 &cellTriangleList_);
+          if(triangleStarData_.size()) {
+            return compactTables(
+              twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
+                                            cellArray_, NULL, NULL,
+                                            &cellTriangleData_));
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, NULL, &triangleStarList_,
-              &cellTriangleList_);
+            return compactTables(twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, NULL, &triangleStarData_,
+              &cellTriangleData_));
           }
         } else {
           // we have not computed this guy, let's do it while we're at it
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, &triangleList_,
-                                                 NULL, &cellTriangleList_);
+          if(triangleStarData_.size()) {
+            return compactTables(twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, &triangleVertexData_,
+              NULL, &cellTriangleData_));
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, &triangleList_,
-              &triangleStarList_, &cellTriangleList_);
+            return compactTables(twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, &triangleVertexData_,
+              &triangleStarData_, &cellTriangleData_));
           }
         }
       }
@@ -873,25 +955,37 @@ namespace ttk {
 
     inline int preprocessEdgeLinks() override {
 
-      if(!edgeLinkList_.size()) {
+      if(!edgeLinkData_.size()) {
 
         if(getDimensionality() == 2) {
           preprocessEdges();
+          // in lazy mode, the blocks of edge links use the blocks of edge
+          // stars
           preprocessEdgeStars();
 
+          if(lazyMode_) {
+            hasPreprocessedEdgeLinks_ = true;
+            return 0;
+          }
+
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, cellArray_, edgeLinkList_);
+          return compactTables(oneSkeleton.buildEdgeLinks(
+            edgeList_, edgeStarData_, cellArray_, edgeLinkData_));
         } else if(getDimensionality() == 3) {
           preprocessEdges();
           preprocessEdgeStars();
           preprocessCellEdges();
 
+          if(lazyMode_) {
+            hasPreprocessedEdgeLinks_ = true;
+            return 0;
+          }
+
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, cellEdgeList_, edgeLinkList_);
+          return compactTables(oneSkeleton.buildEdgeLinks(
+            edgeList_, edgeStarData_, cellEdgeData_, edgeLinkData_));
         } else {
           // unsupported dimension
           std::stringstream msg;
@@ -907,19 +1001,19 @@ namespace ttk {
 
     inline int preprocessEdgeStars() override {
 
-      if(!edgeStarList_.size()) {
-        OneSkeleton oneSkeleton;
-        oneSkeleton.setWrapper(this);
-        return oneSkeleton.buildEdgeStars(vertexNumber_, cellNumber_,
-                                          cellArray_, edgeStarList_, &edgeList_,
-                                          &vertexStarList_);
+      if((lazyMode_) && (!edgeStarData_.size())) {
+        preprocessEdges();
+        preprocessVertexStars();
+        hasPreprocessedEdgeStars_ = true;
+        return 0;
       }
-      return 0;
+
+      return preprocessEdgeStarData();
     }
 
     inline int preprocessEdgeTriangles() override {
 
-      if(!edgeTriangleList_.size()) {
+      if(!edgeTriangleData_.size()) {
 
         // WARNING
         // here vertexStarList and triangleStarList will be computed (for
@@ -928,10 +1022,10 @@ namespace ttk {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildEdgeTriangles(
-          vertexNumber_, cellNumber_, cellArray_, edgeTriangleList_,
-          &vertexStarList_, &edgeList_, &edgeStarList_, &triangleList_,
-          &triangleStarList_, &cellTriangleList_);
+        return compactTables(twoSkeleton.buildEdgeTriangles(
+          vertexNumber_, cellNumber_, cellArray_, edgeTriangleData_,
+          &vertexStarData_, &edgeList_, &edgeStarData_, &triangleVertexData_,
+          &triangleStarData_, &cellTriangleData_));
       }
 
       return 0;
@@ -939,14 +1033,15 @@ namespace ttk {
 
     inline int preprocessTriangles() override {
 
-      if(!triangleList_.size()) {
+      if(!triangleVertexData_.size()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
         twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_, cellArray_,
-                                      &triangleList_, &triangleStarList_,
-                                      &cellTriangleList_);
+                                      &triangleVertexData_, &triangleStarData_,
+                                      &cellTriangleData_);
+        compactTables();
       }
 
       return 0;
@@ -954,7 +1049,7 @@ namespace ttk {
 
     inline int preprocessTriangleEdges() override {
 
-      if(!triangleEdgeList_.size()) {
+      if(!triangleEdgeData_.size()) {
 
         // WARNING
         // here triangleStarList and cellTriangleList will be computed (for
@@ -964,10 +1059,10 @@ namespace ttk {
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        return twoSkeleton.buildTriangleEdgeList(
-          vertexNumber_, cellNumber_, cellArray_, triangleEdgeList_,
-          &vertexEdgeList_, &edgeList_, &triangleList_, &triangleStarList_,
-          &cellTriangleList_);
+        return compactTables(twoSkeleton.buildTriangleEdgeList(
+          vertexNumber_, cellNumber_, cellArray_, triangleEdgeData_,
+          &vertexEdgeData_, &edgeList_, &triangleVertexData_,
+          &triangleStarData_, &cellTriangleData_));
       }
 
       return 0;
@@ -975,14 +1070,20 @@ namespace ttk {
 
     inline int preprocessTriangleLinks() override {
 
-      if(!triangleLinkList_.size()) {
+      if(!triangleLinkData_.size()) {
 
         preprocessTriangleStars();
 
+        if(lazyMode_) {
+          hasPreprocessedTriangleLinks_ = true;
+          return 0;
+        }
+
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleLinks(
-          triangleList_, triangleStarList_, cellArray_, triangleLinkList_);
+        return compactTables(twoSkeleton.buildTriangleLinks(
+          triangleVertexData_, triangleStarData_, cellArray_,
+          triangleLinkData_));
       }
 
       return 0;
@@ -990,13 +1091,13 @@ namespace ttk {
 
     inline int preprocessTriangleStars() override {
 
-      if(!triangleStarList_.size()) {
+      if(!triangleStarData_.size()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                             cellArray_, &triangleList_,
-                                             &triangleStarList_);
+        return compactTables(twoSkeleton.buildTriangleList(
+          vertexNumber_, cellNumber_, cellArray_, &triangleVertexData_,
+          &triangleStarData_));
       }
 
       return 0;
@@ -1004,7 +1105,7 @@ namespace ttk {
 
     inline int preprocessVertexEdges() override {
 
-      if((SimplexId)vertexEdgeList_.size() != vertexNumber_) {
+      if(vertexEdgeData_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
 
         if(!edgeList_.size()) {
@@ -1015,32 +1116,43 @@ namespace ttk {
         }
 
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexEdges(
-          vertexNumber_, edgeList_, vertexEdgeList_);
+        return compactTables(zeroSkeleton.buildVertexEdges(
+          vertexNumber_, edgeList_, vertexEdgeData_));
       }
       return 0;
     }
 
     inline int preprocessVertexLinks() override {
 
-      if((SimplexId)vertexLinkList_.size() != vertexNumber_) {
+      if(vertexLinkData_.size() != vertexNumber_) {
 
         if(getDimensionality() == 2) {
           preprocessVertexStars();
           preprocessCellEdges();
 
+          if(lazyMode_) {
+            hasPreprocessedVertexLinks_ = true;
+            return 0;
+          }
+
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellEdgeList_, edgeList_, vertexLinkList_);
+          return compactTables(zeroSkeleton.buildVertexLinks(
+            vertexStarData_, cellEdgeData_, edgeList_, vertexLinkData_));
         } else if(getDimensionality() == 3) {
           preprocessVertexStars();
           preprocessCellTriangles();
 
+          if(lazyMode_) {
+            hasPreprocessedVertexLinks_ = true;
+            return 0;
+          }
+
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellTriangleList_, triangleList_, vertexLinkList_);
+          return compactTables(zeroSkeleton.buildVertexLinks(
+            vertexStarData_, cellTriangleData_, triangleVertexData_,
+            vertexLinkData_));
         } else {
           // unsupported dimension
           std::stringstream msg;
@@ -1055,31 +1167,31 @@ namespace ttk {
 
     inline int preprocessVertexNeighbors() override {
 
-      if((SimplexId)vertexNeighborList_.size() != vertexNumber_) {
+      if(vertexNeighborData_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexNeighbors(
-          vertexNumber_, cellNumber_, cellArray_, vertexNeighborList_,
-          &edgeList_);
+        return compactTables(zeroSkeleton.buildVertexNeighbors(
+          vertexNumber_, cellNumber_, cellArray_, vertexNeighborData_,
+          &edgeList_));
       }
       return 0;
     }
 
     inline int preprocessVertexStars() override {
 
-      if((SimplexId)vertexStarList_.size() != vertexNumber_) {
+      if(vertexStarData_.size() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
 
-        return zeroSkeleton.buildVertexStars(
-          vertexNumber_, cellNumber_, cellArray_, vertexStarList_);
+        return compactTables(zeroSkeleton.buildVertexStars(
+          vertexNumber_, cellNumber_, cellArray_, vertexStarData_));
       }
       return 0;
     }
 
     inline int preprocessVertexTriangles() override {
 
-      if((SimplexId)vertexTriangleList_.size() != vertexNumber_) {
+      if(vertexTriangleData_.size() != vertexNumber_) {
 
         preprocessTriangles();
 
@@ -1087,7 +1199,8 @@ namespace ttk {
         twoSkeleton.setWrapper(this);
 
         twoSkeleton.buildVertexTriangles(
-          vertexNumber_, triangleList_, vertexTriangleList_);
+          vertexNumber_, triangleVertexData_, vertexTriangleData_);
+        compactTables();
       }
 
       return 0;
@@ -1118,13 +1231,224 @@ namespace ttk {
       return 0;
     }
 
+    /// Get a hash of the input cells (and of the number of vertices), which
+    /// identifies the triangulation in its cache files (see writeToFile()).
+    /// It can be used to name these files.
+    /// \pre setInputPoints() and setInputCells() need to be called first.
+    unsigned long long getCellsHash() const;
+
+    /// Load the relations pre-processed by a previous execution on the same
+    /// input cells, from a file written by writeToFile(). The relation tables
+    /// are memory-mapped from the file, without copy. The relations which
+    /// have already been pre-processed are left untouched. Only one cache
+    /// file can be loaded until the next call to clear().
+    /// \pre setInputPoints() and setInputCells() need to be called first.
+    /// \param fileName Path to the cache file.
+    /// \return Returns 0 upon success, negative values if the file cannot be
+    /// read, or was written by another version or for other input cells.
+    int readFromFile(const std::string &fileName);
+
+    /// Write all the pre-processed relations (edges, triangles, stars,
+    /// links, boundary flags, etc.) to a versioned binary cache file, to be
+    /// loaded by later executions on the same input cells with
+    /// readFromFile().
+    /// \param fileName Path to the cache file.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int writeToFile(const std::string &fileName) const;
+
+    /// Identifier in the input of the \p cellId-th cell (see
+    /// reorderInput()).
+    inline SimplexId getInputCellId(const SimplexId &cellId) const {
+      return inputCellIds_.empty() ? cellId : inputCellIds_[cellId];
+    }
+
+    /// Identifier in the input of the \p vertexId-th vertex (see
+    /// reorderInput()).
+    inline SimplexId getInputVertexId(const SimplexId &vertexId) const {
+      return inputVertexIds_.empty() ? vertexId : inputVertexIds_[vertexId];
+    }
+
+    /// Identifier in the triangulation of the \p inputCellId-th input cell
+    /// (see reorderInput()).
+    inline SimplexId getReorderedCellId(const SimplexId &inputCellId) const {
+      return reorderedCellIds_.empty() ? inputCellId
+                                       : reorderedCellIds_[inputCellId];
+    }
+
+    /// Identifier in the triangulation of the \p inputVertexId-th input
+    /// vertex (see reorderInput()).
+    inline SimplexId
+      getReorderedVertexId(const SimplexId &inputVertexId) const {
+      return reorderedVertexIds_.empty() ? inputVertexId
+                                         : reorderedVertexIds_[inputVertexId];
+    }
+
+    /// Returns true if the input has been reordered (see reorderInput()).
+    inline bool isReordered() const {
+      return !inputVertexIds_.empty();
+    }
+
+    /// Renumber the vertices along a Hilbert space-filling curve, and the
+    /// cells by increasing smallest vertex, to improve the memory locality
+    /// of the traversals. The triangulation then works on internal copies
+    /// of the input points and cells.
+    ///
+    /// All the identifiers used by the traversal functions then refer to
+    /// the reordered vertices and cells. Per-vertex input data (scalar
+    /// fields, offsets) need to be permuted with reorderVertexData() and
+    /// the results mapped back with getInputVertexId() and
+    /// getInputCellId().
+    /// \pre setInputPoints() and setInputCells() need to be called first,
+    /// before any pre-processing.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int reorderInput();
+
+    /// Permute per-vertex input data (for instance a scalar field) into the
+    /// vertex order of the triangulation (see reorderInput()).
+    /// \param inputData Input data, in the input vertex order.
+    /// \param data Output data (with the same size as \p inputData).
+    /// \param componentNumber Number of components per vertex.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType>
+    inline int reorderVertexData(const dataType *inputData,
+                                 dataType *data,
+                                 const int &componentNumber = 1) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((!inputData) || (!data) || (inputData == data))
+        return -1;
+#endif
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+      for(SimplexId i = 0; i < vertexNumber_; i++) {
+        const SimplexId inputId = getInputVertexId(i);
+        for(int j = 0; j < componentNumber; j++) {
+          data[i * componentNumber + j]
+            = inputData[inputId * componentNumber + j];
+        }
+      }
+
+      return 0;
+    }
+
   protected:
+    // relations which can be computed lazily, by blocks of simplices
+    enum LazyRelation {
+      edgeLinkRelation = 0,
+      edgeStarRelation,
+      triangleLinkRelation,
+      vertexLinkRelation
+    };
+
+    int buildLazyBlock(const LazyRelation &relation,
+                       const SimplexId &blockId,
+                       FlatJaggedArray &block) const;
+
     int clear();
 
+    // get the table storing the relation of the simplex simplexId (and the
+    // corresponding row in it): either the whole pre-processed table, or
+    // the block of the relation cache containing the simplex (lazy mode).
+    inline const FlatJaggedArray *
+      getRelationTable(const FlatJaggedArray &table,
+                       const LazyRelation &relation,
+                       const SimplexId &simplexId,
+                       SimplexId &row) const {
+
+      if(!table.empty()) {
+        row = simplexId;
+        return &table;
+      }
+
+      const SimplexId blockId = simplexId / lazyBlockSize_;
+      row = simplexId - blockId * lazyBlockSize_;
+      return relationCache_.get(
+        relation, blockId, [this, &relation, &blockId](FlatJaggedArray &block) {
+          buildLazyBlock(relation, blockId, block);
+        });
+    }
+
+    // the legacy get*s() functions pre-process a relation for the whole
+    // triangulation and copy it into vectors of vectors: in lazy mode, this
+    // costs twice the memory that the lazy mode was meant to save.
+    inline void warnLazyCopy(const char *function,
+                             const char *replacement) const {
+      if(lazyMode_) {
+        std::stringstream msg;
+        msg << "[ExplicitTriangulation] " << function << " copies the whole "
+            << "relation, ignoring the lazy mode: use " << replacement
+            << " instead." << std::endl;
+        dMsg(std::cerr, msg.str(), infoMsg);
+      }
+    }
+
+    // pre-process a relation for the whole triangulation, disregarding the
+    // lazy mode (for the legacy get*s() functions).
+    inline int preprocessEagerly(int (ExplicitTriangulation::*preprocess)()) {
+      const bool lazyMode = lazyMode_;
+      lazyMode_ = false;
+      const int ret = (this->*preprocess)();
+      lazyMode_ = lazyMode;
+      return ret;
+    }
+
+    // store the relation tables with narrow identifiers when their counts
+    // allow it (builds with 64-bit identifiers only). called after each
+    // pre-processing, forwards its return value.
+    inline int compactTables(const int &ret = 0) {
+#ifdef TTK_ENABLE_64BIT_IDS
+      for(const auto table : cacheTables_) {
+        (this->*table).compact();
+      }
+#endif
+      return ret;
+    }
+
+    // edge stars, for the whole triangulation (boundary queries are built
+    // from them, even in lazy mode).
+    inline int preprocessEdgeStarData() {
+      if(!edgeStarData_.size()) {
+        OneSkeleton oneSkeleton;
+        oneSkeleton.setWrapper(this);
+        return compactTables(oneSkeleton.buildEdgeStars(
+          vertexNumber_, cellNumber_, cellArray_, edgeStarData_, &edgeList_,
+          &vertexStarData_));
+      }
+      return 0;
+    }
+
+    // relation tables stored in the cache files (the index in this list
+    // identifies the table in the file, do not reorder)
+    static FlatJaggedArray ExplicitTriangulation::*const cacheTables_[15];
+
+    // memory-mapped cache file, shared by the copies of the triangulation
+    std::shared_ptr<MappedFile> cacheFile_;
+
+    // input reordering (see reorderInput()): user buffers, internal
+    // reordered copies (shared by the copies of the triangulation, which
+    // point to them) and permutations (empty if not reordered)
+    const void *inputPointSet_;
+    const LongSimplexId *inputCellArray_;
+    std::shared_ptr<std::vector<char>> reorderedPointSet_;
+    std::shared_ptr<std::vector<LongSimplexId>> reorderedCellArray_;
+    std::vector<SimplexId> inputCellIds_, inputVertexIds_, reorderedCellIds_,
+      reorderedVertexIds_;
+
     bool doublePrecision_;
-    SimplexId cellNumber_, vertexNumber_;
+    SimplexId cellNumber_, vertexNumber_, lazyBlockSize_;
     const void *pointSet_;
     const LongSimplexId *cellArray_;
+
+    // compressed (CSR) storage of the adjacency relations; the legacy
+    // std::vector<std::vector<SimplexId>> tables inherited from
+    // AbstractTriangulation are only filled on demand by the get*s() functions
+    FlatJaggedArray cellEdgeData_, cellNeighborData_, cellTriangleData_,
+      edgeLinkData_, edgeStarData_, edgeTriangleData_, triangleVertexData_,
+      triangleEdgeData_, triangleLinkData_, triangleStarData_, vertexEdgeData_,
+      vertexLinkData_, vertexNeighborData_, vertexStarData_,
+      vertexTriangleData_;
   };
 } // namespace ttk
 
@@ -0,0 +1,123 @@
+/// \ingroup base
+/// \class ttk::ftm::Arena
+/// \date October 2019.
+///
+/// \brief Chunked storage for objects sharing the lifetime of a tree.
+///
+/// Objects are constructed in place in large chunks instead of being
+/// allocated one by one, and are all destroyed (and their memory released)
+/// at once by clear() or by the destructor of the arena. The addresses of
+/// the objects are stable: chunks are never reallocated.
+///
+/// An arena is not thread-safe: objects have to be created by one task at a
+/// time.
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+  namespace ftm {
+
+    template <typename type>
+    class Arena {
+    private:
+      struct Chunk {
+        type *data;
+        std::size_t used, capacity;
+      };
+
+      std::allocator<type> allocator_;
+      std::vector<Chunk> chunks_;
+      // capacity of the first chunk, and of the next one
+      std::size_t initialChunkSize_, chunkSize_;
+      std::size_t size_;
+
+    public:
+      explicit Arena(const std::size_t chunkSize = 1024)
+        : initialChunkSize_(chunkSize ? chunkSize : 1),
+          chunkSize_(initialChunkSize_), size_(0) {
+      }
+
+      Arena(const Arena &) = delete;
+
+      Arena &operator=(const Arena &) = delete;
+
+      ~Arena() {
+        clear();
+      }
+
+      /// Construct an object with \p args in the arena.
+      template <typename... argsType>
+      type *create(argsType &&... args) {
+        if(chunks_.empty() || chunks_.back().used == chunks_.back().capacity) {
+          addChunk(chunkSize_);
+          // geometric growth: few chunks for any number of objects
+          chunkSize_ *= 2;
+        }
+
+        Chunk &chunk = chunks_.back();
+        type *object
+          = new(chunk.data + chunk.used) type(std::forward<argsType>(args)...);
+        ++chunk.used;
+        ++size_;
+        return object;
+      }
+
+      /// Make sure that the next \p nb objects are created in a single
+      /// chunk.
+      void reserve(const std::size_t nb) {
+        if(!chunks_.empty()
+           && chunks_.back().capacity - chunks_.back().used >= nb) {
+          return;
+        }
+        if(nb > chunkSize_) {
+          chunkSize_ = nb;
+        }
+        addChunk(chunkSize_);
+        chunkSize_ *= 2;
+      }
+
+      /// Destroy all the objects and release the memory. The next chunk gets
+      /// the initial capacity again.
+      void clear(void) {
+        for(auto &chunk : chunks_) {
+          for(std::size_t i = 0; i < chunk.used; ++i) {
+            chunk.data[i].~type();
+          }
+          allocator_.deallocate(chunk.data, chunk.capacity);
+        }
+        chunks_.clear();
+        chunkSize_ = initialChunkSize_;
+        size_ = 0;
+      }
+
+      /// Number of objects in the arena.
+      std::size_t size(void) const {
+        return size_;
+      }
+
+      /// Memory allocated by the arena (in bytes), without the memory
+      /// allocated by the objects themselves.
+      std::size_t footprint(void) const {
+        std::size_t bytes = chunks_.capacity() * sizeof(Chunk);
+        for(const auto &chunk : chunks_) {
+          bytes += chunk.capacity * sizeof(type);
+        }
+        return bytes;
+      }
+
+    private:
+      void addChunk(const std::size_t capacity) {
+        chunks_.push_back({allocator_.allocate(capacity), 0, capacity});
+      }
+    };
+
+  } // namespace ftm
+} // namespace ttk
+
+#endif /* end of include guard: ARENA_H */
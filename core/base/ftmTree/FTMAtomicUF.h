@@ -15,6 +15,7 @@
 #ifndef ATOMICUF_H
 #define ATOMICUF_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -26,8 +27,8 @@ namespace ttk {
 
     class AtomicUF {
     private:
-      unsigned rank_;
-      AtomicUF *parent_;
+      std::atomic<unsigned> rank_;
+      std::atomic<AtomicUF *> parent_;
       SharedData data_;
 
     public:
@@ -38,16 +39,14 @@ namespace ttk {
 
       // heavy recursif
       inline AtomicUF *find() {
-        if(parent_ == this)
+        AtomicUF *parent = parent_;
+        if(parent == this)
           return this;
         else {
-          decltype(parent_) tmp = parent_->find();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
+          AtomicUF *tmp = parent->find();
           parent_ = tmp;
 
-          return parent_;
+          return tmp;
         }
       }
 
@@ -128,16 +127,10 @@ namespace ttk {
       }
 
       inline void setRank(const int &rank) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         rank_ = rank;
       }
 
       inline void setParent(AtomicUF *parent) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         parent_ = parent;
       }
 
@@ -8,10 +8,9 @@
 #ifndef ATOMICVECTOR_H
 #define ATOMICVECTOR_H
 
-#ifdef TTK_ENABLE_OPENMP
-#include <omp.h>
-#endif // TTK_ENABLE_OPENMP
+#include <atomic>
 #include <iterator>
+#include <mutex>
 #include <vector>
 
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -23,10 +22,17 @@ namespace ttk {
   template <typename type>
   class AtomicVector : public std::vector<type> {
   private:
-    std::size_t nextId;
+    std::atomic<std::size_t> nextId;
     // for initialization
     const type defaultValue;
 
+    // serializes the growths of the vectors, which may be requested by
+    // concurrent tasks whatever the task runtime
+    static std::mutex &reserveMutex(void) {
+      static std::mutex mutex;
+      return mutex;
+    }
+
   public:
     AtomicVector(const std::size_t initSize = 1, const type &dv = type{})
       : std::vector<type>(), nextId(0), defaultValue{dv} {
@@ -44,7 +50,7 @@ namespace ttk {
 
     // copy constructor
     AtomicVector(const AtomicVector &other)
-      : std::vector<type>(other), nextId(other.nextId) {
+      : std::vector<type>(other), nextId(other.nextId.load()) {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(!std::vector<type>::size()) {
         reserve(1);
@@ -52,7 +58,10 @@ namespace ttk {
 #endif
     }
 
-    AtomicVector(AtomicVector &&other) = default;
+    AtomicVector(AtomicVector &&other)
+      : std::vector<type>(std::move(other)), nextId(other.nextId.load()),
+        defaultValue{other.defaultValue} {
+    }
 
     virtual ~AtomicVector() = default;
 
@@ -64,27 +73,15 @@ namespace ttk {
     // pre-allocated
     void reserve(const std::size_t &newSize) {
       if(newSize > std::vector<type>::size()) {
-#ifndef TTK_ENABLE_KAMIKAZE
-#ifdef TTK_ENABLE_OPENMP
-        if(omp_in_parallel()) {
-          // WARNING: In parallel we do not want to make reserve as it can lead
-          // to data race, we should not enter here
-#pragma omp critical(AtomicUFReserve)
-          { std::vector<type>::resize(newSize, defaultValue); }
-
-        } else
-#endif
-#endif
-        {
+        // WARNING: In parallel we do not want to make reserve as it can lead
+        // to data race, we should not enter here
+        std::lock_guard<std::mutex> lock(reserveMutex());
+        if(newSize > std::vector<type>::size())
           std::vector<type>::resize(newSize, defaultValue);
-        }
       }
     }
 
     void reset(const std::size_t &nId = 0) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
       nextId = nId;
     }
 
@@ -98,13 +95,9 @@ namespace ttk {
     }
 
     std::size_t getNext(void) {
-      std::size_t resId;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-      resId = nextId++;
+      const std::size_t resId = nextId++;
 
-      if(nextId == std::vector<type>::size()) {
+      if(resId + 1 == std::vector<type>::size()) {
         reserve(std::vector<type>::size() * 2);
       }
 
@@ -130,7 +123,8 @@ namespace ttk {
 
     AtomicVector<type> &operator=(const AtomicVector<type> &other) {
       std::vector<type>::operator=(other);
-      nextId = other.nextId;
+      nextId = other.nextId.load();
+      return *this;
     }
 
     // ---------
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 
 #include "FTMSegmentation.h"
 
@@ -26,74 +27,43 @@ using namespace ftm;
 // Segment
 // -------
 
-Segment::Segment(SimplexId size) : vertices_(size, nullVertex) {
+Segment::Segment(const segm_it &begin, const segm_it &end)
+  : begin_(begin), end_(end) {
 }
 
 segm_const_it Segment::begin(void) const {
-  return vertices_.begin();
+  return begin_;
 }
 
 segm_it Segment::begin(void) {
-  return vertices_.begin();
-}
-
-void Segment::createFromList(const Scalars *s,
-                             list<vector<SimplexId>> &regularList,
-                             const bool reverse) {
-  auto vectComp = [&](const vector<SimplexId> &a, const vector<SimplexId> &b) {
-    return s->isLower(a[0], b[0]);
-  };
-
-  SimplexId totalSize = 0;
-  for(const auto &vectReg : regularList) {
-    totalSize += vectReg.size();
-  }
-  vertices_.reserve(totalSize);
-  // TODO parallel
-  regularList.sort(vectComp);
-  // TODO parallel
-  if(reverse) {
-    for(auto it1 = regularList.cbegin(); it1 != regularList.cend(); ++it1) {
-      for(auto it2 = it1->crbegin(); it2 != it1->crend(); ++it2) {
-        vertices_.emplace_back(*it2);
-      }
-    }
-  } else {
-    for(auto it1 = regularList.cbegin(); it1 != regularList.cend(); ++it1) {
-      for(auto it2 = it1->cbegin(); it2 != it1->cend(); ++it2) {
-        vertices_.emplace_back(*it2);
-      }
-    }
-  }
-
-  regularList.clear();
+  return begin_;
 }
 
 segm_const_it Segment::end(void) const {
-  return vertices_.end();
+  return end_;
 }
 
 segm_it Segment::end(void) {
-  return vertices_.end();
+  return end_;
 }
 
 SimplexId Segment::operator[](const size_t &idx) const {
-  return vertices_[idx];
+  return begin_[idx];
 }
 
 SimplexId &Segment::operator[](const size_t &idx) {
-  return vertices_[idx];
+  return begin_[idx];
 }
 
 SimplexId Segment::size(void) const {
-  return vertices_.size();
+  return distance(begin_, end_);
 }
 
 void Segment::sort(const Scalars *s) {
   // Sort by scalar value
   auto comp = [&](SimplexId a, SimplexId b) { return s->isLower(a, b); };
 
-  std::sort(vertices_.begin(), vertices_.end(), comp);
+  std::sort(begin_, end_, comp);
 }
 
 // --------
@@ -105,6 +75,12 @@ Segments::Segments() {
 
 void Segments::clear(void) {
   segments_.clear();
+  vector<SimplexId>().swap(vertices_);
+}
+
+size_t Segments::footprint(void) const {
+  return vertices_.capacity() * sizeof(SimplexId)
+         + segments_.capacity() * sizeof(Segment);
 }
 
 const Segment &Segments::operator[](const size_t &idx) const {
@@ -122,9 +98,15 @@ void Segments::resize(const vector<SimplexId> &sizes) {
   }
 #endif
 
+  // one allocation for all the segments
+  vertices_.assign(accumulate(sizes.begin(), sizes.end(), (SimplexId)0),
+                   nullVertex);
+
   segments_.reserve(sizes.size());
+  segm_it segmentBegin = vertices_.begin();
   for(SimplexId size : sizes) {
-    segments_.emplace_back(size);
+    segments_.emplace_back(segmentBegin, segmentBegin + size);
+    segmentBegin += size;
   }
 }
 
@@ -132,25 +114,21 @@ idSegment Segments::size(void) const {
   return segments_.size();
 }
 
-void Segments::sortAll(const Scalars *s) {
+void Segments::sortAll(const Scalars *s, TaskRuntime *runtime) {
   const idSegment &nbSegments = size();
 
+  TaskGroup tasks(runtime);
   for(idSegment i = 0; i < nbSegments; i++) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(i)
-#endif
-    segments_[i].sort(s);
+    tasks.spawn([this, s, i] { segments_[i].sort(s); });
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
 }
 
 // ----------
 // Arc Region
 // ----------
 
-ArcRegion::ArcRegion() {
+ArcRegion::ArcRegion() : segmentation_(), segmentationSize_(0) {
 #ifndef TTK_ENABLE_KAMIKAZE
   segmented_ = false;
 #endif
@@ -170,25 +148,34 @@ void ArcRegion::concat(const ArcRegion &r) {
   }
 }
 
-void ArcRegion::createSegmentation(const Scalars *s) {
+void ArcRegion::createSegmentation(const Scalars *s,
+                                   const segm_it &segmentation) {
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(segmentation_.size()) {
+  if(segmentationSize_) {
     cout << "createSegmentation called on an already segmented region" << endl;
   }
 #endif
 
-  SimplexId totalSegmSize = 0;
+  segmentation_ = segmentation;
+  segmentationSize_ = 0;
+
+  // already sorted
+  if(segmentsIn_.size() == 1) {
+    const Region &region = segmentsIn_.front();
+    copy(region.segmentBegin, region.segmentEnd, segmentation_);
+    segmentationSize_ = distance(region.segmentBegin, region.segmentEnd);
+#ifndef TTK_ENABLE_KAMIKAZE
+    segmented_ = true;
+#endif
+    return;
+  }
+
   vector<segm_const_it> heads, ends;
   for(const auto &region : segmentsIn_) {
-    totalSegmSize += distance(region.segmentBegin, region.segmentEnd);
     heads.emplace_back(region.segmentBegin);
     ends.emplace_back(region.segmentEnd);
   }
 
-  segmentation_.clear();
-  segmentation_.reserve(
-    totalSegmSize); // max size, including discarded vertices
-
   idSegment nbSegments = heads.size();
   int added = 0;
 
@@ -214,7 +201,7 @@ void ArcRegion::createSegmentation(const Scalars *s) {
       }
     }
     if(added != -1) {
-      segmentation_.emplace_back(minVert);
+      segmentation_[segmentationSize_++] = minVert;
       ++heads[added];
     }
   } // end while
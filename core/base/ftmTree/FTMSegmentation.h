@@ -28,18 +28,15 @@ namespace ttk {
   namespace ftm {
 
     // one segment: like a vector<SimplexId>
-    // have a fixed size
+    // have a fixed size, view on the storage of Segments
     class Segment {
     private:
-      std::vector<SimplexId> vertices_;
+      segm_it begin_, end_;
 
     public:
-      Segment(SimplexId size);
+      Segment(const segm_it &begin, const segm_it &end);
 
       void sort(const Scalars *s);
-      void createFromList(const Scalars *s,
-                          std::list<std::vector<SimplexId>> &regularsList,
-                          const bool reverse);
 
       segm_const_it begin(void) const;
       segm_const_it end(void) const;
@@ -52,8 +49,11 @@ namespace ttk {
     };
 
     // All the segments of the mesh, like a vector<Segment>
+    // The vertices of all the segments are stored back to back in a single
+    // buffer, allocated once by resize
     class Segments {
     private:
+      std::vector<SimplexId> vertices_;
       std::vector<Segment> segments_;
 
     public:
@@ -64,8 +64,8 @@ namespace ttk {
       // add one vertex
       std::tuple<segm_it, segm_it> addLateSimpleSegment(SimplexId v);
 
-      // sort all segment (in parallel?)
-      void sortAll(const Scalars *s);
+      // sort all segment (one task of runtime per segment)
+      void sortAll(const Scalars *s, TaskRuntime *runtime);
 
       // callable once
       void resize(const std::vector<SimplexId> &sizes);
@@ -73,6 +73,8 @@ namespace ttk {
       // vector like
       idSegment size(void) const;
       void clear(void);
+      // memory used by the segments (in bytes)
+      size_t footprint(void) const;
       Segment &operator[](const size_t &idx);
       const Segment &operator[](const size_t &idx) const;
 
@@ -97,11 +99,13 @@ namespace ttk {
       // list of segment composing this segmentation and for each segment
       // the begin and the end inside it (as a segment may be subdivided)
       std::list<Region> segmentsIn_;
-      // when and how to compact ?
-      std::vector<SimplexId> segmentation_;
+      // sorted vertices of the region, stored in the segmentation buffer of
+      // the tree (see createSegmentation)
+      segm_it segmentation_;
+      SimplexId segmentationSize_;
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      // true if the segmentation have been sent to the segmentation_ vector
+      // true if the segmentation have been sent to the segmentation buffer
       bool segmented_;
 #endif
 
@@ -135,7 +139,7 @@ namespace ttk {
 
       void clear(void) {
         segmentsIn_.clear();
-        segmentation_.clear();
+        segmentationSize_ = 0;
       }
 
       // Put all segments in one vector in the arc
@@ -143,7 +147,9 @@ namespace ttk {
       // see Segments::sortAll
       // For Contour Tree segmentaion, you have to precise the current arc since
       // a segment can contain vertices for several arcs
-      void createSegmentation(const Scalars *s);
+      // The count() vertices are written from segmentation, which has to
+      // outlive the region
+      void createSegmentation(const Scalars *s, const segm_it &segmentation);
 
       inline SimplexId count(void) const {
         SimplexId res = 0;
@@ -185,7 +191,7 @@ namespace ttk {
         if(!segmented_)
           std::cerr << "Needs to create segmentation before size" << std::endl;
 #endif
-        return segmentation_.size();
+        return segmentationSize_;
       }
 
       SimplexId operator[](SimplexId v) const {
@@ -208,12 +214,12 @@ namespace ttk {
         return segmentation_[v];
       }
 
-      decltype(segmentation_)::iterator begin(void) {
-        return segmentation_.begin();
+      segm_it begin(void) {
+        return segmentation_;
       }
 
-      decltype(segmentation_)::iterator end(void) {
-        return segmentation_.end();
+      segm_it end(void) {
+        return segmentation_ + segmentationSize_;
       }
     };
 
@@ -16,6 +16,8 @@
 
 #include <boost/heap/fibonacci_heap.hpp>
 
+#include <TaskRuntime.h>
+
 #include "FTMAtomicVector.h"
 #include "FTMDataTypes.h"
 
@@ -46,8 +48,11 @@ namespace ttk {
       SimplexId size;
       void *values;
       void *offsets;
+      // 0 if unknown
+      unsigned long long modificationTime;
 
-      std::shared_ptr<std::vector<SimplexId>> sortedVertices, mirrorVertices;
+      std::shared_ptr<const std::vector<SimplexId>> sortedVertices,
+        mirrorVertices;
 
       // Need vertices to be sorted : use mirrorVertices.
 
@@ -66,29 +71,29 @@ namespace ttk {
       }
 
       Scalars()
-        : size(0), values(nullptr), offsets(nullptr), sortedVertices(nullptr),
-          mirrorVertices(nullptr) {
+        : size(0), values(nullptr), offsets(nullptr), modificationTime(0),
+          sortedVertices(nullptr), mirrorVertices(nullptr) {
       }
 
       // Heavy
       Scalars(const Scalars &o)
         : size(o.size), values(o.values), offsets(o.offsets),
+          modificationTime(o.modificationTime),
           sortedVertices(o.sortedVertices), mirrorVertices(o.mirrorVertices) {
         std::cout << "copy in depth, bad perfs" << std::endl;
       }
 
-      // Sort
+      // Sort, the large parts being sorted by tasks of runtime
       template <typename type>
       void qsort(type arr[],
                  const long int begin,
                  const long int stop,
-                 std::function<bool(type, type)> comp) const {
+                 std::function<bool(type, type)> comp,
+                 TaskRuntime *runtime) const {
         if(begin >= stop)
           return;
 
-#ifdef TTK_ENABLE_OPENMP
         static const long int MINSIZE = 10;
-#endif
 
         long int left = begin - 1;
         long int right = stop + 1;
@@ -107,14 +112,16 @@ namespace ttk {
         }
 
         swap_el<type>(arr, begin, right);
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task untied if(right - begin > MINSIZE)
-#endif
-        qsort(arr, begin, right - 1, comp);
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task untied if(stop - right > MINSIZE)
-#endif
-        qsort(arr, right + 1, stop, comp);
+        TaskGroup parts(runtime);
+        if(right - begin > MINSIZE)
+          parts.spawn([=] { qsort(arr, begin, right - 1, comp, runtime); });
+        else
+          qsort(arr, begin, right - 1, comp, runtime);
+        if(stop - right > MINSIZE)
+          parts.spawn([=] { qsort(arr, right + 1, stop, comp, runtime); });
+        else
+          qsort(arr, right + 1, stop, comp, runtime);
+        parts.wait();
       }
 
     private:
@@ -13,6 +13,7 @@
 #ifndef SUPERARC_H
 #define SUPERARC_H
 
+#include <atomic>
 #include <list>
 #include <vector>
 
@@ -38,7 +39,8 @@ namespace ttk {
 
       // Segmentation related
       ArcRegion region_;
-      SimplexId verticesSeen_;
+      // incremented concurrently by the trunk tasks (atomicIncVisited)
+      std::atomic<SimplexId> verticesSeen_;
       idSuperArc normalizedId_;
 
     public:
@@ -60,6 +62,24 @@ namespace ttk {
           region_(), verticesSeen_(0), normalizedId_(nullSuperArc) {
       }
 
+      SuperArc(const SuperArc &other)
+        : downNodeId_(other.downNodeId_), upNodeId_(other.upNodeId_),
+          state_(other.state_), lastVisited_(other.lastVisited_),
+          region_(other.region_), verticesSeen_(other.getNbVertSeen()),
+          normalizedId_(other.normalizedId_) {
+      }
+
+      SuperArc &operator=(const SuperArc &other) {
+        downNodeId_ = other.downNodeId_;
+        upNodeId_ = other.upNodeId_;
+        state_ = other.state_;
+        lastVisited_ = other.lastVisited_;
+        region_ = other.region_;
+        verticesSeen_.store(other.getNbVertSeen(), std::memory_order_relaxed);
+        normalizedId_ = other.normalizedId_;
+        return *this;
+      }
+
       // ------------------
       // ACCESSOR
       // --------------------
@@ -88,24 +108,22 @@ namespace ttk {
         return lastVisited_;
       }
 
+      // only the task growing the arc updates it: no atomic increment
       inline void setLastVisited(SimplexId vertId) {
         lastVisited_ = vertId;
-        ++verticesSeen_;
+        verticesSeen_.store(getNbVertSeen() + 1, std::memory_order_relaxed);
       }
 
       inline void atomicIncVisited(const SimplexId nb = 1) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-        verticesSeen_ += nb;
+        verticesSeen_.fetch_add(nb, std::memory_order_relaxed);
       }
 
       inline void decrNbSeen(void) {
-        --verticesSeen_;
+        verticesSeen_.store(getNbVertSeen() - 1, std::memory_order_relaxed);
       }
 
       inline SimplexId getNbVertSeen(void) const {
-        return verticesSeen_;
+        return verticesSeen_.load(std::memory_order_relaxed);
       }
 
       inline idSuperArc getNormalizedId(void) const {
@@ -153,8 +171,9 @@ namespace ttk {
       }
 
       // prerequisite for the following segmentation functions
-      inline void createSegmentation(const Scalars *s) {
-        region_.createSegmentation(s);
+      inline void createSegmentation(const Scalars *s,
+                                     const segm_it &segmentation) {
+        region_.createSegmentation(s, segmentation);
       }
 
       // Direct read access to the list of region
@@ -24,3 +24,14 @@ FTMTree::~FTMTree() {
   delete params_;
   delete scalars_;
 }
+
+int FTMTree::getMemoryReport(MemoryReport &report) const {
+  FTMTree_CT::getMemoryReport(report);
+  if(scalars_->sortedVertices)
+    report.add("FTMTree", "sortedVertices",
+               MemoryReport::bytes(*scalars_->sortedVertices));
+  if(scalars_->mirrorVertices)
+    report.add("FTMTree", "mirrorVertices",
+               MemoryReport::bytes(*scalars_->mirrorVertices));
+  return 0;
+}
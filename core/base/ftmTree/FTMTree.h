@@ -40,6 +40,9 @@ namespace ttk {
       FTMTree();
       virtual ~FTMTree();
 
+      /// Report the memory used by the trees and by the vertex order.
+      int getMemoryReport(MemoryReport &report) const override;
+
       // -------
       // PROCESS
       // -------
@@ -48,6 +51,17 @@ namespace ttk {
       // Need triangulation, scalars and all params set before call
       template <typename scalarType, typename idType>
       void build(void);
+
+      // Prepare the scalar field (NaN values, offsets) and sort its
+      // vertices, as build() does
+      // Need triangulation and scalars set before call
+      template <typename scalarType, typename idType>
+      void sortScalars(void);
+
+    protected:
+      // Replace the NaN values of the scalar field by 0
+      template <typename scalarType>
+      void replaceNaN(void);
     };
 
 #include "FTMTree_Template.h"
@@ -27,6 +27,8 @@ FTMTree_CT::FTMTree_CT(Params *const params,
   : FTMTree_MT(params, mesh, scalars, TreeType::Contour),
     jt_(new FTMTree_MT(params, mesh, scalars, TreeType::Join)),
     st_(new FTMTree_MT(params, mesh, scalars, TreeType::Split)) {
+  jt_->setTaskRuntime(taskRuntime_);
+  st_->setTaskRuntime(taskRuntime_);
 }
 
 FTMTree_CT::~FTMTree_CT() {
@@ -40,6 +42,15 @@ FTMTree_CT::~FTMTree_CT() {
   }
 }
 
+int FTMTree_CT::getMemoryReport(MemoryReport &report) const {
+  FTMTree_MT::getMemoryReport(report);
+  if(jt_)
+    jt_->getMemoryReport(report);
+  if(st_)
+    st_->getMemoryReport(report);
+  return 0;
+}
+
 void FTMTree_CT::build(TreeType tt) {
   DebugTimer mergeTreesTime;
 
@@ -47,19 +58,13 @@ void FTMTree_CT::build(TreeType tt) {
 
   initComp();
 
+  const ThreadId workerNumber = getTaskWorkerNumber();
+
   if(bothMT) {
     // single leaf search for both tree
     // When executed from CT, both minima and maxima are extracted
     DebugTimer precomputeTime;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel num_threads(threadNumber_)
-#endif
-    {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp single nowait
-#endif
-      { leafSearch(); }
-    }
+    taskRuntime_->run([this] { leafSearch(); }, workerNumber);
     printTime(precomputeTime, "[FTM] leafSearch", -1, 3);
   }
 
@@ -74,65 +79,53 @@ void FTMTree_CT::build(TreeType tt) {
 #endif
 
   // JT & ST
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel num_threads(threadNumber_)
-#endif
-  {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp single nowait
-#endif
-    {if(tt == TreeType::Join || bothMT){
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task untied if(threadNumber_ > 1)
-#endif
-      jt_->build(tt == TreeType::Contour);
-}
-if(tt == TreeType::Split || bothMT) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task untied if(threadNumber_ > 1)
-#endif
-  st_->build(tt == TreeType::Contour);
-}
-}
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
-}
+  taskRuntime_->run(
+    [&] {
+      TaskGroup trees(taskRuntime_);
+      if(tt == TreeType::Join || bothMT) {
+        trees.spawn([&] { jt_->build(tt == TreeType::Contour); });
+      }
+      if(tt == TreeType::Split || bothMT) {
+        trees.spawn([&] { st_->build(tt == TreeType::Contour); });
+      }
+      trees.wait();
+    },
+    workerNumber);
 
-printTime(mergeTreesTime, "[FTM] merge trees ", -1, 3);
+  printTime(mergeTreesTime, "[FTM] merge trees ", -1, 3);
 
-// Combine
+  // Combine
 
-if(tt == TreeType::Contour) {
+  if(tt == TreeType::Contour) {
 
-  DebugTimer combineFullTime;
-  insertNodes();
+    DebugTimer combineFullTime;
+    insertNodes();
 
-  DebugTimer combineTime;
-  combine();
-  printTime(combineTime, "[FTM] combine trees", -1, 4);
-  printTime(combineFullTime, "[FTM] combine full", -1, 3);
-}
+    DebugTimer combineTime;
+    combine();
+    printTime(combineTime, "[FTM] combine trees", -1, 4);
+    printTime(combineFullTime, "[FTM] combine full", -1, 3);
+  }
 
-// Debug
-
-if(debugLevel_ > 3) {
-  cout << "- [FTM] final number of nodes :";
-  switch(tt) {
-    case TreeType::Join:
-      cout << jt_->getNumberOfNodes();
-      break;
-    case TreeType::Split:
-      cout << st_->getNumberOfNodes();
-      break;
-    case TreeType::Join_Split:
-      cout << jt_->getNumberOfNodes() + st_->getNumberOfNodes();
-      break;
-    default:
-      cout << getNumberOfNodes();
+  // Debug
+
+  if(debugLevel_ > 3) {
+    cout << "- [FTM] final number of nodes :";
+    switch(tt) {
+      case TreeType::Join:
+        cout << jt_->getNumberOfNodes();
+        break;
+      case TreeType::Split:
+        cout << st_->getNumberOfNodes();
+        break;
+      case TreeType::Join_Split:
+        cout << jt_->getNumberOfNodes() + st_->getNumberOfNodes();
+        break;
+      default:
+        cout << getNumberOfNodes();
+    }
+    cout << endl;
   }
-  cout << endl;
-}
 }
 
 int FTMTree_CT::combine() {
@@ -407,15 +400,7 @@ void FTMTree_CT::createCTArcSegmentation(idSuperArc ctArc,
 
 void FTMTree_CT::finalizeSegmentation(void) {
   DebugTimer finSegmTime;
-  const auto &nbArc = getNumberOfSuperArcs();
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for schedule(dynamic)
-#endif
-  for(idSuperArc i = 0; i < nbArc; i++) {
-    getSuperArc(i)->createSegmentation(scalars_);
-  }
-
+  FTMTree_MT::finalizeSegmentation();
   printTime(finSegmTime, "[FTM] post-process segm", -1, 4);
 }
 
@@ -448,11 +433,9 @@ int FTMTree_CT::leafSearch() {
   const auto chunkNb = getChunkCount();
 
   // Extrema extract and launch tasks
+  TaskGroup tasks(taskRuntime_);
   for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId)
-#endif
-    {
+    tasks.spawn([=] {
       const SimplexId lowerBound = chunkId * chunkSize;
       const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
       for(SimplexId v = lowerBound; v < upperBound; ++v) {
@@ -481,11 +464,9 @@ int FTMTree_CT::leafSearch() {
           st_->makeNode(v);
         }
       }
-    }
+    });
   }
+  tasks.wait();
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
   return 0;
 }
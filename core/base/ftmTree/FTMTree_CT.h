@@ -73,6 +73,15 @@ namespace ttk {
         return this;
       }
 
+      /// Set the runtime executing the tasks, shared with the join and
+      /// split trees.
+      void
+        setTaskRuntime(const std::shared_ptr<TaskRuntime> &runtime) override {
+        FTMTree_MT::setTaskRuntime(runtime);
+        jt_->setTaskRuntime(runtime);
+        st_->setTaskRuntime(runtime);
+      }
+
       inline void setupTriangulation(AbstractTriangulation *m,
                                      const bool preproc = true) {
         FTMTree_MT::setupTriangulation(m, preproc);
@@ -94,6 +103,10 @@ namespace ttk {
         return 0;
       }
 
+      /// Report the memory used by the contour tree and by its join and
+      /// split trees.
+      int getMemoryReport(MemoryReport &report) const override;
+
       // -----------------
       // PROCESS
       // -----------------
@@ -13,6 +13,8 @@
 
 #include "FTMTree_MT.h"
 
+#include <algorithm>
+#include <numeric>
 #include <stack>
 
 #define PRIOR(x)
@@ -26,12 +28,6 @@
 #define HIGHER
 #endif
 
-#ifdef TTK_ENABLE_OMP_PRIORITY
-#define OPTIONAL_PRIORITY(value) priority(value)
-#else
-#define OPTIONAL_PRIORITY(value)
-#endif
-
 using namespace std;
 using namespace ttk;
 using namespace ftm;
@@ -42,7 +38,8 @@ FTMTree_MT::FTMTree_MT(Params *const params,
                        AbstractTriangulation *mesh,
                        Scalars *const scalars,
                        TreeType type)
-  : params_(params), mesh_(mesh), scalars_(scalars) {
+  : params_(params), mesh_(mesh), scalars_(scalars), previousValues_(nullptr),
+    previousOffsets_(nullptr), updatedVertexNumber_(0) {
   mt_data_.treeType = type;
 
   mt_data_.superArcs = nullptr;
@@ -50,7 +47,6 @@ FTMTree_MT::FTMTree_MT(Params *const params,
   mt_data_.roots = nullptr;
   mt_data_.leaves = nullptr;
   mt_data_.vert2tree = nullptr;
-  mt_data_.trunkSegments = nullptr;
   mt_data_.visitOrder = nullptr;
   mt_data_.ufs = nullptr;
   mt_data_.states = nullptr;
@@ -65,28 +61,13 @@ FTMTree_MT::FTMTree_MT(Params *const params,
 #ifdef TTK_ENABLE_OMP_PRIORITY
   mt_data_.prior = false;
 #endif
+
+  taskRuntime_ = TaskRuntime::create(TaskRuntime::getDefaultType());
 }
 
 FTMTree_MT::~FTMTree_MT() {
 
-  // remove UF data structures
-  if(mt_data_.ufs) {
-    sort(mt_data_.ufs->begin(), mt_data_.ufs->end());
-    auto it = unique(mt_data_.ufs->begin(), mt_data_.ufs->end());
-    mt_data_.ufs->resize(std::distance(mt_data_.ufs->begin(), it));
-    for(auto *addr : *mt_data_.ufs)
-      if(addr)
-        delete addr;
-  }
-
-  // if (mt_data_.propagation) {
-  //    Already cleaned by ufs
-  //    sort(mt_data_.propagation->begin(), mt_data_.propagation->end());
-  //    auto it = unique(mt_data_.propagation->begin(),
-  //    mt_data_.propagation->end());
-  //    mt_data_.propagation->resize(std::distance(mt_data_.propagation->begin(),
-  //    it)); for (auto* addr : *mt_data_.propagation) if(addr) delete addr;
-  // }
+  // UF data structures are released with mt_data_.ufArena
 
   // remove containers
   if(mt_data_.superArcs) {
@@ -109,10 +90,6 @@ FTMTree_MT::~FTMTree_MT() {
     delete mt_data_.vert2tree;
     mt_data_.vert2tree = nullptr;
   }
-  if(mt_data_.trunkSegments) {
-    delete mt_data_.trunkSegments;
-    mt_data_.trunkSegments = nullptr;
-  }
   if(mt_data_.visitOrder) {
     delete mt_data_.visitOrder;
     mt_data_.visitOrder = nullptr;
@@ -151,7 +128,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
 
   // local order (ignore non regular verts)
   SimplexId localOrder = -1;
-  UF startUF = (*mt_data_.ufs)[startVert]->find();
+  UF startUF = (*mt_data_.ufs)[startVert].load()->find();
   // get or recover states
   CurrentState *currentState;
   if(startUF->getNbStates()) {
@@ -201,16 +178,14 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
     // local order to avoid sort
     (*mt_data_.visitOrder)[currentVert] = localOrder++;
 
+    // regular propagation, before the valence update of propage() so that
+    // the last task reaching a saddle sees the UF of the others
+    (*mt_data_.ufs)[currentVert] = startUF;
+
     // Saddle & Last detection + propagation
     bool isSaddle, isLast;
     tie(isSaddle, isLast) = propage(*currentState, startUF);
 
-    // regular propagation
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write seq_cst
-#endif
-    (*mt_data_.ufs)[currentVert] = startUF;
-
     // Saddle case
     if(isSaddle) {
 
@@ -218,11 +193,6 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
       (*mt_data_.activeTasksStats)[currentArc].end
         = _launchGlobalTime.getElapsedTime();
 #endif
-      // need a node on this vertex
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write seq_cst
-#endif
-      (*mt_data_.openedNodes)[currentVert] = 1;
 
       // If last close all and merge
       if(isLast) {
@@ -230,32 +200,20 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
         closeAndMergeOnSaddle(currentVert);
 
         // last task detection
-        idNode remainingTasks;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read seq_cst
-#endif
-        remainingTasks = mt_data_.activeTasks;
+        const idNode remainingTasks = mt_data_.activeTasks;
         if(remainingTasks == 1) {
           // only backbone remaining
           return;
         }
 
         // made a node on this vertex
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write seq_cst
-#endif
         (*mt_data_.openedNodes)[currentVert] = 0;
 
         // recursively continue
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskyield
-#endif
+        taskRuntime_->yield();
         arcGrowth(currentVert, orig);
       } else {
         // Active tasks / threads
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update seq_cst
-#endif
         mt_data_.activeTasks--;
       }
 
@@ -321,7 +279,7 @@ void FTMTree_MT::build(const bool ct) {
   printTime(buildTime, "[FTM] leafGrowth " + treeString, nbProcessed, 3);
 
   DebugTimer bbTime;
-  SimplexId bbSize = trunk(ct);
+  SimplexId bbSize = trunk();
   printTime(bbTime, "[FTM] trunk " + treeString, bbSize, 3);
 
   // Segmentation
@@ -345,35 +303,29 @@ void FTMTree_MT::buildSegmentation() {
   // get the size of each segment
   const idSuperArc arcChunkSize = getChunkSize(nbArcs);
   const idSuperArc arcChunkNb = getChunkCount(nbArcs);
+  TaskGroup tasks(taskRuntime_);
   for(idSuperArc arcChunkId = 0; arcChunkId < arcChunkNb; ++arcChunkId) {
-    // WHY shared(sizes) is needed ??
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(arcChunkId) shared(sizes) \
-  OPTIONAL_PRIORITY(isPrior())
-#endif
-    {
-      const idSuperArc lowerBound = arcChunkId * arcChunkSize;
-      const idSuperArc upperBound
-        = min(nbArcs, (arcChunkId + 1) * arcChunkSize);
-      for(idSuperArc a = lowerBound; a < upperBound; ++a) {
-        sizes[a]
-          = max((SimplexId)0, (*mt_data_.superArcs)[a].getNbVertSeen() - 1);
-      }
-    }
+    tasks.spawn(
+      [&, arcChunkId] {
+        const idSuperArc lowerBound = arcChunkId * arcChunkSize;
+        const idSuperArc upperBound
+          = min(nbArcs, (arcChunkId + 1) * arcChunkSize);
+        for(idSuperArc a = lowerBound; a < upperBound; ++a) {
+          sizes[a] = max(
+            (SimplexId)0, (*mt_data_.superArcs)[a].getNbVertSeen() - 1);
+        }
+      },
+      getTaskPriority());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
 
   // change segments size using the created vector
   mt_data_.segments_.resize(sizes);
 
   DebugTimer segmentsSet;
 
-  // Fill segments using vert2tree
-
-  // current status of the segmentation of this arc
-  vector<SimplexId> posSegm(nbArcs, 0);
+  // Fill segments using vert2tree and the visit order of the vertices in
+  // their arc (leaf growth or trunk)
 
   // Segments are connex region of geometrie forming
   // the segmentation (sorted in ascending order)
@@ -381,104 +333,51 @@ void FTMTree_MT::buildSegmentation() {
   const SimplexId chunkSize = getChunkSize();
   const SimplexId chunkNb = getChunkCount();
   for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId) shared(posSegm) \
-  OPTIONAL_PRIORITY(isPrior())
-#endif
-    {
-      const SimplexId lowerBound = chunkId * chunkSize;
-      const SimplexId upperBound = min(nbVert, (chunkId + 1) * chunkSize);
-      for(SimplexId i = lowerBound; i < upperBound; ++i) {
-        const auto vert = (*scalars_->sortedVertices)[i];
-        if(isCorrespondingArc(vert)) {
-          idSuperArc sa = getCorrespondingSuperArcId(vert);
-          SimplexId vertToAdd;
-          if((*mt_data_.visitOrder)[vert] != nullVertex) {
-            // Opposite order for Split Tree
-            vertToAdd = (*mt_data_.visitOrder)[vert];
-            if(isST())
-              vertToAdd = getSuperArc(sa)->getNbVertSeen() - vertToAdd - 2;
-            mt_data_.segments_[sa][vertToAdd] = vert;
-          } else if(mt_data_.trunkSegments->size() == 0) {
-            // MT computation
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-            vertToAdd = posSegm[sa]++;
-            mt_data_.segments_[sa][vertToAdd] = vert;
-          }
-
-        } // end is arc
-      } // end for
-    } // end task
+    tasks.spawn(
+      [&, chunkId] {
+        const SimplexId lowerBound = chunkId * chunkSize;
+        const SimplexId upperBound = min(nbVert, (chunkId + 1) * chunkSize);
+        for(SimplexId i = lowerBound; i < upperBound; ++i) {
+          const auto vert = (*scalars_->sortedVertices)[i];
+          if(isCorrespondingArc(vert)) {
+            idSuperArc sa = getCorrespondingSuperArcId(vert);
+            if((*mt_data_.visitOrder)[vert] != nullVertex) {
+              // Opposite order for Split Tree
+              SimplexId vertToAdd = (*mt_data_.visitOrder)[vert];
+              if(isST())
+                vertToAdd = getSuperArc(sa)->getNbVertSeen() - vertToAdd - 2;
+              mt_data_.segments_[sa][vertToAdd] = vert;
+            }
+          } // end is arc
+        } // end for
+      },
+      getTaskPriority());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
 
   printTime(segmentsSet, "[FTM] segmentation set vertices", -1, 4);
 
-  if(mt_data_.trunkSegments->size() == 0) {
-    // sort arc that have been filled by the trunk
-    // only for MT
-    DebugTimer segmentsSortTime;
-    for(idSuperArc a = 0; a < nbArcs; ++a) {
-      if(posSegm[a]) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(a) OPTIONAL_PRIORITY(isPrior())
-#endif
-        mt_data_.segments_[a].sort(scalars_);
-      }
-    }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
-    printTime(segmentsSortTime, "[FTM] segmentation sort vertices", -1, 4);
-  } else {
-    // Contour tree: we create the arc segmentation for arcs in the trunk
-    DebugTimer segmentsArcTime;
-    for(idSuperArc a = 0; a < nbArcs; ++a) {
-      // CT computation, we have already the vert list
-      if((*mt_data_.trunkSegments)[a].size()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(a) OPTIONAL_PRIORITY(isPrior())
-#endif
-        mt_data_.segments_[a].createFromList(
-          scalars_, (*mt_data_.trunkSegments)[a],
-          mt_data_.treeType == TreeType::Split);
-      }
-    }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
-
-    printTime(segmentsArcTime, "[FTM] segmentation arcs lists", -1, 4);
-  }
-
   // Update SuperArc region
 
   // ST have a segmentation wich is in the reverse-order of its build
   // ST have a segmentation sorted in ascending order as JT
   for(idSuperArc arcChunkId = 0; arcChunkId < arcChunkNb; ++arcChunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(arcChunkId) OPTIONAL_PRIORITY(isPrior())
-#endif
-    {
-      const idSuperArc lowerBound = arcChunkId * arcChunkSize;
-      const idSuperArc upperBound
-        = min(nbArcs, (arcChunkId + 1) * arcChunkSize);
-      for(idSuperArc a = lowerBound; a < upperBound; ++a) {
-        // avoid empty region
-        if(mt_data_.segments_[a].size()) {
-          (*mt_data_.superArcs)[a].concat(
-            mt_data_.segments_[a].begin(), mt_data_.segments_[a].end());
+    tasks.spawn(
+      [&, arcChunkId] {
+        const idSuperArc lowerBound = arcChunkId * arcChunkSize;
+        const idSuperArc upperBound
+          = min(nbArcs, (arcChunkId + 1) * arcChunkSize);
+        for(idSuperArc a = lowerBound; a < upperBound; ++a) {
+          // avoid empty region
+          if(mt_data_.segments_[a].size()) {
+            (*mt_data_.superArcs)[a].concat(
+              mt_data_.segments_[a].begin(), mt_data_.segments_[a].end());
+          }
         }
-      }
-    }
+      },
+      getTaskPriority());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
 }
 
 FTMTree_MT *FTMTree_MT::clone() const {
@@ -504,8 +403,8 @@ void FTMTree_MT::closeAndMergeOnSaddle(SimplexId saddleVert) {
     mesh_->getVertexNeighbor(saddleVert, n, neigh);
 
     if(comp_.vertLower(neigh, saddleVert)) {
-      if((*mt_data_.ufs)[neigh]->find()
-         != (*mt_data_.ufs)[saddleVert]->find()) {
+      if((*mt_data_.ufs)[neigh].load()->find()
+         != (*mt_data_.ufs)[saddleVert].load()->find()) {
         (*mt_data_.ufs)[saddleVert] = AtomicUF::makeUnion(
           (*mt_data_.ufs)[saddleVert], (*mt_data_.ufs)[neigh]);
       }
@@ -515,8 +414,8 @@ void FTMTree_MT::closeAndMergeOnSaddle(SimplexId saddleVert) {
   // close arcs on this node
   closeArcsUF(closeNode, (*mt_data_.ufs)[saddleVert]);
 
-  (*mt_data_.ufs)[saddleVert]->find()->mergeStates();
-  (*mt_data_.ufs)[saddleVert]->find()->setExtrema(saddleVert);
+  (*mt_data_.ufs)[saddleVert].load()->find()->mergeStates();
+  (*mt_data_.ufs)[saddleVert].load()->find()->setExtrema(saddleVert);
 }
 
 void FTMTree_MT::closeArcsUF(idNode closeNode, UF uf) {
@@ -537,8 +436,8 @@ void FTMTree_MT::closeOnBackBone(SimplexId saddleVert) {
 
     if(comp_.vertLower(neigh, saddleVert)) {
       if((*mt_data_.ufs)[neigh]
-         && (*mt_data_.ufs)[neigh]->find()
-              != (*mt_data_.ufs)[saddleVert]->find()) {
+         && (*mt_data_.ufs)[neigh].load()->find()
+              != (*mt_data_.ufs)[saddleVert].load()->find()) {
         (*mt_data_.ufs)[saddleVert] = AtomicUF::makeUnion(
           (*mt_data_.ufs)[saddleVert], (*mt_data_.ufs)[neigh]);
       }
@@ -625,24 +524,22 @@ void FTMTree_MT::delNode(idNode node) {
 }
 
 void FTMTree_MT::finalizeSegmentation(void) {
-  for(auto &arc : *mt_data_.superArcs) {
-    arc.createSegmentation(scalars_);
-  }
-}
+  const idSuperArc nbArcs = getNumberOfSuperArcs();
 
-tuple<SimplexId, SimplexId>
-  FTMTree_MT::getBoundsFromVerts(const vector<SimplexId> &trunkVerts) const {
-  SimplexId begin, stop;
-
-  if(isST()) {
-    begin = 0;
-    stop = (*scalars_->mirrorVertices)[trunkVerts[0]];
-  } else {
-    begin = (*scalars_->mirrorVertices)[trunkVerts[0]];
-    stop = scalars_->size;
+  // position of the segmentation of each arc in the buffer
+  vector<SimplexId> offsets(nbArcs + 1, 0);
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    offsets[a + 1] = offsets[a] + getSuperArc(a)->regionSize();
   }
+  mt_data_.segmentation_.resize(offsets[nbArcs]);
 
-  return make_tuple(begin, stop);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    getSuperArc(a)->createSegmentation(
+      scalars_, mt_data_.segmentation_.begin() + offsets[a]);
+  }
 }
 
 Node *FTMTree_MT::getDownNode(const SuperArc *a) {
@@ -689,17 +586,6 @@ idNode FTMTree_MT::getUpperNodeId(const SuperArc *a) {
   return getUpNodeId(a);
 }
 
-idNode FTMTree_MT::getVertInRange(const vector<SimplexId> &range,
-                                  const SimplexId v,
-                                  const idNode last) const {
-  idNode idRes = last;
-  const idNode rangeSize = range.size();
-  while(idRes + 1 < rangeSize && comp_.vertLower(range[idRes + 1], v)) {
-    ++idRes;
-  }
-  return idRes;
-}
-
 idSuperArc FTMTree_MT::insertNode(Node *node, const bool segm) {
   // Normal insert : existing arc stay below inserted (JT example)
   //  *   - <- upNodeId
@@ -763,7 +649,7 @@ void FTMTree_MT::leafGrowth() {
   if(nbLeaves == 1) {
     const SimplexId v = (*mt_data_.nodes)[0].getVertexId();
     (*mt_data_.openedNodes)[v] = 1;
-    (*mt_data_.ufs)[v] = new AtomicUF(v);
+    (*mt_data_.ufs)[v] = mt_data_.ufArena.create(v);
     return;
   }
 
@@ -780,21 +666,17 @@ void FTMTree_MT::leafGrowth() {
   };
   sort(mt_data_.leaves->begin(), mt_data_.leaves->end(), comp);
 
+  mt_data_.ufArena.reserve(nbLeaves);
+  TaskGroup tasks(taskRuntime_);
   for(idNode n = 0; n < nbLeaves; ++n) {
     const idNode l = (*mt_data_.leaves)[n];
     SimplexId v = getNode(l)->getVertexId();
     // for each node: get vert, create uf and lauch
-    (*mt_data_.ufs)[v] = new AtomicUF(v);
+    (*mt_data_.ufs)[v] = mt_data_.ufArena.create(v);
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task untied OPTIONAL_PRIORITY(isPrior())
-#endif
-    arcGrowth(v, n);
+    tasks.spawn([this, v, n] { arcGrowth(v, n); }, getTaskPriority());
   }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
 }
 
 int FTMTree_MT::leafSearch() {
@@ -806,35 +688,33 @@ int FTMTree_MT::leafSearch() {
     const auto chunkNb = getChunkCount();
 
     // Extrema extract and launch tasks
+    TaskGroup tasks(taskRuntime_);
     for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId) OPTIONAL_PRIORITY(isPrior())
-#endif
-      {
-        const SimplexId lowerBound = chunkId * chunkSize;
-        const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
-        for(SimplexId v = lowerBound; v < upperBound; ++v) {
-          const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
-          valence val = 0;
-
-          for(valence n = 0; n < neighNumb; ++n) {
-            SimplexId neigh;
-            mesh_->getVertexNeighbor(v, n, neigh);
-            comp_.vertLower(neigh, v) && ++val;
-          }
+      tasks.spawn(
+        [=] {
+          const SimplexId lowerBound = chunkId * chunkSize;
+          const SimplexId upperBound
+            = min(nbScalars, (chunkId + 1) * chunkSize);
+          for(SimplexId v = lowerBound; v < upperBound; ++v) {
+            const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
+            valence val = 0;
+
+            for(valence n = 0; n < neighNumb; ++n) {
+              SimplexId neigh;
+              mesh_->getVertexNeighbor(v, n, neigh);
+              comp_.vertLower(neigh, v) && ++val;
+            }
 
-          (*mt_data_.valences)[v] = val;
+            (*mt_data_.valences)[v] = val;
 
-          if(!val) {
-            makeNode(v);
+            if(!val) {
+              makeNode(v);
+            }
           }
-        }
-      }
+        },
+        getTaskPriority());
     }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+    tasks.wait();
   } else {
     ret = 1;
   }
@@ -1108,6 +988,60 @@ void FTMTree_MT::printParams(void) const {
   }
 }
 
+int FTMTree_MT::getMemoryReport(MemoryReport &report) const {
+
+  string component;
+  switch(mt_data_.treeType) {
+    case TreeType::Join:
+      component = "JoinTree";
+      break;
+    case TreeType::Split:
+      component = "SplitTree";
+      break;
+    default:
+      component = "ContourTree";
+      break;
+  }
+
+  if(mt_data_.superArcs)
+    report.add(component, "superArcs",
+               MemoryReport::bytes(*mt_data_.superArcs));
+  if(mt_data_.nodes)
+    report.add(component, "nodes", MemoryReport::bytes(*mt_data_.nodes));
+  if(mt_data_.roots)
+    report.add(component, "roots", MemoryReport::bytes(*mt_data_.roots));
+  if(mt_data_.leaves)
+    report.add(component, "leaves", MemoryReport::bytes(*mt_data_.leaves));
+  if(mt_data_.vert2tree)
+    report.add(
+      component, "vert2tree", MemoryReport::bytes(*mt_data_.vert2tree));
+  if(mt_data_.visitOrder)
+    report.add(
+      component, "visitOrder", MemoryReport::bytes(*mt_data_.visitOrder));
+  if(mt_data_.ufs)
+    report.add(component, "ufs", MemoryReport::bytes(*mt_data_.ufs),
+               "pointers only");
+  if(mt_data_.ufArena.size())
+    report.add(component, "ufArena", mt_data_.ufArena.footprint(),
+               "without the states");
+  if(mt_data_.propagation)
+    report.add(component, "propagation",
+               MemoryReport::bytes(*mt_data_.propagation), "pointers only");
+  if(mt_data_.states)
+    report.add(component, "states", MemoryReport::bytes(*mt_data_.states));
+  if(mt_data_.valences)
+    report.add(component, "valences", MemoryReport::bytes(*mt_data_.valences));
+  if(mt_data_.openedNodes)
+    report.add(
+      component, "openedNodes", MemoryReport::bytes(*mt_data_.openedNodes));
+
+  report.add(component, "segments", mt_data_.segments_.footprint());
+  report.add(
+    component, "segmentation", MemoryReport::bytes(mt_data_.segmentation_));
+
+  return 0;
+}
+
 int FTMTree_MT::printTime(DebugTimer &t,
                           const string &s,
                           SimplexId nbScalars,
@@ -1205,15 +1139,15 @@ tuple<bool, bool> FTMTree_MT::propage(CurrentState &currentState, UF curUF) {
     }
   }
 
-  // is last
-  valence oldVal;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-  {
-    oldVal = (*mt_data_.valences)[currentState.vertex];
-    (*mt_data_.valences)[currentState.vertex] -= decr;
+  // need a node on this vertex: set it before the valence update, otherwise
+  // it could overwrite the reset done by the last task
+  if(becameSaddle) {
+    (*mt_data_.openedNodes)[currentState.vertex] = 1;
   }
+
+  // is last
+  const valence oldVal
+    = (*mt_data_.valences)[currentState.vertex].fetch_sub(decr);
   if(oldVal == decr) {
     isLast = true;
   }
@@ -1280,20 +1214,11 @@ vector<idNode> FTMTree_MT::sortedNodes(const bool para) {
   return sortedNodes;
 }
 
-SimplexId FTMTree_MT::trunk(const bool ct) {
+SimplexId FTMTree_MT::trunk() {
   DebugTimer bbTimer;
 
   vector<SimplexId> trunkVerts;
-  const auto &nbScalars = scalars_->size;
-
-  // trunkVerts
-  trunkVerts.reserve(max((SimplexId)10, nbScalars / 500));
-  for(SimplexId v = 0; v < nbScalars; ++v) {
-    if((*mt_data_.openedNodes)[v]) {
-      trunkVerts.emplace_back(v);
-    }
-  }
-  sort(trunkVerts.begin(), trunkVerts.end(), comp_.vertLower);
+  getTrunkVertices(trunkVerts);
   for(const SimplexId v : trunkVerts) {
     closeOnBackBone(v);
   }
@@ -1324,181 +1249,180 @@ SimplexId FTMTree_MT::trunk(const bool ct) {
   bbTimer.reStart();
 
   // Segmentation
-  SimplexId begin, stop, processed;
-  tie(begin, stop) = getBoundsFromVerts(trunkVerts);
-  if(ct) {
-    processed = trunkCTSegmentation(trunkVerts, begin, stop);
-  } else {
-    processed = trunkSegmentation(trunkVerts, begin, stop);
-  }
+  const SimplexId processed = trunkSegmentation(trunkVerts);
   printTime(bbTimer, "[FTM] trunk para.", -1, 4);
 
   return processed;
 }
 
-SimplexId FTMTree_MT::trunkCTSegmentation(const vector<SimplexId> &trunkVerts,
-                                          const SimplexId begin,
-                                          const SimplexId stop) {
-  const int nbTasksThreads = 40;
-  const auto sizeBackBone = abs(stop - begin);
-  const auto chunkSize = getChunkSize(sizeBackBone, nbTasksThreads);
-  const auto chunkNb = getChunkCount(sizeBackBone, nbTasksThreads);
-  // si pas efficace vecteur de la taille de node ici a la place de acc
-  idNode lastVertInRange = 0;
-  mt_data_.trunkSegments->resize(getNumberOfSuperArcs());
+void FTMTree_MT::getTrunkVertices(vector<SimplexId> &trunkVerts) {
+  const SimplexId nbScalars = scalars_->size;
+  const SimplexId chunkSize = getChunkSize();
+  const SimplexId chunkNb = getChunkCount();
+
+  // count the opened nodes of each chunk, in the order of the tree
+  vector<SimplexId> chunkOffsets(chunkNb + 1, 0);
+  TaskGroup tasks(taskRuntime_);
   for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId, lastVertInRange) shared(trunkVerts) \
-  OPTIONAL_PRIORITY(isPrior())
-#endif
-    {
-      vector<SimplexId> regularList;
-      if(params_->segm) {
-        regularList.reserve(25);
-      }
-      const SimplexId lowerBound = begin + chunkId * chunkSize;
-      const SimplexId upperBound
-        = min(stop, (begin + (chunkId + 1) * chunkSize));
-      if(lowerBound != upperBound) {
-        const SimplexId pos = isST() ? upperBound - 1 : lowerBound;
-        lastVertInRange
-          = getVertInRange(trunkVerts, (*scalars_->sortedVertices)[pos], 0);
-      }
-      for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const SimplexId s
-          = isST()
-              ? (*scalars_->sortedVertices)[lowerBound + upperBound - 1 - v]
-              : (*scalars_->sortedVertices)[v];
-        if(isCorrespondingNull(s)) {
-          const idNode oldVertInRange = lastVertInRange;
-          lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
-          const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
-          updateCorrespondingArc(s, thisArc);
-
-          if(params_->segm) {
-            if(oldVertInRange == lastVertInRange) {
-              regularList.emplace_back(s);
-            } else {
-              // accumulated to have only one atomic update when needed
-              const idSuperArc oldArc
-                = upArcFromVert(trunkVerts[oldVertInRange]);
-              if(regularList.size()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
-                {
-                  (*mt_data_.trunkSegments)[oldArc].emplace_back(regularList);
-                  regularList.clear();
-                }
-              }
-              // hand.vtu, sequential: 28554
-              regularList.emplace_back(s);
-            }
+    tasks.spawn(
+      [&, chunkId] {
+        const SimplexId lowerBound = chunkId * chunkSize;
+        const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
+        SimplexId nbOpened = 0;
+        for(SimplexId r = lowerBound; r < upperBound; ++r) {
+          if((*mt_data_.openedNodes)[getTreeVertex(r)]) {
+            ++nbOpened;
           }
         }
-      }
-      // force increment last arc
-      const idNode baseNode
-        = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
-      const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
-      if(regularList.size()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
-        {
-          (*mt_data_.trunkSegments)[upArc].emplace_back(regularList);
-          regularList.clear();
-        }
-      }
-    }
+        chunkOffsets[chunkId + 1] = nbOpened;
+      },
+      getTaskPriority());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
-  // count added
-  SimplexId tot = 0;
-#ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
-  for(const auto &l : *mt_data_.trunkSegments) {
-    SimplexId arcSize = 0;
-    for(const auto &v : l) {
-      arcSize += v.size();
+  tasks.wait();
+
+  partial_sum(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+  trunkVerts.resize(chunkOffsets[chunkNb]);
+
+  // each chunk writes its opened nodes at its offset: sorted, without sort
+  for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
+    if(chunkOffsets[chunkId] == chunkOffsets[chunkId + 1]) {
+      continue;
     }
-    tot += arcSize;
+    tasks.spawn(
+      [&, chunkId] {
+        const SimplexId lowerBound = chunkId * chunkSize;
+        const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
+        SimplexId pos = chunkOffsets[chunkId];
+        for(SimplexId r = lowerBound; r < upperBound; ++r) {
+          const SimplexId v = getTreeVertex(r);
+          if((*mt_data_.openedNodes)[v]) {
+            trunkVerts[pos++] = v;
+          }
+        }
+      },
+      getTaskPriority());
   }
-#endif
-  return tot;
+  tasks.wait();
 }
 
-SimplexId FTMTree_MT::trunkSegmentation(const vector<SimplexId> &trunkVerts,
-                                        const SimplexId begin,
-                                        const SimplexId stop) {
+SimplexId FTMTree_MT::trunkSegmentation(const vector<SimplexId> &trunkVerts) {
   // Assign missing vert to the good arc
   // and also add the corresponding number for
   // futur arc reserve
+  const SimplexId nbScalars = scalars_->size;
+  const idNode nbNodes = trunkVerts.size();
+
+  // the trunk arc n spans the ranks between the nodes n and n + 1
+  vector<SimplexId> trunkRanks(nbNodes);
+  vector<idSuperArc> trunkArcs(nbNodes);
+  for(idNode n = 0; n < nbNodes; ++n) {
+    trunkRanks[n] = getTreeRank(trunkVerts[n]);
+    trunkArcs[n] = upArcFromVert(trunkVerts[n]);
+  }
+
   const int nbTasksThreads = 40;
-  const auto sizeBackBone = abs(stop - begin);
-  const auto chunkSize = getChunkSize(sizeBackBone, nbTasksThreads);
-  const auto chunkNb = getChunkCount(sizeBackBone, nbTasksThreads);
-  // si pas efficace vecteur de la taille de node ici a la place de acc
+  const SimplexId begin = trunkRanks[0];
+  const SimplexId sizeBackBone = nbScalars - begin;
+  const SimplexId chunkSize = getChunkSize(sizeBackBone, nbTasksThreads);
+  const SimplexId chunkNb = getChunkCount(sizeBackBone, nbTasksThreads);
+
+  // consecutive vertices of a chunk assigned to the same arc
+  struct Run {
+    idNode node;
+    SimplexId size;
+    // rank of the first vertex of the run in its arc
+    SimplexId offset;
+  };
+  vector<vector<Run>> chunkRuns(chunkNb);
+
+  // last trunk node below the rank r
+  const auto getFirstNode = [&](const SimplexId r) -> idNode {
+    return upper_bound(trunkRanks.begin(), trunkRanks.end(), r)
+           - trunkRanks.begin() - 1;
+  };
+
+  // 1. assign the vertices to the arcs, chunk per chunk
+  TaskGroup tasks(taskRuntime_);
+  for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
+    tasks.spawn(
+      [&, chunkId] {
+        const SimplexId lowerBound = begin + chunkId * chunkSize;
+        const SimplexId upperBound
+          = min(nbScalars, (begin + (chunkId + 1) * chunkSize));
+        if(lowerBound >= upperBound) {
+          return;
+        }
+        vector<Run> &runs = chunkRuns[chunkId];
+        idNode node = getFirstNode(lowerBound);
+        for(SimplexId r = lowerBound; r < upperBound; ++r) {
+          while(node + 1 < nbNodes && trunkRanks[node + 1] < r) {
+            ++node;
+          }
+          const SimplexId s = getTreeVertex(r);
+          if(isCorrespondingNull(s)) {
+            updateCorrespondingArc(s, trunkArcs[node]);
+            if(runs.empty() || runs.back().node != node) {
+              runs.push_back({node, 0, 0});
+            }
+            ++runs.back().size;
+          }
+        }
+      },
+      getTaskPriority());
+  }
+  tasks.wait();
+
+  // 2. prefix sum of the runs of each arc (few runs per chunk)
+  vector<SimplexId> arcSizes(nbNodes, 0);
   SimplexId tot = 0;
+  for(auto &runs : chunkRuns) {
+    for(auto &run : runs) {
+      run.offset = arcSizes[run.node];
+      arcSizes[run.node] += run.size;
+      tot += run.size;
+    }
+  }
+
+  if(!params_->segm) {
+    return tot;
+  }
+
+  for(idNode n = 0; n < nbNodes; ++n) {
+    getSuperArc(trunkArcs[n])->atomicIncVisited(arcSizes[n]);
+  }
+
+  // 3. visit order of the vertices in their arc, as for the leaf growth
   for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId) shared(trunkVerts, tot) \
-  OPTIONAL_PRIORITY(isPrior())
-#endif
-    {
-      idNode lastVertInRange = 0;
-      SimplexId acc = 0;
-
-      const SimplexId lowerBound = begin + chunkId * chunkSize;
-      const SimplexId upperBound
-        = min(stop, (begin + (chunkId + 1) * chunkSize));
-      for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const SimplexId s
-          = isST()
-              ? (*scalars_->sortedVertices)[lowerBound + upperBound - 1 - v]
-              : (*scalars_->sortedVertices)[v];
-        if(isCorrespondingNull(s)) {
-          const idNode oldVertInRange = lastVertInRange;
-          lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
-          const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
-          updateCorrespondingArc(s, thisArc);
-
-          if(params_->segm) {
-            if(oldVertInRange == lastVertInRange) {
-              ++acc;
-            } else {
-              // accumulated to have only one atomic update when needed
-              const idSuperArc oldArc
-                = upArcFromVert(trunkVerts[oldVertInRange]);
-              getSuperArc(oldArc)->atomicIncVisited(acc);
-#ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-              tot += acc;
-#endif
-              acc = 1;
+    if(chunkRuns[chunkId].empty()) {
+      continue;
+    }
+    tasks.spawn(
+      [&, chunkId] {
+        const SimplexId lowerBound = begin + chunkId * chunkSize;
+        const SimplexId upperBound
+          = min(nbScalars, (begin + (chunkId + 1) * chunkSize));
+        const vector<Run> &runs = chunkRuns[chunkId];
+        size_t runId = 0;
+        SimplexId order = runs[0].offset;
+        idNode node = getFirstNode(lowerBound);
+        for(SimplexId r = lowerBound; r < upperBound; ++r) {
+          while(node + 1 < nbNodes && trunkRanks[node + 1] < r) {
+            ++node;
+          }
+          const SimplexId s = getTreeVertex(r);
+          if((*mt_data_.visitOrder)[s] == nullVertex && isCorrespondingArc(s)
+             && getCorrespondingSuperArcId(s) == trunkArcs[node]) {
+            if(runs[runId].node != node) {
+              order = runs[++runId].offset;
             }
+            (*mt_data_.visitOrder)[s] = order++;
           }
         }
-      }
-      // force increment last arc
-      const idNode baseNode
-        = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
-      const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
-      getSuperArc(upArc)->atomicIncVisited(acc);
-#ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-      tot += acc;
-#endif
-    } // end task
+      },
+      getTaskPriority());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+  tasks.wait();
+
   return tot;
 }
 
@@ -15,6 +15,7 @@
 #ifndef FTMTREE_MT_H
 #define FTMTREE_MT_H
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <queue>
@@ -40,8 +41,11 @@
 
 #include <Geometry.h>
 #include <AbstractTriangulation.h>
+#include <TaskRuntime.h>
+#include <VertexOrder.h>
 #include <Wrapper.h>
 
+#include "FTMArena.h"
 #include "FTMAtomicUF.h"
 #include "FTMAtomicVector.h"
 #include "FTMDataTypes.h"
@@ -71,22 +75,28 @@ namespace ttk {
       // vertex 2 node / superarc
       std::vector<idCorresp> *vert2tree;
       std::vector<SimplexId> *visitOrder;
-      std::vector<std::list<std::vector<SimplexId>>> *trunkSegments;
 
-      // Track informations
-      std::vector<UF> *ufs, *propagation;
+      // Track informations (ufs, valences, openedNodes and activeTasks are
+      // updated concurrently by the tasks)
+      std::vector<std::atomic<UF>> *ufs;
+      std::vector<UF> *propagation;
+      // storage of the union-find of the leaves, freed at once
+      Arena<AtomicUF> ufArena;
       AtomicVector<CurrentState> *states;
       // valences
-      std::vector<valence> *valences;
+      std::vector<std::atomic<valence>> *valences;
       // opened nodes
-      std::vector<char> *openedNodes;
+      std::vector<std::atomic<char>> *openedNodes;
 
       // current nb of tasks
-      idNode activeTasks;
+      std::atomic<idNode> activeTasks;
 
       // Segmentation, stay empty for Contour tree as
       // they are created by Merge Tree
       Segments segments_;
+      // sorted regular vertices of all the arcs, back to back (see
+      // finalizeSegmentation)
+      std::vector<SimplexId> segmentation_;
 
 #ifdef TTK_ENABLE_FTM_TREE_STATS_TIME
       std::vector<ActiveTask> *activeTasksStats;
@@ -109,6 +119,14 @@ namespace ttk {
       TreeData mt_data_;
       Comparison comp_;
 
+      // executes the tasks of the build (shared by the trees of a CT)
+      std::shared_ptr<TaskRuntime> taskRuntime_;
+
+      // vertex order, and previous field for incremental sorts
+      std::shared_ptr<const VertexOrder::Order> order_, previousOrder_;
+      const void *previousValues_, *previousOffsets_;
+      SimplexId updatedVertexNumber_;
+
     public:
       // -----------
       // CONSTRUCT
@@ -170,8 +188,8 @@ namespace ttk {
         return comp_.vertLower(a, b);
       }
 
-      /// \brief if sortedVertices_ is null, define and fill it
-      /// Also fill the mirror vector
+      /// \brief fill sortedVertices and the mirror vector, from the cache
+      /// of ttk::VertexOrder if possible
       template <typename scalarType, typename idType>
       void sortInput(void);
 
@@ -195,24 +213,21 @@ namespace ttk {
         createVector<idCorresp>(mt_data_.vert2tree);
         mt_data_.vert2tree->resize(scalars_->size);
 
-        createVector<std::list<std::vector<SimplexId>>>(mt_data_.trunkSegments);
-
         createVector<SimplexId>(mt_data_.visitOrder);
         mt_data_.visitOrder->resize(scalars_->size);
 
-        createVector<UF>(mt_data_.ufs);
-        mt_data_.ufs->resize(scalars_->size);
+        createAtomicValues<UF>(mt_data_.ufs);
+        mt_data_.ufArena.clear();
 
         createVector<UF>(mt_data_.propagation);
         mt_data_.propagation->resize(scalars_->size);
 
-        createVector<valence>(mt_data_.valences);
-        mt_data_.valences->resize(scalars_->size);
+        createAtomicValues<valence>(mt_data_.valences);
 
-        createVector<char>(mt_data_.openedNodes);
-        mt_data_.openedNodes->resize(scalars_->size);
+        createAtomicValues<char>(mt_data_.openedNodes);
 
         mt_data_.segments_.clear();
+        std::vector<SimplexId>().swap(mt_data_.segmentation_);
       }
 
       void makeInit(void) {
@@ -258,18 +273,18 @@ namespace ttk {
 
       void closeArcsUF(idNode closeNode, UF uf);
 
-      SimplexId trunk(const bool ct);
+      SimplexId trunk(void);
 
-      virtual SimplexId
-        trunkSegmentation(const std::vector<SimplexId> &pendingNodesVerts,
-                          const SimplexId begin,
-                          const SimplexId stop);
+      /// \brief Opened nodes remaining after the leaf growth, in the order
+      /// of the tree (parallel filter of the sorted vertices).
+      void getTrunkVertices(std::vector<SimplexId> &trunkVerts);
 
-      // fill treedata_.trunkSegments
-      SimplexId
-        trunkCTSegmentation(const std::vector<SimplexId> &pendingNodesVerts,
-                            const SimplexId begin,
-                            const SimplexId stop);
+      /// \brief Assign the vertices above the first trunk node to the trunk
+      /// arcs. The arcs are intervals of the order of the tree: each chunk
+      /// of vertices is processed in parallel and the visit order of the
+      /// vertices in their arc is derived from a prefix sum on the chunks.
+      virtual SimplexId
+        trunkSegmentation(const std::vector<SimplexId> &trunkVerts);
 
       // segmentation
 
@@ -336,6 +351,72 @@ namespace ttk {
         params_->normalize = normalize;
       }
 
+      /// Set the modification time of the scalar and offset fields, so that
+      /// their vertex order can be shared with other modules (see
+      /// ttk::VertexOrder).
+      inline void setScalarsModificationTime(const unsigned long long time) {
+        scalars_->modificationTime = time;
+      }
+
+      /// Incremental sort for time-varying fields: \p order is the vertex
+      /// order (getOrder()) of the previous field (\p values and
+      /// \p offsets), only the vertices which changed since are sorted (see
+      /// ttk::VertexOrder::setPreviousField()).
+      inline void setPreviousField(
+        const void *values,
+        const void *offsets,
+        const std::shared_ptr<const VertexOrder::Order> &order) {
+        previousValues_ = values;
+        previousOffsets_ = offsets;
+        previousOrder_ = order;
+      }
+
+      /// Vertex order of the last computation.
+      inline const std::shared_ptr<const VertexOrder::Order> &
+        getOrder(void) const {
+        return order_;
+      }
+
+      /// Number of vertices which changed since the previous field (all of
+      /// them if no previous field is set).
+      inline SimplexId getUpdatedVertexNumber(void) const {
+        return updatedVertexNumber_;
+      }
+
+      /// Set the runtime executing the tasks of the build (see
+      /// ttk::TaskRuntime). Default: OpenMP tasks.
+      virtual void setTaskRuntime(const std::shared_ptr<TaskRuntime> &runtime) {
+        taskRuntime_ = runtime;
+      }
+
+      inline const std::shared_ptr<TaskRuntime> &getTaskRuntime(void) const {
+        return taskRuntime_;
+      }
+
+      /// Run the tasks of the build on a runtime of type \p type (see
+      /// ttk::TaskRuntime::create()). The current runtime is kept if it
+      /// already has this type.
+      inline void setTaskRuntimeType(const TaskRuntime::Type &type) {
+        if(!taskRuntime_ || taskRuntime_->getType() != type)
+          setTaskRuntime(TaskRuntime::create(type));
+      }
+
+      /// Number of workers running the tasks of the build. The data shared
+      /// by the tasks are std::atomic, so that any runtime can use all the
+      /// threads, with or without OpenMP.
+      inline ThreadId getTaskWorkerNumber(void) const {
+        return threadNumber_;
+      }
+
+      /// Priority of the tasks of this tree.
+      inline int getTaskPriority(void) const {
+#ifdef TTK_ENABLE_OMP_PRIORITY
+        return isPrior();
+#else
+        return 0;
+#endif
+      }
+
 #ifdef TTK_ENABLE_OMP_PRIORITY
       inline void setPrior(void) {
         mt_data_.prior = true;
@@ -356,12 +437,20 @@ namespace ttk {
       template <typename scalarType>
       inline void setVertexScalars(scalarType *vals) {
         scalars_->values = (void *)vals;
+        resetOrder();
       }
 
       // offset
       template <typename idType>
       inline void setVertexSoSoffsets(idType *sos) {
         scalars_->offsets = (void *)sos;
+        resetOrder();
+      }
+
+      // the vertices need to be sorted again
+      inline void resetOrder(void) {
+        scalars_->sortedVertices = nullptr;
+        scalars_->mirrorVertices = nullptr;
       }
 
       // arcs
@@ -583,6 +672,11 @@ namespace ttk {
 
       void printParams(void) const;
 
+      /// Report the memory used by the tree arrays and the segmentation.
+      /// The union-find nodes referenced by the ufs and propagation arrays
+      /// are not accounted for.
+      int getMemoryReport(MemoryReport &report) const override;
+
       int printTime(DebugTimer &t,
                     const std::string &s,
                     SimplexId nbScalars = -1,
@@ -593,12 +687,18 @@ namespace ttk {
       // Tools
       // -----
 
-      idNode getVertInRange(const std::vector<SimplexId> &range,
-                            const SimplexId v,
-                            const idNode last = 0) const;
+      /// Position of \p v in the order in which the tree sweeps the
+      /// vertices (increasing values for the JT, decreasing for the ST).
+      inline SimplexId getTreeRank(const SimplexId v) const {
+        const SimplexId pos = (*scalars_->mirrorVertices)[v];
+        return isST() ? scalars_->size - 1 - pos : pos;
+      }
 
-      std::tuple<SimplexId, SimplexId>
-        getBoundsFromVerts(const std::vector<SimplexId> &nodes) const;
+      /// Vertex at position \p rank in the order of the tree.
+      inline SimplexId getTreeVertex(const SimplexId rank) const {
+        return isST() ? (*scalars_->sortedVertices)[scalars_->size - 1 - rank]
+                      : (*scalars_->sortedVertices)[rank];
+      }
 
       idSuperArc upArcFromVert(const SimplexId v) {
         return getNode(getCorrespondingNodeId(v))->getUpSuperArcId(0);
@@ -693,6 +793,15 @@ namespace ttk {
         ptr->clear();
       }
 
+      // one atomic value per vertex (not resizable, hence reallocated)
+      template <typename type>
+      void createAtomicValues(std::vector<std::atomic<type>> *&ptr) {
+        if(ptr && ptr->size() == (size_t)scalars_->size)
+          return;
+        delete ptr;
+        ptr = new std::vector<std::atomic<type>>(scalars_->size);
+      }
+
       template <typename type>
       void createAtomicVector(AtomicVector<type> *&ptr) {
         if(!ptr)
@@ -710,6 +819,17 @@ namespace ttk {
           (*vect)[i] = val;
         }
       }
+
+      template <typename type>
+      void initVector(std::vector<std::atomic<type>> *&vect, const type val) {
+        auto s = vect->size();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(static)
+#endif
+        for(size_t i = 0; i < s; i++) {
+          (*vect)[i] = val;
+        }
+      }
     };
 
     std::ostream &operator<<(std::ostream &o, Node const &n);
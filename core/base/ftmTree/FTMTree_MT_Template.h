@@ -17,9 +17,6 @@
 #define FTMTREE_MT_TPL_H
 
 #include <functional>
-#if(defined(__GNUC__) && !defined(__clang__))
-#include <parallel/algorithm>
-#endif
 
 #include "FTMTree_MT.h"
 
@@ -32,57 +29,33 @@ namespace ttk {
 
     template <typename scalarType, typename idType>
     void ftm::FTMTree_MT::sortInput(void) {
-      const auto &nbVertices = scalars_->size;
-
-      auto *sortedVect = scalars_->sortedVertices.get();
-      if(sortedVect == nullptr) {
-        sortedVect = new std::vector<SimplexId>(0);
-        scalars_->sortedVertices.reset(sortedVect);
-      } else {
-        sortedVect->clear();
+      VertexOrder vertexOrder;
+      vertexOrder.setDebugLevel(debugLevel_);
+      vertexOrder.setThreadNumber(threadNumber_);
+      vertexOrder.setVertexNumber(scalars_->size);
+      vertexOrder.setInputScalarField(scalars_->values);
+      vertexOrder.setInputOffsets(scalars_->offsets);
+      vertexOrder.setModificationTime(scalars_->modificationTime);
+      if(previousOrder_) {
+        vertexOrder.setPreviousField(
+          previousValues_, previousOffsets_, previousOrder_);
       }
-
-      auto indirect_sort = [&](const size_t &a, const size_t &b) {
-        return isLower<scalarType, idType>(a, b);
-      };
-
-      sortedVect->resize(nbVertices, 0);
-      std::iota(
-        sortedVect->begin(), sortedVect->end(), static_cast<SimplexId>(0));
-
-      // #pragma omp parallel
-      // #pragma omp single
-      //    scalars_->qsort<SimplexId>(sortedVect->data(), 0, scalars_->size -1,
-      //    indirect_sort);
-
-#ifdef TTK_ENABLE_OPENMP
-#ifdef __clang__
-      std::cout << "Caution, outside GCC, sequential sort" << std::endl;
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#else
-      __gnu_parallel::sort(
-        sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-#else
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-
-      auto *mirrorVert = scalars_->mirrorVertices.get();
-      if(mirrorVert == nullptr) {
-        mirrorVert = new std::vector<SimplexId>(0);
-        scalars_->mirrorVertices.reset(mirrorVert);
+      vertexOrder.execute<scalarType, idType>();
+
+      order_ = vertexOrder.getOrder();
+      if(previousOrder_) {
+        // the current field is the previous one of the next sorts
+        if(previousValues_ != scalars_->values
+           || previousOffsets_ != scalars_->offsets) {
+          updatedVertexNumber_ = vertexOrder.getUpdatedVertexNumber();
+        }
+        setPreviousField(scalars_->values, scalars_->offsets, order_);
       } else {
-        mirrorVert->clear();
+        updatedVertexNumber_ = vertexOrder.getUpdatedVertexNumber();
       }
 
-      scalars_->mirrorVertices->resize(nbVertices);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
-#endif
-      for(SimplexId i = 0; i < nbVertices; i++) {
-        (*scalars_->mirrorVertices)[(*sortedVect)[i]] = i;
-      }
+      scalars_->sortedVertices = vertexOrder.getSortedVertices();
+      scalars_->mirrorVertices = vertexOrder.getVertexOrder();
     }
 
   } // namespace ftm
@@ -54,22 +54,7 @@ void ttk::ftm::FTMTree::build(void) {
 
   setDebugLevel(debugLevel_);
   initNbScalars();
-
-  // This section is aimed to prevent un-deterministic results if the data-set
-  // have NaN values in it.
-  // In this loop, we replace every NaN by a 0 value.
-  // Recall: Equals values are distinguished using Simulation of Simplicity in
-  // the FTM tree computation Note: Can we detect NaN using vtk ?
-  if(::std::numeric_limits<scalarType>::has_quiet_NaN) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
-#endif
-    for(SimplexId i = 0; i < scalars_->size; i++) {
-      if(::std::isnan((double)(((scalarType *)scalars_->values)[i]))) {
-        ((scalarType *)scalars_->values)[i] = 0;
-      }
-    }
-  }
+  replaceNaN<scalarType>();
 
   // Alloc / reserve
   DebugTimer initTime;
@@ -131,8 +116,11 @@ void ttk::ftm::FTMTree::build(void) {
   // -----
 
   DebugTimer buildTime;
+  taskRuntime_->setDebugLevel(debugLevel_);
+  taskRuntime_->resetStatistics();
   FTMTree_CT::build(params_->treeType);
   printTime(buildTime, "[FTM] build tree", -1, 3);
+  taskRuntime_->printStatistics(detailedInfoMsg);
 
   printTime(startTime, "[FTM] Total ", -1, 1);
 
@@ -141,19 +129,28 @@ void ttk::ftm::FTMTree::build(void) {
 #endif
 
   // Build the list of regular vertices of the arc
+  // (the segmentation of the merge trees is filled by tasks)
   if(params_->segm) {
     switch(params_->treeType) {
       case TreeType::Join:
-        getJoinTree()->buildSegmentation();
+        taskRuntime_->run(
+          [this] { getJoinTree()->buildSegmentation(); },
+          getTaskWorkerNumber());
         getJoinTree()->finalizeSegmentation();
         break;
       case TreeType::Split:
-        getSplitTree()->buildSegmentation();
+        taskRuntime_->run(
+          [this] { getSplitTree()->buildSegmentation(); },
+          getTaskWorkerNumber());
         getSplitTree()->finalizeSegmentation();
         break;
       case TreeType::Join_Split:
-        getJoinTree()->buildSegmentation();
-        getSplitTree()->buildSegmentation();
+        taskRuntime_->run(
+          [this] {
+            getJoinTree()->buildSegmentation();
+            getSplitTree()->buildSegmentation();
+          },
+          getTaskWorkerNumber());
         getJoinTree()->finalizeSegmentation();
         getSplitTree()->finalizeSegmentation();
         break;
@@ -204,4 +201,31 @@ void ttk::ftm::FTMTree::build(void) {
   }
 }
 
+template <typename scalarType, typename idType>
+void ttk::ftm::FTMTree::sortScalars(void) {
+  initNbScalars();
+  replaceNaN<scalarType>();
+  initSoS<idType>();
+  sortInput<scalarType, idType>();
+}
+
+template <typename scalarType>
+void ttk::ftm::FTMTree::replaceNaN(void) {
+  // This section is aimed to prevent un-deterministic results if the data-set
+  // have NaN values in it.
+  // In this loop, we replace every NaN by a 0 value.
+  // Recall: Equals values are distinguished using Simulation of Simplicity in
+  // the FTM tree computation Note: Can we detect NaN using vtk ?
+  if(::std::numeric_limits<scalarType>::has_quiet_NaN) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+    for(SimplexId i = 0; i < scalars_->size; i++) {
+      if(::std::isnan((double)(((scalarType *)scalars_->values)[i]))) {
+        ((scalarType *)scalars_->values)[i] = 0;
+      }
+    }
+  }
+}
+
 #endif /* end of include guard: FTMTREE_TPL_H */
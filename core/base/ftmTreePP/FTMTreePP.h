@@ -26,6 +26,7 @@ namespace ttk {
     class FTMTreePP : public FTMTree {
     private:
       std::vector<AtomicUF *> nodesUF_;
+      Arena<AtomicUF> ufArena_;
 
     public:
       FTMTreePP();
@@ -36,6 +37,40 @@ namespace ttk {
         std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
         const bool jt);
 
+      /// \brief Streaming computation of the persistence pairs of the join
+      /// tree (\p jt) or of the split tree, without building the tree.
+      ///
+      /// The vertices are swept by increasing (resp. decreasing) values and
+      /// the components of the sublevel (resp. superlevel) sets are tracked
+      /// with a union-find whose roots are the extrema of the components.
+      /// When several components meet at a vertex, all of them but the one
+      /// with the oldest extremum die there and their pairs are emitted
+      /// (elder rule). Only the union-find and the pairs are stored: no
+      /// node, arc or segmentation.
+      ///
+      /// The pairs are the ones of computePersistencePairs(), sorted by
+      /// persistence, the ties being broken by the vertex order of the
+      /// saddle then of the extremum. The pair of the global extremum,
+      /// closed by the last vertex of the sweep, comes last.
+      ///
+      /// The last vertex of the sweep is the root of the tree. If
+      /// \p rootArcNumber is not nullptr, it is set to the number of arcs
+      /// of the tree merged at the root (the components of its lower link,
+      /// resp. upper link). The other connected components of the domain
+      /// are not adjacent to the root: their pairs are closed by the root
+      /// but do not count as arcs.
+      ///
+      /// The vertices are sorted by the first call only (or by
+      /// sortScalars()): the join and split sweeps share that order.
+      ///
+      /// Need triangulation, scalars and offsets set before call.
+      /// \return Returns 0 upon success, negative values otherwise.
+      template <typename scalarType, typename idType>
+      int computeStreamingPersistencePairs(
+        std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+        const bool jt,
+        SimplexId *rootArcNumber = nullptr);
+
     protected:
       template <typename scalarType>
       void computePairs(
@@ -116,8 +151,9 @@ void ttk::ftm::FTMTreePP::computePersistencePairs(
   pairs.reserve(tree->getNumberOfLeaves());
 
   const auto nbNodes = tree->getNumberOfNodes();
+  ufArena_.reserve(nbNodes);
   for(idNode nid = 0; nid < nbNodes; ++nid) {
-    nodesUF_[nid] = new AtomicUF(tree->getNode(nid)->getVertexId());
+    nodesUF_[nid] = ufArena_.create(tree->getNode(nid)->getVertexId());
   }
 
   computePairs<scalarType>(tree, pairs);
@@ -125,10 +161,131 @@ void ttk::ftm::FTMTreePP::computePersistencePairs(
   sortPairs<scalarType>(tree, pairs);
 
   // destruct
-  for(AtomicUF *uf : nodesUF_) {
-    delete uf;
-    uf = nullptr;
+  nodesUF_.clear();
+  ufArena_.clear();
+}
+
+template <typename scalarType, typename idType>
+int ttk::ftm::FTMTreePP::computeStreamingPersistencePairs(
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+  const bool jt,
+  SimplexId *rootArcNumber) {
+
+  DebugTimer streamTime;
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!mesh_)
+    return -1;
+  if(!scalars_->values)
+    return -2;
+#endif
+
+  if(!scalars_->sortedVertices)
+    sortScalars<scalarType, idType>();
+
+  const SimplexId nbVerts = scalars_->size;
+  const std::vector<SimplexId> &sortedVertices = *scalars_->sortedVertices;
+  const scalarType *values = static_cast<const scalarType *>(scalars_->values);
+
+  pairs.clear();
+  if(rootArcNumber)
+    *rootArcNumber = 0;
+  if(!nbVerts)
+    return 0;
+
+  // position of a vertex in the sweep
+  auto getRank = [&](const SimplexId v) {
+    const SimplexId pos = (*scalars_->mirrorVertices)[v];
+    return jt ? pos : nbVerts - 1 - pos;
+  };
+
+  // union-find on the swept vertices (-1: not swept yet), the root of a
+  // component is its extremum
+  std::vector<SimplexId> parents(nbVerts, -1);
+  auto find = [&parents](SimplexId v) {
+    while(parents[v] != v) {
+      // path halving
+      parents[v] = parents[parents[v]];
+      v = parents[v];
+    }
+    return v;
+  };
+
+  auto addPair = [&](const SimplexId extremum, const SimplexId saddle) {
+    const scalarType persistence = jt ? values[saddle] - values[extremum]
+                                      : values[extremum] - values[saddle];
+    pairs.emplace_back(extremum, saddle, persistence);
+  };
+
+  std::vector<SimplexId> roots;
+  for(SimplexId r = 0; r < nbVerts; ++r) {
+    const SimplexId v
+      = jt ? sortedVertices[r] : sortedVertices[nbVerts - 1 - r];
+
+    // components of the lower link
+    roots.clear();
+    const SimplexId nbNeigh = mesh_->getVertexNeighborNumber(v);
+    for(SimplexId n = 0; n < nbNeigh; ++n) {
+      SimplexId neigh;
+      mesh_->getVertexNeighbor(v, n, neigh);
+      if(parents[neigh] != -1) {
+        const SimplexId root = find(neigh);
+        if(std::find(roots.begin(), roots.end(), root) == roots.end())
+          roots.push_back(root);
+      }
+    }
+
+    if(roots.empty()) {
+      // extremum
+      parents[v] = v;
+      continue;
+    }
+
+    // the oldest extremum survives
+    SimplexId elder = roots[0];
+    for(const SimplexId root : roots) {
+      if(getRank(root) < getRank(elder))
+        elder = root;
+    }
+    for(const SimplexId root : roots) {
+      if(root != elder) {
+        addPair(root, v);
+        parents[root] = elder;
+      }
+    }
+    parents[v] = elder;
+    if(rootArcNumber && r == nbVerts - 1)
+      *rootArcNumber = roots.size();
   }
+
+  // total order: the output does not depend on the neighbor order
+  auto comp = [&](const std::tuple<SimplexId, SimplexId, scalarType> &a,
+                  const std::tuple<SimplexId, SimplexId, scalarType> &b) {
+    if(std::get<2>(a) != std::get<2>(b))
+      return std::get<2>(a) < std::get<2>(b);
+    if(std::get<1>(a) != std::get<1>(b))
+      return getRank(std::get<1>(a)) < getRank(std::get<1>(b));
+    return getRank(std::get<0>(a)) < getRank(std::get<0>(b));
+  };
+  std::sort(pairs.begin(), pairs.end(), comp);
+
+  // the remaining components are closed by the last vertex (global extremum
+  // pair), they have the highest persistence
+  const SimplexId last = jt ? sortedVertices[nbVerts - 1] : sortedVertices[0];
+  for(SimplexId v = 0; v < nbVerts; ++v) {
+    if(parents[v] == v && v != last)
+      addPair(v, last);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[FTMTreePP] Streaming " << (jt ? "JT" : "ST") << " pairs ("
+        << pairs.size() << ") in " << streamTime.getElapsedTime() << " s."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
 }
 
 template <typename scalarType>
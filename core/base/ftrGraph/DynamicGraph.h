@@ -16,6 +16,7 @@
 
 #include "FTRCommon.h"
 
+#include <atomic>
 #include <set>
 #include <vector>
 
@@ -218,7 +219,7 @@ namespace ttk {
 
       void reset() {
         for(auto &node : this->nodes_) {
-          node.parent_ = nullptr;
+          node.parent_.store(nullptr, std::memory_order_relaxed);
           node.weight_ = 0;
           std::ignore = node;
         }
@@ -289,10 +290,11 @@ namespace ttk {
     /// of a tree and the link to its parent if not the root
     template <typename Type>
     struct DynGraphNode {
-      DynGraphNode *parent_;
+      // read by the concurrent tasks while an other task may update them
+      std::atomic<DynGraphNode *> parent_;
       Type weight_;
 
-      idSuperArc corArc_;
+      std::atomic<idSuperArc> corArc_;
 
       explicit DynGraphNode()
         : parent_(nullptr), weight_(0), corArc_(nullSuperArc) {
@@ -303,7 +305,7 @@ namespace ttk {
       }
 
       DynGraphNode &operator=(const DynGraphNode &other) {
-        parent_ = other.parent_;
+        parent_.store(other.parent_, std::memory_order_relaxed);
         weight_ = other.weight_;
         return *this;
       }
@@ -335,12 +337,7 @@ namespace ttk {
 
       /// Get the arcs corresponding to this subtree
       idSuperArc getCorArc() const {
-        idSuperArc corArc;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read
-#endif
-        corArc = corArc_;
-        return corArc;
+        return corArc_.load(std::memory_order_relaxed);
       }
 
       void setRootArc(const idSuperArc arcId);
@@ -53,13 +53,13 @@ namespace ttk {
         if(1 or node.parent_) {
           res << "id: " << &node - &nodes_[0];
           if(node.parent_) {
-            res << ", parent: " << node.parent_ - &nodes_[0];
+            res << ", parent: " << node.parent_.load() - &nodes_[0];
           } else {
             res << ", parent: X";
           }
           res << " root: " << findRoot(&node) - &nodes_[0];
           res << " weight: " << (float)node.weight_;
-          res << " cArc: " << node.corArc_;
+          res << " cArc: " << node.getCorArc();
           res << endl;
         }
       }
@@ -78,7 +78,8 @@ namespace ttk {
           res << "id: " << printFunction(&node - &nodes_[0])
               << " weight: " << (float)node.weight_;
           if(node.parent_) {
-            res << ", parent: " << printFunction(node.parent_ - &nodes_[0]);
+            res << ", parent: "
+                << printFunction(node.parent_.load() - &nodes_[0]);
           } else {
             res << ", parent: X";
           }
@@ -120,11 +121,11 @@ namespace ttk {
       DynGraphNode<Type> *gParentNode = parentNode->parent_;
       Type gParentWeight = parentNode->weight_;
 
-      curNode->parent_ = nullptr;
+      curNode->parent_.store(nullptr, std::memory_order_relaxed);
 
       // Reverse all the node until the root
       while(true) {
-        parentNode->parent_ = curNode;
+        parentNode->parent_.store(curNode, std::memory_order_relaxed);
         parentNode->weight_ = parentWeight;
 
         curNode = parentNode;
@@ -137,7 +138,7 @@ namespace ttk {
         } else {
           // keep same arc than the current root
           // if cur > this ?
-          corArc_ = curNode->corArc_;
+          corArc_.store(curNode->corArc_, std::memory_order_relaxed);
           break;
         }
       }
@@ -151,22 +152,19 @@ namespace ttk {
       DynGraphNode *lastNode = curNode;
       while(curNode) {
         lastNode = curNode;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read
-#endif
-        curNode = curNode->parent_;
+        curNode = curNode->parent_.load(std::memory_order_relaxed);
       }
       return lastNode;
     }
 
     template <typename Type>
     idSuperArc DynGraphNode<Type>::findRootArc(void) const {
-      return findRoot()->corArc_;
+      return findRoot()->getCorArc();
     }
 
     template <typename Type>
     void DynGraphNode<Type>::setRootArc(const idSuperArc arcId) {
-      corArc_ = arcId;
+      corArc_.store(arcId, std::memory_order_relaxed);
     }
 
     template <typename Type>
@@ -199,9 +197,9 @@ namespace ttk {
 
       if(std::get<0>(nNodes) != this) {
         // The two nodes are in two different trees
-        parent_ = n;
+        parent_.store(n, std::memory_order_relaxed);
         weight_ = weight;
-        n->corArc_ = corArc;
+        n->corArc_.store(corArc, std::memory_order_relaxed);
         return true;
       }
 
@@ -212,15 +210,15 @@ namespace ttk {
         // higher
 
         // add arc (Parsa like)
-        parent_ = n;
+        parent_.store(n, std::memory_order_relaxed);
         weight_ = weight;
         // corArc_ = corArc;
 
         // remove old
-        std::get<1>(nNodes)->parent_ = 0;
-        std::get<1>(nNodes)->corArc_ = corArc;
+        std::get<1>(nNodes)->parent_.store(nullptr, std::memory_order_relaxed);
+        std::get<1>(nNodes)->corArc_.store(corArc, std::memory_order_relaxed);
       } else {
-        corArc_ = corArc;
+        corArc_.store(corArc, std::memory_order_relaxed);
       }
 
       return false;
@@ -236,7 +234,7 @@ namespace ttk {
       }
 #endif
 
-      parent_ = nullptr;
+      parent_.store(nullptr, std::memory_order_relaxed);
     }
 
   } // namespace ftr
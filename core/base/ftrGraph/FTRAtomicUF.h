@@ -13,6 +13,7 @@
 #define ATOMICUFFTR_H
 
 // c++ includes
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -23,9 +24,9 @@ namespace ttk {
 
     class AtomicUF {
     private:
-      unsigned rank_;
-      AtomicUF *parent_;
-      Propagation *prop_;
+      std::atomic<unsigned> rank_;
+      std::atomic<AtomicUF *> parent_;
+      std::atomic<Propagation *> prop_;
 
     public:
       inline explicit AtomicUF(Propagation *const p) : rank_(0), prop_{p} {
@@ -34,16 +35,14 @@ namespace ttk {
 
       // heavy recursif
       inline AtomicUF *find() {
-        if(parent_ == this)
+        AtomicUF *parent = parent_;
+        if(parent == this)
           return this;
         else {
-          decltype(parent_) tmp = parent_->find();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
+          AtomicUF *tmp = parent->find();
           parent_ = tmp;
 
-          return parent_;
+          return tmp;
         }
       }
 
@@ -54,9 +53,6 @@ namespace ttk {
       }
 
       inline void setPropagation(Propagation *const p) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         prop_ = p;
       }
 
@@ -67,16 +63,10 @@ namespace ttk {
       }
 
       inline void setRank(const int &rank) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         rank_ = rank;
       }
 
       inline void setParent(AtomicUF *parent) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         parent_ = parent;
       }
 
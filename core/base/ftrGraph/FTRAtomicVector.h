@@ -9,10 +9,9 @@
 #ifndef ATOMICVECTOR_H
 #define ATOMICVECTOR_H
 
-#ifdef TTK_ENABLE_OPENMP
-#include <omp.h>
-#endif // TTK_ENABLE_OPENMP
+#include <atomic>
 #include <iterator>
+#include <mutex>
 #include <vector>
 
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -24,7 +23,14 @@ namespace ttk {
   template <typename type>
   class AtomicVector : public std::vector<type> {
   private:
-    std::size_t nextId;
+    std::atomic<std::size_t> nextId;
+
+    // serializes the growths of the vectors, which may be requested by
+    // concurrent tasks whatever the task runtime
+    static std::mutex &reserveMutex(void) {
+      static std::mutex mutex;
+      return mutex;
+    }
 
   public:
     explicit AtomicVector(const std::size_t initSize = 1)
@@ -43,7 +49,7 @@ namespace ttk {
 
     // copy constructor
     AtomicVector(const AtomicVector &other)
-      : std::vector<type>(other), nextId(other.nextId) {
+      : std::vector<type>(other), nextId(other.nextId.load()) {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(!std::vector<type>::size()) {
         reserve(1);
@@ -52,7 +58,9 @@ namespace ttk {
     }
 
     // move constructor
-    AtomicVector(AtomicVector &&other) = default;
+    AtomicVector(AtomicVector &&other)
+      : std::vector<type>(std::move(other)), nextId(other.nextId.load()) {
+    }
 
     virtual ~AtomicVector() = default;
 
@@ -60,37 +68,17 @@ namespace ttk {
     // STL
     // ---
 
-    void reserve(const std::size_t &newSize, const bool fromOther = false) {
+    void reserve(const std::size_t &newSize) {
       if(newSize > std::vector<type>::size()) {
-#ifndef TTK_ENABLE_KAMIKAZE
-#ifdef TTK_ENABLE_OPENMP
-        if(omp_in_parallel()) {
-          // WARNING: In parallel we do not want to make reserve as it can lead
-          // to data race, we should not enter here
-#pragma omp critical(AtomicUFReserve)
-          {
-            // if (fromOther)
-            //    std::cout << " a function in the class ";
-            // std::cout << "call RE-Reserve in AtomicVector " << nextId;
-            // std::cout << " ! Data Race may occurs ! " << typeid(this).name()
-            // << std::endl;
-
-            std::vector<type>::resize(newSize);
-          }
-
-        } else
-#endif
-#endif
-        {
+        // WARNING: In parallel we do not want to make reserve as it can lead
+        // to data race, we should not enter here
+        std::lock_guard<std::mutex> lock(reserveMutex());
+        if(newSize > std::vector<type>::size())
           std::vector<type>::resize(newSize);
-        }
       }
     }
 
     void reset(const std::size_t &nId = 0) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
       nextId = nId;
     }
 
@@ -100,18 +88,14 @@ namespace ttk {
       // Remove old content
       std::size_t oldSize = std::vector<type>::size();
       std::vector<type>::clear();
-      reserve(oldSize, true);
+      reserve(oldSize);
     }
 
     std::size_t getNext(void) {
-      std::size_t resId;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-      resId = nextId++;
+      const std::size_t resId = nextId++;
 
-      if(nextId == std::vector<type>::size()) {
-        reserve(std::vector<type>::size() * 2, true);
+      if(resId + 1 == std::vector<type>::size()) {
+        reserve(std::vector<type>::size() * 2);
       }
 
       return resId;
@@ -138,9 +122,6 @@ namespace ttk {
     }
 
     void pop_back(void) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
       --nextId;
     }
 
@@ -150,13 +131,13 @@ namespace ttk {
 
     AtomicVector<type> &operator=(const AtomicVector<type> &other) {
       std::vector<type>::operator=(other);
-      nextId = other.nextId;
+      nextId = other.nextId.load();
       return *this;
     }
 
     AtomicVector<type> &operator=(AtomicVector<type> &&other) {
       std::vector<type>::operator=(std::move(other));
-      nextId = std::move(other.nextId);
+      nextId = other.nextId.load();
       return *this;
     }
 
@@ -28,6 +28,7 @@
 #endif
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <vector>
 
@@ -83,6 +84,17 @@ namespace ttk {
         }
       }
 
+      template <typename type>
+      void fillVector(std::vector<std::atomic<type>> &vect, const type &elmt) {
+        const std::size_t nbIt = vect.size();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for(std::size_t i = 0; i < nbIt; i++) {
+          vect[i].store(elmt, std::memory_order_relaxed);
+        }
+      }
+
       virtual void alloc() = 0;
 
       virtual void init() = 0;
@@ -15,6 +15,7 @@
 #define _FTRGRAPH_H
 
 // base code includes
+#include <TaskRuntime.h>
 #include <Triangulation.h>
 
 // local includes
@@ -36,6 +37,9 @@
 #endif
 
 // c++ includes
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <tuple>
 
@@ -82,11 +86,17 @@ namespace ttk {
       Lazy lazy_;
 #endif
 
+      // tasks of the sweep
+      std::shared_ptr<TaskRuntime> taskRuntime_;
+      // protect the node creation at saddles
+      std::mutex nodesMutex_;
+
 #ifdef TTK_ENABLE_FTR_TASK_STATS
       // Stats
       DebugTimer sweepStart_;
       std::vector<float> propTimes_;
-      idVertex nbProp_;
+      std::atomic<idVertex> nbProp_;
+      std::mutex statsMutex_;
 #endif
 
     public:
@@ -178,6 +188,23 @@ namespace ttk {
         threadNumber_ = params_.threadNumber;
       }
 
+      /// Runtime executing the tasks of the sweep (see ttk::TaskRuntime).
+      /// Default: OpenMP tasks.
+      void setTaskRuntime(const std::shared_ptr<TaskRuntime> &runtime) {
+        taskRuntime_ = runtime;
+      }
+
+      const std::shared_ptr<TaskRuntime> &getTaskRuntime(void) const {
+        return taskRuntime_;
+      }
+
+      /// Select the task runtime by type (see ttk::TaskRuntime::create()).
+      /// The current runtime is kept if it already has this type.
+      void setTaskRuntimeType(const TaskRuntime::Type &type) {
+        if(!taskRuntime_ || taskRuntime_->getType() != type)
+          setTaskRuntime(TaskRuntime::create(type));
+      }
+
       /// Scalar field used to compute the Reeb Graph
       void setScalars(const void *scalars) {
         scalars_->setScalars((ScalarType *)scalars);
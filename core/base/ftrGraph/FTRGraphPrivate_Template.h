@@ -35,13 +35,11 @@ namespace ttk {
           // This propagation is dying here
           idVertex curProp;
           float curTime;
-#pragma omp atomic capture seq_cst
+          curProp = nbProp_--;
           {
-            curProp = nbProp_;
-            --nbProp_;
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            curTime = sweepStart_.getElapsedTime();
           }
-#pragma omp critical(stats)
-          { curTime = sweepStart_.getElapsedTime(); }
           propTimes_[curProp - 1] = curTime;
         }
 #endif
@@ -69,13 +67,11 @@ namespace ttk {
             // This propagation is dying here
             idVertex curProp;
             float curTime;
-#pragma omp atomic capture seq_cst
+            curProp = nbProp_--;
             {
-              curProp = nbProp_;
-              --nbProp_;
+              std::lock_guard<std::mutex> lock(statsMutex_);
+              curTime = sweepStart_.getElapsedTime();
             }
-#pragma omp critical(stats)
-            { curTime = sweepStart_.getElapsedTime(); }
             propTimes_[curProp - 1] = curTime;
           }
 #endif
@@ -211,13 +207,11 @@ namespace ttk {
               // This propagation is dying here
               idVertex curProp;
               float curTime;
-#pragma omp atomic capture seq_cst
+              curProp = nbProp_--;
               {
-                curProp = nbProp_;
-                --nbProp_;
+                std::lock_guard<std::mutex> lock(statsMutex_);
+                curTime = sweepStart_.getElapsedTime();
               }
-#pragma omp critical(stats)
-              { curTime = sweepStart_.getElapsedTime(); }
               propTimes_[curProp - 1] = curTime;
             }
 #endif
@@ -241,13 +235,11 @@ namespace ttk {
           // This propagation is dying here
           idVertex curProp;
           float curTime;
-#pragma omp atomic capture seq_cst
+          curProp = nbProp_--;
           {
-            curProp = nbProp_;
-            --nbProp_;
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            curTime = sweepStart_.getElapsedTime();
           }
-#pragma omp critical(stats)
-          { curTime = sweepStart_.getElapsedTime(); }
           propTimes_[curProp - 1] = curTime;
         }
 #endif
@@ -263,10 +255,8 @@ namespace ttk {
       bool hideFromHere
         = false; // if true, new arc are hidden to stop propagation.
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
       {
+        std::lock_guard<std::mutex> lock(nodesMutex_);
         bool alreadyNode = graph_.isNode(upVert);
         hideFromHere = alreadyNode;
         if(isJoin) {
@@ -334,13 +324,11 @@ namespace ttk {
             // This propagation is dying here
             idVertex curProp;
             float curTime;
-#pragma omp atomic capture seq_cst
+            curProp = nbProp_--;
             {
-              curProp = nbProp_;
-              --nbProp_;
+              std::lock_guard<std::mutex> lock(statsMutex_);
+              curTime = sweepStart_.getElapsedTime();
             }
-#pragma omp critical(stats)
-            { curTime = sweepStart_.getElapsedTime(); }
             propTimes_[curProp - 1] = curTime;
           }
 #endif
@@ -361,18 +349,18 @@ namespace ttk {
       }
 
       // starting from the saddle
+      // the continuation is waited for here so that the group of the seeds
+      // covers every propagation, whatever the runtime
       if(isSplit && (!isJoin || isJoinLast)) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task OPTIONAL_PRIORITY(PriorityLevel::Low)
-#endif
-        growthFromSeed(upVert, localProp);
+        TaskGroup continuation(taskRuntime_);
+        continuation.spawn(
+          [=]() { growthFromSeed(upVert, localProp); }, PriorityLevel::Low);
 
       } else if(isJoinLast) {
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task OPTIONAL_PRIORITY(PriorityLevel::Average)
-#endif
-        growthFromSeed(upVert, localProp, joinParentArc);
+        TaskGroup continuation(taskRuntime_);
+        continuation.spawn(
+          [=]() { growthFromSeed(upVert, localProp, joinParentArc); },
+          PriorityLevel::Average);
       }
 #ifdef TTK_ENABLE_FTR_TASK_STATS
       else {
@@ -380,13 +368,11 @@ namespace ttk {
         // This propagation is dying here
         idVertex curProp;
         float curTime;
-#pragma omp atomic capture seq_cst
+        curProp = nbProp_--;
         {
-          curProp = nbProp_;
-          --nbProp_;
+          std::lock_guard<std::mutex> lock(statsMutex_);
+          curTime = sweepStart_.getElapsedTime();
         }
-#pragma omp critical(stats)
-        { curTime = sweepStart_.getElapsedTime(); }
         propTimes_[curProp - 1] = curTime;
       }
 #endif
@@ -894,65 +880,18 @@ namespace ttk {
         }
       }
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-value"
-#endif // __GNUC__
-
-      valence oldVal = 0;
-      if(localProp->goUp()) {
-        // for gcc 4.8 and old openMP
-        valence *const vd = &graph_.valDown_[curSaddle];
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-        {
-          oldVal = *vd;
-          *vd -= decr;
-        }
-
-      } else {
-        valence *const vu = &graph_.valUp_[curSaddle];
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-        {
-          oldVal = *vu;
-          *vu -= decr;
-        }
-      }
+      std::atomic<valence> &val = localProp->goUp()
+                                    ? graph_.valDown(curSaddle)
+                                    : graph_.valUp(curSaddle);
+      valence oldVal = val.fetch_sub(decr);
 
       if(oldVal == -1) {
         // First task to touch this saddle, compute the valence
         idVertex totalVal = starVect.size();
-        valence newVal = 0;
-        if(localProp->goUp()) {
-          valence *const vd = &graph_.valDown_[curSaddle];
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-          {
-            newVal = *vd;
-            *vd += (totalVal + 1);
-          }
-
-        } else {
-          valence *const vu = &graph_.valUp_[curSaddle];
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic capture
-#endif
-          {
-            newVal = *vu;
-            *vu += (totalVal + 1);
-          }
-        }
+        const valence newVal = val.fetch_add(totalVal + 1);
         oldVal = decr + newVal + (totalVal + 1);
       }
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic pop
-#endif // __GNUC__
-
       return oldVal == decr;
     }
 
@@ -1039,12 +978,7 @@ namespace ttk {
       {
         propagations_.visit(curVert, localProp);
         opposite = propagations_.visitOpposite(curVert, localProp);
-        bool done;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read seq_cst
-#endif
-        done = opposite.done;
-        if(!done) {
+        if(!opposite.done) {
           graph_.visit(curVert, curArc);
           retArc = nullSuperArc;
         } else {
@@ -12,12 +12,6 @@
 #include <iterator>
 #endif
 
-#ifdef TTK_ENABLE_OMP_PRIORITY
-#define OPTIONAL_PRIORITY(value) priority(value)
-#else
-#define OPTIONAL_PRIORITY(value)
-#endif
-
 #ifdef GPROFILE
 #include <gperftools/profiler.h>
 #endif
@@ -26,13 +20,15 @@ namespace ttk {
   namespace ftr {
     template <typename ScalarType>
     FTRGraph<ScalarType>::FTRGraph()
-      : params_{}, scalars_{new Scalars<ScalarType>}, mesh_{} {
+      : params_{}, scalars_{new Scalars<ScalarType>}, mesh_{},
+        taskRuntime_{TaskRuntime::create(TaskRuntime::getDefaultType())} {
       // need a call to setupTriangulation later
     }
 
     template <typename ScalarType>
     FTRGraph<ScalarType>::FTRGraph(Triangulation *mesh)
-      : params_{}, scalars_{new Scalars<ScalarType>}, mesh_{} {
+      : params_{}, scalars_{new Scalars<ScalarType>}, mesh_{},
+        taskRuntime_{TaskRuntime::create(TaskRuntime::getDefaultType())} {
       setupTriangulation(mesh);
     }
 
@@ -55,9 +51,9 @@ namespace ttk {
 
 #ifdef TTK_ENABLE_OPENMP
       omp_set_num_threads(params_.threadNumber);
-      omp_set_nested(1);
 #ifdef TTK_ENABLE_OMP_PRIORITY
-      if(omp_get_max_task_priority() < PriorityLevel::Max) {
+      if(taskRuntime_->getType() == TaskRuntime::Type::OPENMP
+         && omp_get_max_task_priority() < PriorityLevel::Max) {
         std::stringstream msg;
         msg << "[FTR Graph]: Warning, OpenMP max priority is lower than 5"
             << std::endl;
@@ -104,14 +100,8 @@ namespace ttk {
 
       DebugTimer timeBuild;
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel num_threads(params_.threadNumber)
-#endif
-      {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp single nowait
-#endif
-        {
+      taskRuntime_->run(
+        [this]() {
           DebugTimer timeCritSearch;
           criticalSearch();
           printTime(timeCritSearch, "[FTR Graph]: leaf search time ", timeMsg);
@@ -120,8 +110,8 @@ namespace ttk {
           sweepFrowSeeds();
           // sweepSequential();
           printTime(timeSwipe, "[FTR Graph]: sweepFrowSeeds time: ", timeMsg);
-        }
-      }
+        },
+        params_.threadNumber);
       printTime(timeBuild, "[FTR Graph]: build time: ", timeMsg);
 
       // Debug print
@@ -205,12 +195,10 @@ namespace ttk {
       leafChunkParams.grainSize = 10000;
       auto leafChunk = Tasks::getChunk(leafChunkParams);
 
+      TaskGroup leafTasks(taskRuntime_);
       for(idPropagation leafChunkId = 0; leafChunkId < std::get<1>(leafChunk);
           ++leafChunkId) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(leafChunkId)
-#endif
-        {
+        leafTasks.spawn([&, leafChunkId]() {
           const idVertex lowerBound
             = Tasks::getBegin(leafChunkId, std::get<0>(leafChunk));
           const idVertex upperBound = Tasks::getEnd(
@@ -230,11 +218,9 @@ namespace ttk {
               graph_.addLeaf(v, false);
             }
           }
-        } // end task
+        }); // end task
       }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
+      leafTasks.wait();
 #ifdef TTK_ENABLE_FTR_TASK_STATS
       // Stats
       nbProp_ = graph_.getNumberOfLeaves();
@@ -258,11 +244,9 @@ namespace ttk {
 
 #ifdef TTK_ENABLE_FTR_TASK_STATS
       sweepStart_.reStart();
-#endif
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskgroup
 #endif
       {
+        TaskGroup seedTasks(taskRuntime_);
         for(idNode i = 0; i < nbSeed; i++) {
           // alterneate min/max, string at the deepest
           idVertex l = (i % 2) ? i / 2 : nbSeed - 1 - i / 2;
@@ -276,10 +260,9 @@ namespace ttk {
             = graph_.openArc(graph_.makeNode(corLeaf), localPropagation);
           // graph_.visit(corLeaf, newArc);
           // process
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp task OPTIONAL_PRIORITY(PriorityLevel::Higher)
-#endif
-          growthFromSeed(corLeaf, localPropagation, newArc);
+          seedTasks.spawn(
+            [=]() { growthFromSeed(corLeaf, localPropagation, newArc); },
+            PriorityLevel::Higher);
         }
       }
     }
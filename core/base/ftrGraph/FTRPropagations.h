@@ -17,13 +17,28 @@
 #include "FTRPropagation.h"
 
 // c++ includes
+#include <atomic>
 #include <vector>
 
 namespace ttk {
   namespace ftr {
     struct Visit {
       Propagation *prop;
-      bool done;
+      // read by the opposite propagation while being set
+      std::atomic<bool> done;
+
+      Visit(Propagation *const p = nullptr, const bool d = false)
+        : prop{p}, done{d} {
+      }
+
+      Visit(const Visit &other) : prop{other.prop}, done{other.done.load()} {
+      }
+
+      Visit &operator=(const Visit &other) {
+        prop = other.prop;
+        done.store(other.done);
+        return *this;
+      }
     };
 
     struct Visits {
@@ -109,19 +124,11 @@ namespace ttk {
       // .done)
       bool hasVisitedOpposite(const idVertex v, Propagation *const prop) const {
         // reversed
-        bool res;
         if(prop->goUp()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read seq_cst
-#endif
-          res = visits_.down[v].done;
+          return visits_.down[v].done;
         } else {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read seq_cst
-#endif
-          res = visits_.up[v].done;
+          return visits_.up[v].done;
         }
-        return res;
       }
 
       Visit visit(const idVertex v, const Propagation *const prop) const {
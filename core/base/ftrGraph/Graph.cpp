@@ -141,12 +141,13 @@ void Graph::alloc() {
   nodes_.reserve(nbElmt_ * 2);
   arcs_.reserve(nbElmt_ * 2);
   segmentation_.resize(nbElmt_);
-  valUp_.resize(nbElmt_);
-  valDown_.resize(nbElmt_);
+  // atomics cannot be moved by resize
+  std::vector<std::atomic<valence>>(nbElmt_).swap(valUp_);
+  std::vector<std::atomic<valence>>(nbElmt_).swap(valDown_);
 
 #ifdef TTK_ENABLE_FTR_VERT_STATS
-  nbTouch_.resize(nbElmt_);
-  nbArcActif_.resize(nbElmt_);
+  std::vector<std::atomic<idVertex>>(nbElmt_).swap(nbTouch_);
+  std::vector<std::atomic<idSuperArc>>(nbElmt_).swap(nbArcActif_);
   avoided_ = 0;
 #endif
 }
@@ -25,6 +25,7 @@
 #include <iostream>
 #endif
 
+#include <atomic>
 #include <vector>
 
 namespace ttk {
@@ -44,14 +45,14 @@ namespace ttk {
       std::vector<SegmInfo> segmentation_;
 
 #ifdef TTK_ENABLE_FTR_VERT_STATS
-      std::vector<idVertex> nbTouch_;
-      std::vector<idSuperArc> nbArcActif_;
-      idVertex avoided_;
+      std::vector<std::atomic<idVertex>> nbTouch_;
+      std::vector<std::atomic<idSuperArc>> nbArcActif_;
+      std::atomic<idVertex> avoided_;
 #endif
 
     public:
-      // For openmp capture, we need direct access...
-      std::vector<valence> valDown_, valUp_;
+      // updated concurrently by the tasks reaching a saddle
+      std::vector<std::atomic<valence>> valDown_, valUp_;
 
       Graph();
       Graph(Graph &&other) = default;
@@ -69,7 +70,7 @@ namespace ttk {
 #ifdef TTK_ENABLE_FTR_VERT_STATS
           nbTouch_ = std::move(other.nbTouch_);
           nbArcActif_ = std::move(other.nbArcActif_);
-          avoided_ = std::move(other.avoided_);
+          avoided_.store(other.avoided_);
 #endif
         }
         return *this;
@@ -144,9 +145,6 @@ namespace ttk {
 
 #ifdef TTK_ENABLE_FTR_VERT_STATS
       void incTouch(const idVertex v) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
         nbTouch_[v]++;
       }
 
@@ -155,9 +153,6 @@ namespace ttk {
       }
 
       void setNbArcActive(const idVertex v, const idSuperArc nb) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
         nbArcActif_[v] = nb;
       }
 
@@ -166,9 +161,6 @@ namespace ttk {
       }
 
       void incAvoid() {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
         avoided_++;
       }
 
@@ -218,20 +210,20 @@ namespace ttk {
         return getNode(getArc(a).getDownNodeId());
       }
 
-      // direct access for openmp capture
-      const valence &valUp(const idVertex v) const {
+      // direct access for the concurrent updates
+      const std::atomic<valence> &valUp(const idVertex v) const {
         return valUp_[v];
       }
 
-      valence &valUp(const idVertex v) {
+      std::atomic<valence> &valUp(const idVertex v) {
         return valUp_[v];
       }
 
-      const valence &valDown(const idVertex v) const {
+      const std::atomic<valence> &valDown(const idVertex v) const {
         return valDown_[v];
       }
 
-      valence &valDown(const idVertex v) {
+      std::atomic<valence> &valDown(const idVertex v) {
         return valDown_[v];
       }
 
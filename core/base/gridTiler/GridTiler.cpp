@@ -0,0 +1,138 @@
+#include <GridTiler.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace ttk;
+
+GridTiler::GridTiler() {
+
+  for(int k = 0; k < 3; k++) {
+    origin_[k] = 0;
+    spacing_[k] = 1;
+    dimensions_[k] = 0;
+    tileSize_[k] = 64;
+    tileNumber_[k] = 0;
+    tileBegin_[k] = 0;
+    tileEnd_[k] = 0;
+    tileDimensions_[k] = 0;
+    ownedBegin_[k] = 0;
+    ownedEnd_[k] = 0;
+  }
+  ghostLayerWidth_ = 1;
+  tileId_ = -1;
+}
+
+GridTiler::~GridTiler() {
+}
+
+int GridTiler::setGhostLayerWidth(const SimplexId &width) {
+
+  // without ghost layers, the tiles would not overlap and the simplices
+  // between two tiles would be missed
+  if(width < 1)
+    return -1;
+
+  ghostLayerWidth_ = width;
+  tileId_ = -1;
+
+  return 0;
+}
+
+int GridTiler::setInputGrid(const float &xOrigin,
+                            const float &yOrigin,
+                            const float &zOrigin,
+                            const float &xSpacing,
+                            const float &ySpacing,
+                            const float &zSpacing,
+                            const SimplexId &xDim,
+                            const SimplexId &yDim,
+                            const SimplexId &zDim) {
+
+  if((xDim < 1) || (yDim < 1) || (zDim < 1))
+    return -1;
+
+  origin_[0] = xOrigin;
+  origin_[1] = yOrigin;
+  origin_[2] = zOrigin;
+  spacing_[0] = xSpacing;
+  spacing_[1] = ySpacing;
+  spacing_[2] = zSpacing;
+  dimensions_[0] = xDim;
+  dimensions_[1] = yDim;
+  dimensions_[2] = zDim;
+
+  return updateTileNumber();
+}
+
+int GridTiler::setTile(const SimplexId &tileId) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((tileId < 0) || (tileId >= getNumberOfTiles()))
+    return -1;
+#endif
+
+  SimplexId tilePosition[3];
+  tilePosition[0] = tileId % tileNumber_[0];
+  tilePosition[1] = (tileId / tileNumber_[0]) % tileNumber_[1];
+  tilePosition[2] = tileId / (tileNumber_[0] * tileNumber_[1]);
+
+  for(int k = 0; k < 3; k++) {
+    ownedBegin_[k] = tilePosition[k] * tileSize_[k];
+    ownedEnd_[k] = std::min(ownedBegin_[k] + tileSize_[k], dimensions_[k]);
+    tileBegin_[k] = std::max(ownedBegin_[k] - ghostLayerWidth_, (SimplexId)0);
+    tileEnd_[k] = std::min(ownedEnd_[k] + ghostLayerWidth_, dimensions_[k]);
+    tileDimensions_[k] = tileEnd_[k] - tileBegin_[k];
+  }
+
+  // start from a fresh triangulation, to drop the relations cached for the
+  // previous tile
+  triangulation_ = Triangulation();
+  triangulation_.setDebugLevel(debugLevel_);
+  triangulation_.setThreadNumber(threadNumber_);
+  int ret = triangulation_.setInputGrid(
+    origin_[0] + tileBegin_[0] * spacing_[0],
+    origin_[1] + tileBegin_[1] * spacing_[1],
+    origin_[2] + tileBegin_[2] * spacing_[2], spacing_[0], spacing_[1],
+    spacing_[2], tileDimensions_[0], tileDimensions_[1], tileDimensions_[2]);
+  if(ret) {
+    tileId_ = -1;
+    return -2;
+  }
+
+  tileId_ = tileId;
+
+  {
+    stringstream msg;
+    msg << "[GridTiler] Tile " << tileId_ << " (" << tileDimensions_[0]
+        << "x" << tileDimensions_[1] << "x" << tileDimensions_[2]
+        << " vertices)." << endl;
+    dMsg(cout, msg.str(), detailedInfoMsg);
+  }
+
+  return 0;
+}
+
+int GridTiler::setTileSize(const SimplexId &xSize,
+                           const SimplexId &ySize,
+                           const SimplexId &zSize) {
+
+  if((xSize < 1) || (ySize < 1) || (zSize < 1))
+    return -1;
+
+  tileSize_[0] = xSize;
+  tileSize_[1] = ySize;
+  tileSize_[2] = zSize;
+
+  return updateTileNumber();
+}
+
+int GridTiler::updateTileNumber() {
+
+  for(int k = 0; k < 3; k++) {
+    tileNumber_[k] = (dimensions_[k] + tileSize_[k] - 1) / tileSize_[k];
+  }
+  tileId_ = -1;
+
+  return 0;
+}
@@ -0,0 +1,284 @@
+/// \ingroup base
+/// \class ttk::GridTiler
+/// \date October 2019.
+///
+/// \brief Tiled, out-of-core processing of regular grids.
+///
+/// GridTiler splits a regular grid which does not fit in memory into tiles
+/// of vertices. Each tile is extended by ghost layers (vertices owned by the
+/// neighboring tiles) and exposed as an implicit triangulation of the
+/// corresponding sub-block of the grid, so that local computations (critical
+/// points, discrete gradient, etc.) yield on the vertices owned by the tile
+/// the same result as on the whole grid. processTiles() streams the tiles of
+/// a raw data file from disk, one at a time: the memory footprint is bounded
+/// by the size of one tile.
+///
+/// The vertices of a tile are identified in the row-major order of the
+/// tile, which is consistent with the order of the global identifiers:
+/// tie-breaks on vertex identifiers (simulation of simplicity) are therefore
+/// preserved. Use getGlobalVertexId() to map the results back to the grid
+/// and isGhostVertex() to discard the results on the ghost layers.
+///
+/// \note Only local computations can be processed tile by tile: the ghost
+/// layers need to be at least as wide as the neighborhood involved in the
+/// computation of each vertex (one layer for the vertex star).
+///
+/// \sa ttk::ImplicitTriangulation
+
+#ifndef _GRIDTILER_H
+#define _GRIDTILER_H
+
+// base code includes
+#include <Triangulation.h>
+#include <Wrapper.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ttk {
+
+  class GridTiler : public Debug {
+
+  public:
+    GridTiler();
+
+    ~GridTiler();
+
+    /// Number of tiles of the grid.
+    inline SimplexId getNumberOfTiles() const {
+      return tileNumber_[0] * tileNumber_[1] * tileNumber_[2];
+    }
+
+    /// Extent of the current tile (ghost layers included), in vertex
+    /// coordinates of the grid: [begin[k], end[k]) along the k-th axis.
+    inline void getTileExtent(SimplexId begin[3], SimplexId end[3]) const {
+      for(int k = 0; k < 3; k++) {
+        begin[k] = tileBegin_[k];
+        end[k] = tileEnd_[k];
+      }
+    }
+
+    /// Identifier of the current tile (-1 if none has been set).
+    inline SimplexId getTileId() const {
+      return tileId_;
+    }
+
+    /// Triangulation of the current tile (see setTile()).
+    inline Triangulation *getTriangulation() {
+      return &triangulation_;
+    }
+
+    /// Identifier in the grid of a vertex of the current tile (the grid may
+    /// have more vertices than SimplexId can address).
+    inline LongSimplexId
+      getGlobalVertexId(const SimplexId &localVertexId) const {
+      SimplexId p[3];
+      localToPosition(localVertexId, p);
+      return (LongSimplexId)(tileBegin_[0] + p[0])
+             + (LongSimplexId)dimensions_[0]
+                 * ((LongSimplexId)(tileBegin_[1] + p[1])
+                    + (LongSimplexId)dimensions_[1] * (tileBegin_[2] + p[2]));
+    }
+
+    /// Identifier in the current tile of a vertex of the grid.
+    /// \return Returns the local identifier, -1 if the vertex is not in the
+    /// tile (ghost layers included).
+    inline SimplexId
+      getLocalVertexId(const LongSimplexId &globalVertexId) const {
+      SimplexId p[3];
+      p[0] = globalVertexId % dimensions_[0];
+      p[1] = (globalVertexId / dimensions_[0]) % dimensions_[1];
+      p[2] = globalVertexId
+             / ((LongSimplexId)dimensions_[0] * dimensions_[1]);
+      for(int k = 0; k < 3; k++) {
+        if((p[k] < tileBegin_[k]) || (p[k] >= tileEnd_[k]))
+          return -1;
+        p[k] -= tileBegin_[k];
+      }
+      return p[0] + tileDimensions_[0] * (p[1] + tileDimensions_[1] * p[2]);
+    }
+
+    /// Returns true if a vertex of the current tile belongs to its ghost
+    /// layers (it is owned by another tile).
+    inline bool isGhostVertex(const SimplexId &localVertexId) const {
+      SimplexId p[3];
+      localToPosition(localVertexId, p);
+      for(int k = 0; k < 3; k++) {
+        const SimplexId q = tileBegin_[k] + p[k];
+        if((q < ownedBegin_[k]) || (q >= ownedEnd_[k]))
+          return true;
+      }
+      return false;
+    }
+
+    /// Process all the tiles of a raw data file, one after the other. For
+    /// each tile, the data of its vertices (ghost layers included) is read
+    /// from the file and \p processor is called with the tiler, the
+    /// triangulation of the tile and the data.
+    /// \param fileName Raw file storing the data of the grid vertices
+    /// (row-major order, \p componentNumber values of type \p dataType per
+    /// vertex, native byte order).
+    /// \param processor Functor taking (GridTiler &, Triangulation *,
+    /// dataType *) as arguments and returning 0 upon success.
+    /// \param componentNumber Number of components per vertex.
+    /// \param headerSize Size (in bytes) of the header of the file.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType, class processorType>
+    int processTiles(const std::string &fileName,
+                     const processorType &processor,
+                     const int &componentNumber = 1,
+                     const size_t &headerSize = 0);
+
+    /// Read the data of the current tile (ghost layers included) from a raw
+    /// data file.
+    /// \param fileName Raw file storing the data of the grid vertices
+    /// (row-major order, native byte order).
+    /// \param data Output buffer, with \p componentNumber values per vertex
+    /// of the tile.
+    /// \param componentNumber Number of components per vertex.
+    /// \param headerSize Size (in bytes) of the header of the file.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType>
+    int readTile(const std::string &fileName,
+                 dataType *data,
+                 const int &componentNumber = 1,
+                 const size_t &headerSize = 0) const;
+
+    /// Set the width (in vertices) of the ghost layers (default: 1).
+    int setGhostLayerWidth(const SimplexId &width);
+
+    /// Set the (global) regular grid to process.
+    int setInputGrid(const float &xOrigin,
+                     const float &yOrigin,
+                     const float &zOrigin,
+                     const float &xSpacing,
+                     const float &ySpacing,
+                     const float &zSpacing,
+                     const SimplexId &xDim,
+                     const SimplexId &yDim,
+                     const SimplexId &zDim);
+
+    /// Select the current tile and set up its triangulation.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setTile(const SimplexId &tileId);
+
+    /// Set the number of vertices owned by each tile along each axis
+    /// (tiles on the upper boundaries of the grid may be smaller).
+    int setTileSize(const SimplexId &xSize,
+                    const SimplexId &ySize,
+                    const SimplexId &zSize);
+
+  protected:
+    inline void localToPosition(const SimplexId &localVertexId,
+                                SimplexId p[3]) const {
+      p[0] = localVertexId % tileDimensions_[0];
+      p[1] = (localVertexId / tileDimensions_[0]) % tileDimensions_[1];
+      p[2] = localVertexId / (tileDimensions_[0] * tileDimensions_[1]);
+    }
+
+    int updateTileNumber();
+
+    float origin_[3], spacing_[3];
+    SimplexId dimensions_[3], tileSize_[3], tileNumber_[3], ghostLayerWidth_;
+
+    // current tile
+    SimplexId tileId_, tileBegin_[3], tileEnd_[3], tileDimensions_[3],
+      ownedBegin_[3], ownedEnd_[3];
+    Triangulation triangulation_;
+  };
+} // namespace ttk
+
+// template functions
+template <class dataType, class processorType>
+int ttk::GridTiler::processTiles(const std::string &fileName,
+                                 const processorType &processor,
+                                 const int &componentNumber,
+                                 const size_t &headerSize) {
+
+  Timer t;
+
+  const SimplexId tileNumber = getNumberOfTiles();
+  std::vector<dataType> data;
+
+  for(SimplexId i = 0; i < tileNumber; i++) {
+
+    if((wrapper_) && (wrapper_->needsToAbort()))
+      return -1;
+
+    int ret = setTile(i);
+    if(ret)
+      return -2;
+
+    data.resize((size_t)triangulation_.getNumberOfVertices()
+                * componentNumber);
+    ret = readTile(fileName, data.data(), componentNumber, headerSize);
+    if(ret)
+      return -3;
+
+    ret = processor(*this, &triangulation_, data.data());
+    if(ret)
+      return -4;
+
+    if(wrapper_)
+      wrapper_->updateProgress((i + 1.0) / tileNumber);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[GridTiler] Processed " << tileNumber << " tile(s) in "
+        << t.getElapsedTime() << " s." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <class dataType>
+int ttk::GridTiler::readTile(const std::string &fileName,
+                             dataType *data,
+                             const int &componentNumber,
+                             const size_t &headerSize) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!data) || (tileId_ < 0) || (componentNumber < 1))
+    return -1;
+#endif
+
+  std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  if(!file) {
+    std::stringstream msg;
+    msg << "[GridTiler] Could not open file `" << fileName << "'."
+        << std::endl;
+    dMsg(std::cerr, msg.str(), infoMsg);
+    return -2;
+  }
+
+  // read the tile row by row
+  const size_t vertexSize = componentNumber * sizeof(dataType);
+  const size_t rowSize = (size_t)tileDimensions_[0] * vertexSize;
+  char *buffer = (char *)data;
+
+  for(SimplexId k = tileBegin_[2]; k < tileEnd_[2]; k++) {
+    for(SimplexId j = tileBegin_[1]; j < tileEnd_[1]; j++) {
+      // in 64 bits: the grid may not be addressable with SimplexId
+      const size_t vertexId
+        = (size_t)tileBegin_[0]
+          + (size_t)dimensions_[0] * (j + (size_t)dimensions_[1] * k);
+      file.seekg(headerSize + vertexId * vertexSize);
+      file.read(buffer, rowSize);
+      if(!file) {
+        std::stringstream msg;
+        msg << "[GridTiler] Could not read tile " << tileId_ << " from `"
+            << fileName << "'." << std::endl;
+        dMsg(std::cerr, msg.str(), infoMsg);
+        return -3;
+      }
+      buffer += rowSize;
+    }
+  }
+
+  return 0;
+}
+
+#endif // _GRIDTILER_H
@@ -119,6 +119,7 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     cellNumber_ = tetrahedronNumber_;
 
     checkAcceleration();
+    buildVertexStencils();
   } else if(dimensionality_ == 2) {
     // dimensions selectors
     if(xDim == 1) {
@@ -157,6 +158,7 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     cellNumber_ = triangleNumber_;
 
     checkAcceleration();
+    buildVertexStencils();
   } else if(dimensionality_ == 1) {
     // dimensions selectors
     for(int k = 0; k < 3; ++k) {
@@ -214,6 +216,70 @@ int ImplicitTriangulation::checkAcceleration() {
   return 0;
 }
 
+int ImplicitTriangulation::buildVertexStencils() {
+
+  if(dimensionality_ == 3) {
+    buildVertexStencil(
+      3, 14,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexNeighborABCDEFGH(
+          p[0] + p[1] * vshift_[0] + p[2] * vshift_[1], id);
+      },
+      vertexNeighborStencil_);
+    buildVertexStencil(
+      3, 14,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexEdgeABCDEFGH(p, id);
+      },
+      vertexEdgeStencil_);
+    buildVertexStencil(
+      3, 36,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexTriangleABCDEFGH(p, id);
+      },
+      vertexTriangleStencil_);
+    buildVertexStencil(
+      3, 24,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexLinkABCDEFGH(p, id);
+      },
+      vertexLinkStencil_);
+    buildVertexStencil(
+      3, 24,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexStarABCDEFGH(p, id);
+      },
+      vertexStarStencil_);
+  } else if(dimensionality_ == 2) {
+    buildVertexStencil(
+      2, 6,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexNeighbor2dABCD(p[0] + p[1] * vshift_[0], id);
+      },
+      vertexNeighborStencil_);
+    buildVertexStencil(
+      2, 6,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexEdge2dABCD(p, id);
+      },
+      vertexEdgeStencil_);
+    buildVertexStencil(
+      2, 6,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexLink2dABCD(p, id);
+      },
+      vertexLinkStencil_);
+    buildVertexStencil(
+      2, 6,
+      [this](const SimplexId *p, const int &id) {
+        return getVertexStar2dABCD(p, id);
+      },
+      vertexStarStencil_);
+  }
+
+  return 0;
+}
+
 bool ImplicitTriangulation::isPowerOfTwo(unsigned long long int v,
                                          unsigned long long int &r) {
   if(v && !(v & (v - 1))) {
@@ -322,7 +388,9 @@ inline SimplexId ImplicitTriangulation::getVertexNeighborNumber(
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      return vertexNeighborStencil_.size;
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           return 14; // abcdefgh
@@ -390,7 +458,9 @@ inline SimplexId ImplicitTriangulation::getVertexNeighborNumber(
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      return vertexNeighborStencil_.size;
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         return 6; // abcd
       else if(p[1] == 0)
@@ -437,7 +507,9 @@ int ImplicitTriangulation::getVertexNeighbor(const SimplexId &vertexId,
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      neighborId = vertexNeighborStencil_.get<3>(p, localNeighborId);
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           neighborId
@@ -512,7 +584,9 @@ int ImplicitTriangulation::getVertexNeighbor(const SimplexId &vertexId,
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      neighborId = vertexNeighborStencil_.get<2>(p, localNeighborId);
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         neighborId = getVertexNeighbor2dABCD(vertexId, localNeighborId); // abcd
       else if(p[1] == 0)
@@ -606,7 +680,9 @@ int ImplicitTriangulation::getVertexEdge(const SimplexId &vertexId,
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      edgeId = vertexEdgeStencil_.get<3>(p, localEdgeId);
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           edgeId = getVertexEdgeABCDEFGH(p, localEdgeId); // abcdefgh
@@ -680,7 +756,9 @@ int ImplicitTriangulation::getVertexEdge(const SimplexId &vertexId,
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      edgeId = vertexEdgeStencil_.get<2>(p, localEdgeId);
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         edgeId = getVertexEdge2dABCD(p, localEdgeId); // abcd
       else if(p[1] == 0)
@@ -751,7 +829,9 @@ inline SimplexId ImplicitTriangulation::getVertexTriangleNumber(
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      return vertexTriangleStencil_.size;
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           return 36; // abcdefgh
@@ -834,7 +914,9 @@ int ImplicitTriangulation::getVertexTriangle(const SimplexId &vertexId,
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      triangleId = vertexTriangleStencil_.get<3>(p, localTriangleId);
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           triangleId
@@ -951,7 +1033,9 @@ int ImplicitTriangulation::getVertexLink(const SimplexId &vertexId,
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      linkId = vertexLinkStencil_.get<3>(p, localLinkId);
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           linkId = getVertexLinkABCDEFGH(p, localLinkId); // abcdefgh
@@ -1025,7 +1109,9 @@ int ImplicitTriangulation::getVertexLink(const SimplexId &vertexId,
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      linkId = vertexLinkStencil_.get<2>(p, localLinkId);
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         linkId = getVertexLink2dABCD(p, localLinkId); // abcd
       else if(p[1] == 0)
@@ -1085,7 +1171,9 @@ inline SimplexId
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      return vertexStarStencil_.size;
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           return 24; // abcdefgh
@@ -1153,7 +1241,9 @@ inline SimplexId
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      return vertexStarStencil_.size;
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         return 6; // abcd
       else if(p[1] == 0)
@@ -1194,7 +1284,9 @@ int ImplicitTriangulation::getVertexStar(const SimplexId &vertexId,
     SimplexId p[3];
     vertexToPosition(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+    if(isInteriorVertex<3>(p))
+      starId = vertexStarStencil_.get<3>(p, localStarId);
+    else if(0 < p[0] and p[0] < nbvoxels_[0]) {
       if(0 < p[1] and p[1] < nbvoxels_[1]) {
         if(0 < p[2] and p[2] < nbvoxels_[2])
           starId = getVertexStarABCDEFGH(p, localStarId); // abcdefgh
@@ -1268,7 +1360,9 @@ int ImplicitTriangulation::getVertexStar(const SimplexId &vertexId,
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+    if(isInteriorVertex<2>(p))
+      starId = vertexStarStencil_.get<2>(p, localStarId);
+    else if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
       if(0 < p[1] and p[1] < nbvoxels_[Dj_])
         starId = getVertexStar2dABCD(p, localStarId); // abcd
       else if(p[1] == 0)
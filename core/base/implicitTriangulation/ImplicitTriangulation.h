@@ -64,6 +64,12 @@ namespace ttk {
       return dimensionality_;
     };
 
+    int getRegularGridDimensions(SimplexId dimensions[3]) const override {
+      for(int k = 0; k < 3; k++)
+        dimensions[k] = dimensions_[k];
+      return 0;
+    }
+
     int getEdgeLink(const SimplexId &edgeId,
                     const int &localLinkId,
                     SimplexId &linkId) const override;
@@ -287,6 +293,40 @@ namespace ttk {
     int checkAcceleration();
     bool isPowerOfTwo(unsigned long long int v, unsigned long long int &r);
 
+    /// Precomputed relation of the vertices in the interior of the grid
+    /// (abcdefgh in 3D, abcd in 2D). For these vertices, the identifier of the
+    /// id-th simplex of the relation is an affine function of the vertex
+    /// position p: offsets[id] + sum_k(coefficients[id][k] * p[k]).
+    struct VertexStencil {
+      int size;
+      SimplexId offsets[36];
+      SimplexId coefficients[36][3];
+
+      template <int dimension>
+      inline SimplexId get(const SimplexId *p, const int &id) const {
+        SimplexId simplexId = offsets[id];
+        for(int k = 0; k < dimension; k++)
+          simplexId += coefficients[id][k] * p[k];
+        return simplexId;
+      }
+    };
+
+    VertexStencil vertexNeighborStencil_;
+    VertexStencil vertexEdgeStencil_;
+    VertexStencil vertexTriangleStencil_;
+    VertexStencil vertexLinkStencil_;
+    VertexStencil vertexStarStencil_;
+
+    // stencil functions
+    int buildVertexStencils();
+    template <class getterType>
+    int buildVertexStencil(const int &dimension,
+                           const int &size,
+                           const getterType &getter,
+                           VertexStencil &stencil) const;
+    template <int dimension>
+    inline bool isInteriorVertex(const SimplexId *p) const;
+
     //\cond
     // 2D //
     void vertexToPosition2d(const SimplexId vertex, SimplexId p[2]) const;
@@ -646,8 +686,53 @@ namespace ttk {
                                          const int id) const;
     //\endcond
   };
+
+  // the comparisons on unsigned values also reject the vertices at position 0
+  template <>
+  inline bool ImplicitTriangulation::isInteriorVertex<2>(
+    const SimplexId *p) const {
+    return ((size_t)(p[0] - 1) < (size_t)(nbvoxels_[Di_] - 1))
+           & ((size_t)(p[1] - 1) < (size_t)(nbvoxels_[Dj_] - 1));
+  }
+
+  template <>
+  inline bool ImplicitTriangulation::isInteriorVertex<3>(
+    const SimplexId *p) const {
+    return ((size_t)(p[0] - 1) < (size_t)(nbvoxels_[0] - 1))
+           & ((size_t)(p[1] - 1) < (size_t)(nbvoxels_[1] - 1))
+           & ((size_t)(p[2] - 1) < (size_t)(nbvoxels_[2] - 1));
+  }
 } // namespace ttk
 
+template <class getterType>
+int ttk::ImplicitTriangulation::buildVertexStencil(
+  const int &dimension,
+  const int &size,
+  const getterType &getter,
+  VertexStencil &stencil) const {
+
+  // the interior case getters are affine in the vertex position: evaluate
+  // them at (1, 1, 1) and at its unit translations along each axis
+  SimplexId p[3] = {1, 1, 1};
+
+  stencil.size = size;
+  for(int i = 0; i < size; i++) {
+    const SimplexId origin = getter(p, i);
+    stencil.offsets[i] = origin;
+    for(int k = 0; k < 3; k++) {
+      stencil.coefficients[i][k] = 0;
+      if(k < dimension) {
+        p[k]++;
+        stencil.coefficients[i][k] = getter(p, i) - origin;
+        p[k]--;
+        stencil.offsets[i] -= stencil.coefficients[i][k] * p[k];
+      }
+    }
+  }
+
+  return 0;
+}
+
 inline void
   ttk::ImplicitTriangulation::vertexToPosition2d(const SimplexId vertex,
                                                  SimplexId p[2]) const {
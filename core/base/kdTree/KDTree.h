@@ -5,6 +5,16 @@
 ///
 /// \brief TTK KD-Tree
 ///
+/// The nodes are stored in flat arrays, in breadth-first order: the children
+/// of the node i are the nodes 2i+1 and 2i+2 and its parent is the node
+/// (i-1)/2. Each node holds one point, the tree splitting its points
+/// according to the coordinate of index (depth % dimension).
+///
+/// Each point is given one or several weights (one per auction sharing the
+/// tree), added to its distance to the query points. The minimal weight of
+/// each subtree is maintained to prune the searches.
+///
+/// Points are referred to by their index in the input coordinates.
 
 #pragma once
 
@@ -23,120 +33,136 @@ namespace ttk {
   class KDTree : public Debug {
 
   public:
-    KDTree *left_; // Lower half for the coordinate specified
-    KDTree *right_; // Higher half
-    KDTree *parent_;
-    int id_; // ID of the object saved here. The whole object is not kept in the
-             // KDTree Users should keep track of them in a table for instance
-    std::vector<dataType> coordinates_;
-    std::vector<dataType> coords_min_;
-    std::vector<dataType> coords_max_;
-    int level_;
-
-    std::vector<dataType> weight_;
-    std::vector<dataType> min_subweights_;
-
     KDTree() {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-
-      coords_number_ = 0;
+      dimension_ = 0;
+      weight_number_ = 0;
       p_ = 2;
       include_weights_ = false;
     }
 
     KDTree(bool include_weights, int p) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-
-      coords_number_ = 0;
+      dimension_ = 0;
+      weight_number_ = 0;
       p_ = p;
       include_weights_ = include_weights;
     }
 
-    KDTree(KDTree *father, int coords_number, bool is_left) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = father;
+    ~KDTree(){};
+
+    /// Builds the tree on the points of \p coordinates (\p dimension values
+    /// per point), with weight_number null weights per point.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int build(dataType *coordinates,
+              const int &ptNumber,
+              const int &dimension,
+              const int weight_number = 1);
+    /// Builds the tree, weights[w][i] being the w-th weight of the point i.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int build(dataType *coordinates,
+              const int &ptNumber,
+              const int &dimension,
+              std::vector<std::vector<dataType>> &weights,
+              const int weight_number = 1);
+
+    /// Sets a weight of the point \p id and updates the minimal weights of
+    /// the subtrees containing it (from its node up to the root at most).
+    void updateWeight(const int id,
+                      dataType new_weight,
+                      const int weight_index = 0);
+
+    /// Puts the (at most) k closest points to the given coordinates in the
+    /// "neighbours" vector along with their costs (distance plus weight) in
+    /// the "costs" vector, sorted by increasing cost.
+    void getKClosest(const unsigned int k,
+                     const std::vector<dataType> &coordinates,
+                     std::vector<int> &neighbours,
+                     std::vector<dataType> &costs,
+                     const int weight_index = 0) const;
+
+    /// Batched version of getKClosest() (parallel over the queries):
+    /// coordinates holds the queries one after the other, the k closest
+    /// points of the query q are stored at [q * k, (q + 1) * k) in
+    /// neighbours and costs. If the tree has less than k points, the
+    /// remaining neighbours are set to -1.
+    void getKClosest(const unsigned int k,
+                     const std::vector<dataType> &coordinates,
+                     const int queryNumber,
+                     std::vector<int> &neighbours,
+                     std::vector<dataType> &costs,
+                     const int weight_index = 0) const;
 
-      coords_number_ = coords_number;
-      p_ = father->p_;
-      include_weights_ = father->include_weights_;
-      is_left_ = is_left;
+    std::vector<dataType> getCoordinates(const int id) const;
+    dataType getWeight(const int id, const int weight_index = 0) const;
+    dataType getMinSubWeight(const int weight_index = 0) const;
+
+    inline int getNumberOfPoints() const {
+      return ids_.size();
     }
 
-    ~KDTree() {
-      delete left_;
-      delete right_;
-      // coordinates_.resize(0);
-      // coords_min_.resize(0);
-      // coords_max_.resize(0);
-      // weight_.resize(0);
-      // min_subweights_.resize(0);
+    inline int getDimension() const {
+      return dimension_;
     }
 
-    std::vector<KDTree<dataType> *> build(dataType *coordinates,
-                                          const int &ptNumber,
-                                          const int &dimension,
-                                          const int weight_number = 1);
-    std::vector<KDTree<dataType> *>
-      build(dataType *coordinates,
-            const int &ptNumber,
-            const int &dimension,
-            std::vector<std::vector<dataType>> &weights,
-            const int weight_number = 1);
+    template <typename type>
+    inline static type abs(const type var) {
+      return (var > 0) ? var : -var;
+    }
 
+  protected:
     void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        std::vector<std::vector<dataType>> &weights,
-                        const int weight_number = 1);
-    void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        const int weight_number = 1);
-
-    void updateWeight(dataType new_weight, const int weight_index = 0);
-    void updateMinSubweight(const int weight_index = 0);
-    void getKClosest(const unsigned int k,
-                     const std::vector<dataType> &coordinates,
-                     std::vector<KDTree<dataType> *> &neighbours,
-                     std::vector<dataType> &costs,
-                     const int weight_index = 0);
+                        std::vector<int> &indexes,
+                        const int begin,
+                        const int end,
+                        const int node,
+                        const int depth);
     void recursiveGetKClosest(const unsigned int k,
-                              const std::vector<dataType> &coordinates,
-                              std::vector<KDTree<dataType> *> &neighbours,
+                              const dataType *coordinates,
+                              const int node,
+                              const int depth,
+                              std::vector<dataType> &coords_min,
+                              std::vector<dataType> &coords_max,
+                              std::vector<int> &neighbours,
                               std::vector<dataType> &costs,
-                              const int weight_index = 0);
+                              const int weight_index) const;
 
-    dataType cost(const std::vector<dataType> &coordinates);
-    dataType distanceToBox(KDTree<dataType> *subtree,
-                           const std::vector<dataType> &coordinates);
-    std::vector<dataType> getCoordinates();
-    dataType getWeight(const int weight_index = 0);
-    dataType getMinSubWeight(const int weight_index = 0);
+    // Number of points in the left subtree of a subtree of ptNumber points
+    static int getLeftSubtreeSize(const int ptNumber);
 
-    bool isLeaf();
-    bool isRoot();
+    inline dataType power(const dataType var) const {
+      return p_ == 1 ? var : (p_ == 2 ? var * var : pow(var, p_));
+    }
+    dataType cost(const dataType *coordinates, const int node) const;
+    dataType distanceToBox(const std::vector<dataType> &coords_min,
+                           const std::vector<dataType> &coords_max,
+                           const dataType *coordinates) const;
 
-    template <typename type>
-    inline static type abs(const type var) {
-      return (var > 0) ? var : -var;
+    inline dataType &weight(const int node, const int weight_index) {
+      return weights_[weight_index * ids_.size() + node];
+    }
+    inline dataType weight(const int node, const int weight_index) const {
+      return weights_[weight_index * ids_.size() + node];
+    }
+    inline dataType &minSubweight(const int node, const int weight_index) {
+      return min_subweights_[weight_index * ids_.size() + node];
+    }
+    inline dataType minSubweight(const int node,
+                                 const int weight_index) const {
+      return min_subweights_[weight_index * ids_.size() + node];
     }
 
-  protected:
-    bool is_left_; // Boolean indicating if the current node is a left node of
-                   // its parent
-    int coords_number_; // Indicates according to which coordinate the tree
-                        // splits its elements
+    int dimension_;
+    int weight_number_;
+
+    // per node: id of the point and its coordinates
+    std::vector<int> ids_;
+    std::vector<dataType> coordinates_;
+    // per point: its node
+    std::vector<int> nodes_;
+    // per weight index and node (one contiguous block per weight index, so
+    // that auctions on different weights do not write to the same cache
+    // lines): weight of the point and minimal weight of the subtree
+    std::vector<dataType> weights_;
+    std::vector<dataType> min_subweights_;
 
     int p_; // Power used for the computation of distances. p=2 yields euclidean
             // distance
@@ -147,307 +173,325 @@ namespace ttk {
   };
 
   template <typename dataType>
-  std::vector<dataType> KDTree<dataType>::getCoordinates() {
-    return coordinates_;
+  std::vector<dataType> KDTree<dataType>::getCoordinates(const int id) const {
+    const int node = nodes_[id];
+    return std::vector<dataType>(
+      coordinates_.begin() + node * dimension_,
+      coordinates_.begin() + (node + 1) * dimension_);
   }
 
   template <typename dataType>
-  dataType KDTree<dataType>::getWeight(const int weight_index) {
-    return weight_[weight_index];
+  dataType KDTree<dataType>::getWeight(const int id,
+                                       const int weight_index) const {
+    return weight(nodes_[id], weight_index);
   }
 
   template <typename dataType>
-  dataType KDTree<dataType>::getMinSubWeight(const int weight_index) {
-    return min_subweights_[weight_index];
+  dataType KDTree<dataType>::getMinSubWeight(const int weight_index) const {
+    return minSubweight(0, weight_index);
   }
 
   template <typename dataType>
-  std::vector<KDTree<dataType> *>
-    KDTree<dataType>::build(dataType *data,
-                            const int &ptNumber,
-                            const int &dimension,
-                            const int weight_number) {
-    std::vector<KDTree<dataType> *> correspondance_map(ptNumber);
-    // First, perform a argsort on the data
-    // initialize original index locations
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(std::numeric_limits<dataType>::lowest());
-      coords_max_.push_back(std::numeric_limits<dataType>::max());
-    }
+  int KDTree<dataType>::build(dataType *data,
+                              const int &ptNumber,
+                              const int &dimension,
+                              const int weight_number) {
+    std::vector<std::vector<dataType>> weights(
+      weight_number, std::vector<dataType>(ptNumber, 0));
+    return build(data, ptNumber, dimension, weights, weight_number);
+  }
+
+  template <typename dataType>
+  int KDTree<dataType>::build(dataType *data,
+                              const int &ptNumber,
+                              const int &dimension,
+                              std::vector<std::vector<dataType>> &weights,
+                              const int weight_number) {
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(ptNumber < 0 || dimension <= 0)
+      return -1;
+    if((int)weights.size() < weight_number)
+      return -2;
+#endif
+
+    dimension_ = dimension;
+    weight_number_ = weight_number;
+    ids_.resize(ptNumber);
+    coordinates_.resize(ptNumber * dimension);
+    nodes_.resize(ptNumber);
+
     std::vector<int> idx(ptNumber);
     for(int i = 0; i < ptNumber; i++) {
       idx[i] = i;
     }
-    // sort indexes based on comparing values in coordinates
-    sort(idx.begin(), idx.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
-    });
-    int median_loc = (int)(ptNumber - 1) / 2;
-    int median_idx = idx[median_loc];
-    correspondance_map[median_idx] = this;
-
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
-    }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
-    }
-    id_ = median_idx;
-    parent_ = nullptr;
-    level_ = 0;
-
-    if(idx.size() > 2) {
-      // Build left leaf
-      std::vector<int> idx_left;
-      for(int i = 0; i < median_loc; i++) {
-        idx_left.push_back(idx[i]);
-      }
-
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
+    if(ptNumber > 0) {
+      buildRecursive(data, idx, 0, ptNumber, 0, 0);
     }
 
-    if(idx.size() > 1) {
-      // Build right leaf
-      std::vector<int> idx_right(ptNumber - median_loc - 1);
-      for(int i = 0; i < ptNumber - median_loc - 1; i++) {
-        idx_right[i] = idx[i + median_loc + 1];
+    weights_.resize(weight_number * ptNumber);
+    min_subweights_.resize(weight_number * ptNumber);
+    for(int w = 0; w < weight_number; w++) {
+      // children come after their parent
+      for(int node = ptNumber - 1; node >= 0; node--) {
+        const dataType wt = weights[w][ids_[node]];
+        dataType min_subweight = wt;
+        const int left = 2 * node + 1;
+        if(left < ptNumber) {
+          min_subweight = std::min(min_subweight, minSubweight(left, w));
+        }
+        if(left + 1 < ptNumber) {
+          min_subweight = std::min(min_subweight, minSubweight(left + 1, w));
+        }
+        weight(node, w) = wt;
+        minSubweight(node, w) = min_subweight;
       }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
     }
 
-    return correspondance_map;
+    return 0;
   }
 
   template <typename dataType>
-  void KDTree<dataType>::buildRecursive(
-    dataType *data,
-    std::vector<int> idx_side,
-    const int &ptNumber,
-    const int &dimension,
-    KDTree<dataType> *parent,
-    std::vector<KDTree<dataType> *> &correspondance_map,
-    const int weight_number) {
-
-    // First, perform a argsort on the data
-    sort(idx_side.begin(), idx_side.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
-    });
-    int median_loc = (int)(idx_side.size() - 1) / 2;
-    int median_idx = idx_side[median_loc];
-    correspondance_map[median_idx] = this;
-
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
-    }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
+  int KDTree<dataType>::getLeftSubtreeSize(const int ptNumber) {
+    if(ptNumber < 2) {
+      return 0;
     }
-    id_ = median_idx;
-    parent_ = parent;
-    level_ = parent->level_ + 1;
-
-    // Create bounding box
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(parent_->coords_min_[axis]);
-      coords_max_.push_back(parent_->coords_max_[axis]);
+    // the subtree is complete: all its levels are full but the last one,
+    // filled from the left
+    int depth = 0;
+    while((2 << depth) <= ptNumber) {
+      depth++;
     }
-    if(is_left_ && !this->isRoot()) {
-      coords_max_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
-    } else if(!is_left_ && !this->isRoot()) {
-      coords_min_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
-    }
-
-    if(idx_side.size() > 2) {
-      // Build left leaf
-      std::vector<int> idx_left(median_loc);
-      for(int i = 0; i < median_loc; i++) {
-        idx_left[i] = idx_side[i];
-      }
+    const int upperLevels = (1 << depth) - 1;
+    const int lastLevel = ptNumber - upperLevels;
+    return (upperLevels - 1) / 2 + std::min(lastLevel, 1 << (depth - 1));
+  }
 
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
+  template <typename dataType>
+  void KDTree<dataType>::buildRecursive(dataType *data,
+                                        std::vector<int> &idx,
+                                        const int begin,
+                                        const int end,
+                                        const int node,
+                                        const int depth) {
+    const int axis = depth % dimension_;
+    const int median_loc = begin + getLeftSubtreeSize(end - begin);
+
+    // the points before the median go to the left subtree, the ones after
+    // to the right subtree
+    std::nth_element(idx.begin() + begin, idx.begin() + median_loc,
+                     idx.begin() + end, [&](int i1, int i2) {
+                       return data[dimension_ * i1 + axis]
+                              < data[dimension_ * i2 + axis];
+                     });
+    const int median_idx = idx[median_loc];
+    ids_[node] = median_idx;
+    nodes_[median_idx] = node;
+    for(int i = 0; i < dimension_; i++) {
+      coordinates_[node * dimension_ + i] = data[dimension_ * median_idx + i];
     }
 
-    if(idx_side.size() > 1) {
-      // Build right leaf
-      std::vector<int> idx_right(idx_side.size() - median_loc - 1);
-      for(unsigned int i = 0; i < idx_side.size() - median_loc - 1; i++) {
-        idx_right[i] = idx_side[i + median_loc + 1];
-      }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
+    if(median_loc > begin) {
+      buildRecursive(data, idx, begin, median_loc, 2 * node + 1, depth + 1);
+    }
+    if(end > median_loc + 1) {
+      buildRecursive(data, idx, median_loc + 1, end, 2 * node + 2, depth + 1);
     }
-    return;
   }
 
   template <typename dataType>
-  void KDTree<dataType>::updateWeight(dataType new_weight,
+  void KDTree<dataType>::updateWeight(const int id,
+                                      dataType new_weight,
                                       const int weight_index) {
-    weight_[weight_index] = new_weight;
-    updateMinSubweight(weight_index);
+    const int ptNumber = ids_.size();
+    int node = nodes_[id];
+    weight(node, weight_index) = new_weight;
+
+    while(true) {
+      dataType new_min_subweight = weight(node, weight_index);
+      const int left = 2 * node + 1;
+      if(left < ptNumber) {
+        new_min_subweight
+          = std::min(new_min_subweight, minSubweight(left, weight_index));
+      }
+      if(left + 1 < ptNumber) {
+        new_min_subweight
+          = std::min(new_min_subweight, minSubweight(left + 1, weight_index));
+      }
+
+      if(new_min_subweight == minSubweight(node, weight_index)) {
+        // the subtrees above are not affected
+        break;
+      }
+      minSubweight(node, weight_index) = new_min_subweight;
+      if(node == 0) {
+        break;
+      }
+      node = (node - 1) / 2;
+    }
   }
 
   template <typename dataType>
-  void KDTree<dataType>::updateMinSubweight(const int weight_index) {
-    dataType new_min_subweight;
-    if(this->isLeaf()) {
-      new_min_subweight = weight_[weight_index];
-    } else if(!left_) {
-      new_min_subweight = std::min(
-        right_->min_subweights_[weight_index], weight_[weight_index]);
-    } else if(!right_) {
-      new_min_subweight
-        = std::min(left_->min_subweights_[weight_index], weight_[weight_index]);
-    } else {
-      new_min_subweight
-        = std::min(std::min(left_->min_subweights_[weight_index],
-                            right_->min_subweights_[weight_index]),
-                   weight_[weight_index]);
+  void KDTree<dataType>::getKClosest(const unsigned int k,
+                                     const std::vector<dataType> &coordinates,
+                                     std::vector<int> &neighbours,
+                                     std::vector<dataType> &costs,
+                                     const int weight_index) const {
+    neighbours.clear();
+    costs.clear();
+    if(ids_.empty() || !k) {
+      return;
     }
 
-    if(new_min_subweight != min_subweights_[weight_index]) {
-      min_subweights_[weight_index] = new_min_subweight;
-      if(!this->isRoot()) {
-        parent_->updateMinSubweight(weight_index);
+    std::vector<dataType> coords_min(
+      dimension_, std::numeric_limits<dataType>::lowest());
+    std::vector<dataType> coords_max(
+      dimension_, std::numeric_limits<dataType>::max());
+    recursiveGetKClosest(k, coordinates.data(), 0, 0, coords_min, coords_max,
+                         neighbours, costs, weight_index);
+
+    // sort by increasing cost (k is small)
+    for(unsigned int i = 1; i < costs.size(); i++) {
+      for(unsigned int j = i; j > 0 && costs[j] < costs[j - 1]; j--) {
+        std::swap(costs[j], costs[j - 1]);
+        std::swap(neighbours[j], neighbours[j - 1]);
       }
     }
   }
 
   template <typename dataType>
-  void
-    KDTree<dataType>::getKClosest(const unsigned int k,
-                                  const std::vector<dataType> &coordinates,
-                                  std::vector<KDTree<dataType> *> &neighbours,
-                                  std::vector<dataType> &costs,
-                                  const int weight_index) {
-    /// Puts the k closest points to the given coordinates in the "neighbours"
-    /// vector along with their costs in the "costs" vector The output is not
-    /// sorted, if you are interested in the k nearest neighbours in the order,
-    /// will need to sort them according to their cost.
-    if(this->isLeaf()) {
-      dataType cost = this->cost(coordinates);
-      cost += weight_[weight_index];
-      neighbours.push_back(this);
-      costs.push_back(cost);
-    } else {
-      this->recursiveGetKClosest(
-        k, coordinates, neighbours, costs, weight_index);
+  void KDTree<dataType>::getKClosest(const unsigned int k,
+                                     const std::vector<dataType> &coordinates,
+                                     const int queryNumber,
+                                     std::vector<int> &neighbours,
+                                     std::vector<dataType> &costs,
+                                     const int weight_index) const {
+    neighbours.resize(queryNumber * k);
+    costs.resize(queryNumber * k);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<dataType> query(dimension_);
+      std::vector<int> queryNeighbours;
+      std::vector<dataType> queryCosts;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif // TTK_ENABLE_OPENMP
+      for(int q = 0; q < queryNumber; q++) {
+        std::copy(coordinates.begin() + q * dimension_,
+                  coordinates.begin() + (q + 1) * dimension_, query.begin());
+        getKClosest(k, query, queryNeighbours, queryCosts, weight_index);
+        for(unsigned int i = 0; i < k; i++) {
+          const bool found = i < queryNeighbours.size();
+          neighbours[q * k + i] = found ? queryNeighbours[i] : -1;
+          costs[q * k + i]
+            = found ? queryCosts[i] : std::numeric_limits<dataType>::max();
+        }
+      }
     }
-    // TODO sort neighbours and costs !
-    return;
   }
 
   template <typename dataType>
   void KDTree<dataType>::recursiveGetKClosest(
     const unsigned int k,
-    const std::vector<dataType> &coordinates,
-    std::vector<KDTree<dataType> *> &neighbours,
+    const dataType *coordinates,
+    const int node,
+    const int depth,
+    std::vector<dataType> &coords_min,
+    std::vector<dataType> &coords_max,
+    std::vector<int> &neighbours,
     std::vector<dataType> &costs,
-    const int weight_index) {
+    const int weight_index) const {
     // 1- Look wether or not to include the current point in the nearest
     // neighbours
-    dataType cost = this->cost(coordinates);
-    cost += weight_[weight_index];
+    const dataType cost
+      = this->cost(coordinates, node) + weight(node, weight_index);
+
+    // most costly amongst neighbours
+    auto getMaxCost = [&costs]() {
+      unsigned int idx_max_cost = 0;
+      for(unsigned int i = 1; i < costs.size(); i++) {
+        if(costs[i] > costs[idx_max_cost]) {
+          idx_max_cost = i;
+        }
+      }
+      return idx_max_cost;
+    };
 
     if(costs.size() < k) {
-      neighbours.push_back(this);
+      neighbours.push_back(ids_[node]);
       costs.push_back(cost);
     } else {
-      // 1.1- Find the most costly amongst neighbours
-      std::vector<int> idx(k);
-      for(unsigned int i = 0; i < k; i++) {
-        idx[i] = i;
-      }
-      int idx_max_cost = *std::max_element(
-        idx.begin(), idx.end(),
-        [&costs](int &a, int &b) { return costs[a] < costs[b]; });
-      dataType max_cost = costs[idx_max_cost];
-
-      // 1.2- If the current KDTree is less costly, put it in the neighbours and
-      // update costs.
-      if(cost < max_cost) {
+      // If the current point is less costly, put it in the neighbours
+      const unsigned int idx_max_cost = getMaxCost();
+      if(cost < costs[idx_max_cost]) {
         costs[idx_max_cost] = cost;
-        neighbours[idx_max_cost] = this;
+        neighbours[idx_max_cost] = ids_[node];
       }
     }
 
-    // 2- Recursively visit KDTrees that are worth it
-    if(left_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = left_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(left_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        left_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+    // 2- Recursively visit the subtrees that are worth it, their bounding
+    // boxes being the one of the node cut by its splitting coordinate
+    const int ptNumber = ids_.size();
+    const int axis = depth % dimension_;
+    const dataType split = coordinates_[node * dimension_ + axis];
+    const int left = 2 * node + 1;
+    const int right = left + 1;
+
+    if(left < ptNumber) {
+      const dataType bound = coords_max[axis];
+      coords_max[axis] = split;
+      const dataType d_min = distanceToBox(coords_min, coords_max, coordinates);
+      if(costs.size() < k
+         || d_min + minSubweight(left, weight_index) < costs[getMaxCost()]) {
+        // It is possible that there exists a point in this subtree that is
+        // less costly than the current neighbours
+        recursiveGetKClosest(k, coordinates, left, depth + 1, coords_min,
+                             coords_max, neighbours, costs, weight_index);
       }
+      coords_max[axis] = bound;
     }
 
-    if(right_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = right_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(right_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        right_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+    if(right < ptNumber) {
+      const dataType bound = coords_min[axis];
+      coords_min[axis] = split;
+      const dataType d_min = distanceToBox(coords_min, coords_max, coordinates);
+      if(costs.size() < k
+         || d_min + minSubweight(right, weight_index) < costs[getMaxCost()]) {
+        recursiveGetKClosest(k, coordinates, right, depth + 1, coords_min,
+                             coords_max, neighbours, costs, weight_index);
       }
+      coords_min[axis] = bound;
     }
-    return;
   }
 
   template <typename dataType>
-  dataType KDTree<dataType>::cost(const std::vector<dataType> &coordinates) {
+  dataType KDTree<dataType>::cost(const dataType *coordinates,
+                                  const int node) const {
+    const dataType *point = &coordinates_[node * dimension_];
     dataType cost = 0;
-    for(unsigned int i = 0; i < coordinates.size(); i++) {
-      cost += pow(abs(coordinates[i] - coordinates_[i]), p_);
+    for(int i = 0; i < dimension_; i++) {
+      cost += power(abs(coordinates[i] - point[i]));
     }
     return cost;
   }
 
   template <typename dataType>
   dataType
-    KDTree<dataType>::distanceToBox(KDTree<dataType> *subtree,
-                                    const std::vector<dataType> &coordinates) {
+    KDTree<dataType>::distanceToBox(const std::vector<dataType> &coords_min,
+                                    const std::vector<dataType> &coords_max,
+                                    const dataType *coordinates) const {
     dataType d_min = 0;
-    for(unsigned int axis = 0; axis < coordinates.size(); axis++) {
-      if(subtree->coords_min_[axis] > coordinates[axis]) {
-        d_min += pow(subtree->coords_min_[axis] - coordinates[axis], p_);
-      } else if(subtree->coords_max_[axis] < coordinates[axis]) {
-        d_min += pow(coordinates[axis] - subtree->coords_max_[axis], p_);
+    for(int axis = 0; axis < dimension_; axis++) {
+      if(coords_min[axis] > coordinates[axis]) {
+        d_min += power(coords_min[axis] - coordinates[axis]);
+      } else if(coords_max[axis] < coordinates[axis]) {
+        d_min += power(coordinates[axis] - coords_max[axis]);
       }
     }
     return d_min;
   }
-
-  template <typename dataType>
-  bool KDTree<dataType>::isLeaf() {
-    return left_ == nullptr && right_ == nullptr;
-  }
-
-  template <typename dataType>
-  bool KDTree<dataType>::isRoot() {
-    return parent_ == nullptr;
-  }
 } // namespace ttk
-#include <buildWeights.h>
 
 #endif
@@ -179,7 +179,7 @@
 
 namespace ttk {
 
-  class MorseSmaleComplex {
+  class MorseSmaleComplex : public Debug {
 
   public:
     MorseSmaleComplex();
@@ -309,7 +309,8 @@ namespace ttk {
       return 0;
     }
 
-    inline int setDebugLevel(const int &debugLevel) {
+    inline int setDebugLevel(const int &debugLevel) override {
+      Debug::setDebugLevel(debugLevel);
       morseSmaleComplex2D_.setDebugLevel(debugLevel);
       morseSmaleComplex3D_.setDebugLevel(debugLevel);
       return 0;
@@ -321,12 +322,23 @@ namespace ttk {
       return 0;
     }
 
-    inline int setWrapper(const Wrapper *const wrapper) {
+    inline int setWrapper(const Wrapper *wrapper) override {
+      Debug::setWrapper(wrapper);
       morseSmaleComplex2D_.setWrapper(wrapper);
       morseSmaleComplex3D_.setWrapper(wrapper);
       return 0;
     }
 
+    // printMemoryReport() is inherited from Debug
+    inline int getMemoryReport(MemoryReport &report) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->getMemoryReport(report);
+    }
+
     inline int setInputScalarField(void *const data) {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(!abstractMorseSmaleComplex_) {
@@ -347,6 +359,16 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputModificationTime(const unsigned long long &time) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      abstractMorseSmaleComplex_->setInputModificationTime(time);
+      return 0;
+    }
+
     inline int setOutputCriticalPoints(
       SimplexId *const criticalPoints_numberOfPoints,
       std::vector<float> *const criticalPoints_points,
@@ -7,7 +7,8 @@ PersistenceCurve::PersistenceCurve()
   : ComputeSaddleConnectors{},
 
     triangulation_{}, inputScalars_{},
-    inputOffsets_{}, JTPlot_{}, MSCPlot_{}, STPlot_{}, CTPlot_{} {
+    inputOffsets_{}, inputModificationTime_{}, JTPlot_{}, MSCPlot_{},
+    STPlot_{}, CTPlot_{} {
 }
 
 PersistenceCurve::~PersistenceCurve() {
@@ -71,6 +71,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the modification time of the scalar and offset fields, so that
+    /// their vertex order can be shared with the other modules (see
+    /// ttk::VertexOrder).
+    inline int setInputModificationTime(const unsigned long long &time) {
+      inputModificationTime_ = time;
+      return 0;
+    }
+
     inline int setOutputJTPlot(void *data) {
       JTPlot_ = data;
       return 0;
@@ -97,6 +105,7 @@ namespace ttk {
     Triangulation *triangulation_;
     void *inputScalars_;
     void *inputOffsets_;
+    unsigned long long inputModificationTime_;
     void *JTPlot_;
     void *MSCPlot_;
     void *STPlot_;
@@ -134,12 +143,6 @@ int ttk::PersistenceCurve::execute() const {
     = *static_cast<std::vector<std::pair<scalarType, SimplexId>> *>(MSCPlot_);
   std::vector<std::pair<scalarType, SimplexId>> &CTPlot
     = *static_cast<std::vector<std::pair<scalarType, SimplexId>> *>(CTPlot_);
-  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
-
-  const SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
-  // convert offsets into a valid format for contour tree
-  std::vector<SimplexId> voffsets(numberOfVertices);
-  std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
 
   // get contour tree
   ftm::FTMTreePP contourTree;
@@ -147,16 +150,20 @@ int ttk::PersistenceCurve::execute() const {
   contourTree.setupTriangulation(triangulation_, false);
   contourTree.setVertexScalars(inputScalars_);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
-  contourTree.setVertexSoSoffsets(voffsets.data());
+  // the input offsets are passed as is, so that the vertex order can be
+  // shared with the other modules
+  contourTree.setVertexSoSoffsets(static_cast<idType *>(inputOffsets_));
+  contourTree.setScalarsModificationTime(inputModificationTime_);
   contourTree.setSegmentation(false);
   contourTree.setThreadNumber(threadNumber_);
-  contourTree.build<scalarType, idType>();
 
-  // get persistence pairs
+  // get persistence pairs (the curves only need the pairs: no tree is built)
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> STPairs;
-  contourTree.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree.computePersistencePairs<scalarType>(STPairs, false);
+  contourTree.computeStreamingPersistencePairs<scalarType, idType>(
+    JTPairs, true);
+  contourTree.computeStreamingPersistencePairs<scalarType, idType>(
+    STPairs, false);
 
   // merge pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> CTPairs(
@@ -182,6 +189,7 @@ int ttk::PersistenceCurve::execute() const {
     morseSmaleComplex.setupTriangulation(triangulation_);
     morseSmaleComplex.setInputScalarField(inputScalars_);
     morseSmaleComplex.setInputOffsets(inputOffsets_);
+    morseSmaleComplex.setInputModificationTime(inputModificationTime_);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
       JTPairs, STPairs, pl_saddleSaddlePairs);
 
@@ -6,9 +6,11 @@ using namespace ttk;
 using namespace ftm;
 
 PersistenceDiagram::PersistenceDiagram()
-  : ComputeSaddleConnectors{},
+  : ComputeSaddleConnectors{}, UseStreamingPairs{true},
 
-    triangulation_{}, inputScalars_{}, CTDiagram_{} {
+    triangulation_{}, inputScalars_{}, inputOffsets_{},
+    inputModificationTime_{}, CTDiagram_{}, previousInputScalars_{},
+    previousInputOffsets_{}, previousCTDiagram_{} {
 }
 
 PersistenceDiagram::~PersistenceDiagram() {
@@ -20,6 +20,12 @@
 /// thresholds for topological simplification or for fast similarity
 /// estimations for instance.
 ///
+/// For time-varying fields, the vertex order of the previous time step can
+/// be reused (see setPreviousStep()): only the vertices which changed are
+/// sorted again, and the previous diagram is returned as is if none did.
+/// Otherwise, the merge trees (or the streaming pairs) are recomputed in
+/// full: only the sort is incremental.
+///
 /// \b Related \b publication \n
 /// "Computational Topology: An Introduction" \n
 /// Herbert Edelsbrunner and John Harer \n
@@ -53,6 +59,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Compute the extremum-saddle pairs with a streaming sweep instead of
+    /// building the join and split trees (default).
+    /// \sa ftm::FTMTreePP::computeStreamingPersistencePairs()
+    inline int setUseStreamingPairs(bool state) {
+      UseStreamingPairs = state;
+      return 0;
+    }
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -80,6 +94,26 @@ namespace ttk {
                              ttk::SimplexId>> &diagram,
       scalarType *scalars) const;
 
+    /// Same as above for pairs computed without the merge trees: the
+    /// critical types are deduced from the pairs. \p jtRoot and \p stRoot
+    /// are the last vertices of the join and split sweeps, \p jtRootType and
+    /// \p stRootType their critical types (given by the number of arcs
+    /// merged at the roots).
+    template <typename scalarType>
+    int computeCTPersistenceDiagram(
+      const ttk::SimplexId jtRoot,
+      const ttk::CriticalType jtRootType,
+      const ttk::SimplexId stRoot,
+      const ttk::CriticalType stRootType,
+      const std::vector<
+        std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>> &pairs,
+      std::vector<std::tuple<ttk::SimplexId,
+                             ttk::CriticalType,
+                             ttk::SimplexId,
+                             ttk::CriticalType,
+                             scalarType,
+                             ttk::SimplexId>> &diagram) const;
+
     template <class scalarType, typename idType>
     int execute() const;
 
@@ -110,20 +144,59 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the modification time of the scalar and offset fields, so that
+    /// their vertex order can be shared with the other modules (see
+    /// ttk::VertexOrder).
+    inline int setInputModificationTime(const unsigned long long &time) {
+      inputModificationTime_ = time;
+      return 0;
+    }
+
     inline int setOutputCTDiagram(void *data) {
       CTDiagram_ = data;
       return 0;
     }
 
+    /// Incremental mode for time-varying fields: \p scalars, \p offsets,
+    /// \p order (getOrder()) and \p diagram are the input fields, vertex
+    /// order and output diagram of the previous time step, computed with
+    /// the same parameters. The previous arrays should not be the current
+    /// ones. \p diagram may be the output diagram.
+    inline int
+      setPreviousStep(void *scalars,
+                      void *offsets,
+                      const std::shared_ptr<const VertexOrder::Order> &order,
+                      void *diagram) {
+      previousInputScalars_ = scalars;
+      previousInputOffsets_ = offsets;
+      previousOrder_ = order;
+      previousCTDiagram_ = diagram;
+      return 0;
+    }
+
+    /// Vertex order of the last call to execute(), to be passed to
+    /// setPreviousStep() for the next time step.
+    inline std::shared_ptr<const VertexOrder::Order> getOrder() const {
+      return order_;
+    }
+
   protected:
     std::vector<std::tuple<dcg::Cell, dcg::Cell>> *dmt_pairs;
 
     bool ComputeSaddleConnectors;
+    bool UseStreamingPairs;
 
     Triangulation *triangulation_;
     void *inputScalars_;
     void *inputOffsets_;
+    unsigned long long inputModificationTime_;
     void *CTDiagram_;
+
+    void *previousInputScalars_;
+    void *previousInputOffsets_;
+    std::shared_ptr<const VertexOrder::Order> previousOrder_;
+    void *previousCTDiagram_;
+    mutable std::shared_ptr<const VertexOrder::Order> order_;
   };
 } // namespace ttk
 
@@ -205,6 +278,51 @@ int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
   return 0;
 }
 
+template <typename scalarType>
+int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
+  const ttk::SimplexId jtRoot,
+  const ttk::CriticalType jtRootType,
+  const ttk::SimplexId stRoot,
+  const ttk::CriticalType stRootType,
+  const std::vector<
+    std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>> &pairs,
+  std::vector<std::tuple<ttk::SimplexId,
+                         ttk::CriticalType,
+                         ttk::SimplexId,
+                         ttk::CriticalType,
+                         scalarType,
+                         ttk::SimplexId>> &diagram) const {
+  const ttk::SimplexId numberOfPairs = pairs.size();
+  diagram.resize(numberOfPairs);
+  for(ttk::SimplexId i = 0; i < numberOfPairs; ++i) {
+    const ttk::SimplexId v0 = std::get<0>(pairs[i]);
+    const ttk::SimplexId v1 = std::get<1>(pairs[i]);
+    const scalarType persistenceValue = std::get<2>(pairs[i]);
+    const bool type = std::get<3>(pairs[i]);
+
+    // the first vertex of a pair is always an extremum, the second one a
+    // saddle except at the root of the tree
+    std::get<4>(diagram[i]) = persistenceValue;
+    if(type == true) {
+      std::get<0>(diagram[i]) = v0;
+      std::get<1>(diagram[i]) = ttk::CriticalType::Local_minimum;
+      std::get<2>(diagram[i]) = v1;
+      std::get<3>(diagram[i])
+        = v1 == jtRoot ? jtRootType : ttk::CriticalType::Saddle1;
+      std::get<5>(diagram[i]) = 0;
+    } else {
+      std::get<0>(diagram[i]) = v1;
+      std::get<1>(diagram[i])
+        = v1 == stRoot ? stRootType : ttk::CriticalType::Saddle2;
+      std::get<2>(diagram[i]) = v0;
+      std::get<3>(diagram[i]) = ttk::CriticalType::Local_maximum;
+      std::get<5>(diagram[i]) = 2;
+    }
+  }
+
+  return 0;
+}
+
 template <typename scalarType, typename idType>
 int ttk::PersistenceDiagram::execute() const {
 
@@ -218,27 +336,57 @@ int ttk::PersistenceDiagram::execute() const {
   scalarType *scalars = static_cast<scalarType *>(inputScalars_);
   SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
 
-  const ttk::SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
-  // convert offsets into a valid format for contour forests
-  std::vector<ttk::SimplexId> voffsets(numberOfVertices);
-  std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
-
   // get contour tree
   ftm::FTMTreePP contourTree;
   contourTree.setupTriangulation(triangulation_, false);
   contourTree.setVertexScalars(inputScalars_);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
-  contourTree.setVertexSoSoffsets(voffsets.data());
+  // the input offsets are passed as is, so that the vertex order can be
+  // shared with the other modules
+  contourTree.setVertexSoSoffsets(static_cast<idType *>(inputOffsets_));
+  contourTree.setScalarsModificationTime(inputModificationTime_);
   contourTree.setThreadNumber(threadNumber_);
   contourTree.setDebugLevel(debugLevel_);
   contourTree.setSegmentation(false);
-  contourTree.build<scalarType, idType>();
+  if(previousOrder_) {
+    // only the vertices which changed since the previous step are sorted,
+    // the next sorts reuse that order
+    contourTree.setPreviousField(
+      previousInputScalars_, previousInputOffsets_, previousOrder_);
+    contourTree.sortScalars<scalarType, idType>();
+    order_ = contourTree.getOrder();
+
+    // the diagram of an unchanged field is the previous one
+    if(previousCTDiagram_ && !contourTree.getUpdatedVertexNumber()) {
+      if(previousCTDiagram_ != CTDiagram_) {
+        CTDiagram = *static_cast<std::vector<
+          std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                     ttk::CriticalType, scalarType, ttk::SimplexId>> *>(
+          previousCTDiagram_);
+      }
+      std::stringstream msg;
+      msg << "[PersistenceDiagram] Unchanged field, diagram reused."
+          << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+      return 0;
+    }
+  }
 
   // get persistence pairs
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> STPairs;
-  contourTree.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree.computePersistencePairs<scalarType>(STPairs, false);
+  ttk::SimplexId jtRootArcNumber{}, stRootArcNumber{};
+  if(UseStreamingPairs) {
+    contourTree.computeStreamingPersistencePairs<scalarType, idType>(
+      JTPairs, true, &jtRootArcNumber);
+    contourTree.computeStreamingPersistencePairs<scalarType, idType>(
+      STPairs, false, &stRootArcNumber);
+  } else {
+    contourTree.build<scalarType, idType>();
+    contourTree.computePersistencePairs<scalarType>(JTPairs, true);
+    contourTree.computePersistencePairs<scalarType>(STPairs, false);
+  }
+  order_ = contourTree.getOrder();
 
   // merge pairs
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>>
@@ -285,8 +433,28 @@ int ttk::PersistenceDiagram::execute() const {
   }
 
   // get persistence diagrams
-  computeCTPersistenceDiagram<scalarType>(
-    contourTree, CTPairs, CTDiagram, scalars);
+  if(UseStreamingPairs) {
+    // the root of a tree is the last vertex of its sweep, typed as in
+    // getNodeType(): a saddle if several arcs are merged there. the pairs
+    // closed there cannot tell: on a disconnected domain, the other
+    // components are closed by the root without being merged there
+    ttk::SimplexId jtRoot{-1}, stRoot{-1};
+    if(order_ && !order_->sortedVertices.empty()) {
+      jtRoot = order_->sortedVertices.back();
+      stRoot = order_->sortedVertices.front();
+    }
+    const ttk::CriticalType jtRootType = jtRootArcNumber > 1
+                                           ? ttk::CriticalType::Saddle1
+                                           : ttk::CriticalType::Local_maximum;
+    const ttk::CriticalType stRootType = stRootArcNumber > 1
+                                           ? ttk::CriticalType::Saddle2
+                                           : ttk::CriticalType::Local_minimum;
+    computeCTPersistenceDiagram<scalarType>(
+      jtRoot, jtRootType, stRoot, stRootType, CTPairs, CTDiagram);
+  } else {
+    computeCTPersistenceDiagram<scalarType>(
+      contourTree, CTPairs, CTDiagram, scalars);
+  }
 
   // add saddle-saddle pairs to the diagram if needed
   if(dimensionality == 3 and ComputeSaddleConnectors) {
@@ -68,13 +68,12 @@ namespace ttk {
     dataType getMaxPersistence();
     dataType getLowestPersistence();
     dataType getMinimalPrice(int i);
-    std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> getKDTree();
+    KDTree<dataType> *getKDTree();
 
     void runMatching(dataType *total_cost,
                      dataType epsilon,
                      std::vector<int> sizes,
                      KDTree<dataType> *kdt,
-                     std::vector<KDTree<dataType> *> *correspondance_kdt_map,
                      std::vector<dataType> *min_diag_price,
                      std::vector<dataType> *min_price,
                      std::vector<std::vector<matchingTuple>> *all_matchings,
@@ -85,7 +84,6 @@ namespace ttk {
       dataType *total_cost,
       std::vector<int> sizes,
       KDTree<dataType> *kdt,
-      std::vector<KDTree<dataType> *> *correspondance_kdt_map,
       std::vector<dataType> *min_diag_price,
       std::vector<std::vector<matchingTuple>> *all_matchings,
       bool use_kdt);
@@ -51,7 +51,6 @@ void PDBarycenter<dataType>::runMatching(
   dataType epsilon,
   std::vector<int> sizes,
   KDTree<dataType> *kdt,
-  std::vector<KDTree<dataType> *> *correspondance_kdt_map,
   std::vector<dataType> *min_diag_price,
   std::vector<dataType> *min_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
@@ -68,8 +67,8 @@ void PDBarycenter<dataType>::runMatching(
     // "<<barycenter_goods_.size()<<" "<<min_diag_price->size()<<endl;
     Auction<dataType> auction = Auction<dataType>(
       &current_bidder_diagrams_.at(i), &barycenter_goods_.at(i), wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, *correspondance_kdt_map, epsilon,
-      min_diag_price->at(i), use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, epsilon, min_diag_price->at(i),
+      use_kdt);
     // cout<<"\n RUN MATCHINGS : "<<i<<endl;
     // cout<<use_kdt<<endl;
     // cout<<epsilon<<endl;
@@ -131,7 +130,6 @@ void PDBarycenter<dataType>::runMatchingAuction(
   dataType *total_cost,
   std::vector<int> sizes,
   KDTree<dataType> *kdt,
-  std::vector<KDTree<dataType> *> *correspondance_kdt_map,
   std::vector<dataType> *min_diag_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
   bool use_kdt) {
@@ -142,8 +140,7 @@ void PDBarycenter<dataType>::runMatchingAuction(
   for(int i = 0; i < numberOfInputs_; i++) {
     Auction<dataType> auction = Auction<dataType>(
       &current_bidder_diagrams_[i], &barycenter_goods_[i], wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, *correspondance_kdt_map,
-      (*min_diag_price)[i], use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, (*min_diag_price)[i], use_kdt);
     std::vector<matchingTuple> matchings;
     dataType cost = auction.run(&matchings);
     all_matchings->at(i) = matchings;
@@ -650,8 +647,7 @@ void PDBarycenter<dataType>::setInitialBarycenter(dataType min_persistence) {
 }
 
 template <typename dataType>
-std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>>
-  PDBarycenter<dataType>::getKDTree() {
+KDTree<dataType> *PDBarycenter<dataType>::getKDTree() {
   Timer tm;
   KDTree<dataType> *kdt = new KDTree<dataType>(true, wasserstein_);
 
@@ -679,15 +675,14 @@ std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>>
       weights[idx].push_back(g.getPrice());
     }
   }
-  // Correspondance map : position in barycenter_goods_ --> KDT node
-
-  std::vector<KDTree<dataType> *> correspondance_kdt_map
-    = kdt->build(coordinates.data(), barycenter_goods_[0].size(), dimension,
-                 weights, barycenter_goods_.size());
+  // The points of the KD-Tree are referred to by their position in
+  // barycenter_goods_
+  kdt->build(coordinates.data(), barycenter_goods_[0].size(), dimension,
+             weights, barycenter_goods_.size());
   if(debugLevel_ > 3)
     std::cout << "[Building KD-Tree] Time elapsed : " << tm.getElapsedTime()
               << " s." << std::endl;
-  return std::make_pair(kdt, correspondance_kdt_map);
+  return kdt;
 }
 
 // template <typename dataType>
@@ -841,16 +836,14 @@ std::vector<std::vector<matchingTuple>>
 
     n_iterations += 1;
 
-    std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+    KDTree<dataType> *kdt = nullptr;
     bool use_kdt = false;
     // If the barycenter is empty, do not compute the kdt (or it will crash :/)
     // TODO Fix KDTree to handle empty inputs...
     if(barycenter_goods_[0].size() > 0) {
-      pair = this->getKDTree();
+      kdt = this->getKDTree();
       use_kdt = true;
     }
-    KDTree<dataType> *kdt = pair.first;
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
     std::vector<std::vector<matchingTuple>> all_matchings(numberOfInputs_);
     std::vector<int> sizes(numberOfInputs_);
@@ -869,8 +862,8 @@ std::vector<std::vector<matchingTuple>>
       barycenter.push_back(t);
     }
 
-    runMatchingAuction(&total_cost, sizes, kdt, &correspondance_kdt_map,
-                       &min_diag_price, &all_matchings, use_kdt);
+    runMatchingAuction(&total_cost, sizes, kdt, &min_diag_price,
+                       &all_matchings, use_kdt);
 
     std::cout << "[PersistenceDiagramsBarycenter] Barycenter cost : "
               << total_cost << std::endl;
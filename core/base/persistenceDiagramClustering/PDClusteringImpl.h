@@ -1862,14 +1862,12 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
         // cout << "min diag prices and all done" << endl;
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> *kdt = nullptr;
         bool use_kdt = false;
         if(barycenter_computer_min_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_min_[c].getKDTree();
+          kdt = barycenter_computer_min_[c].getKDTree();
           use_kdt = true;
         }
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // cout<<"size of bidders :
         // "<<barycenter_computer_min_[c].getCurrentBidders().size()<<endl;
@@ -1878,9 +1876,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<time_preprocess_bary.getElapsedTime()<<endl; cout<<"time_matchings
         // min "; cout<<"run matchings "<<endl;
         barycenter_computer_min_[c].runMatching(
-          &total_cost, epsilon_[0], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(0)), &(min_price->at(0)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[0], sizes, kdt, &(min_diag_price->at(0)),
+          &(min_price->at(0)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][0][ii].resize(
             all_matchings[ii].size());
@@ -1989,20 +1986,17 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
 
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> *kdt = nullptr;
         bool use_kdt = false;
         if(barycenter_computer_sad_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_sad_[c].getKDTree();
+          kdt = barycenter_computer_sad_[c].getKDTree();
           use_kdt = true;
         }
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // std::cout<<"sad : run matchings"<<std::endl;
         barycenter_computer_sad_[c].runMatching(
-          &total_cost, epsilon_[1], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(1)), &(min_price->at(1)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[1], sizes, kdt, &(min_diag_price->at(1)),
+          &(min_price->at(1)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][1][ii].resize(
             all_matchings[ii].size());
@@ -2103,15 +2097,13 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<centroids_with_price_max.size()<<"
         // "<<centroids_with_price_max[0].size()<<endl;
 
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> *kdt = nullptr;
         bool use_kdt = false;
         if(barycenter_computer_max_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_max_[c].getKDTree();
+          kdt = barycenter_computer_max_[c].getKDTree();
           use_kdt = true;
         }
         // cout<<"here?"<<endl;
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // cout<<"max time_preprocess_bary
         // "<<time_preprocess_bary.getElapsedTime()<<endl; std::cout<<"max : run
@@ -2157,9 +2149,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // // cout<<"running matchings max"<<endl;
         // cout<<"size centroid "<<centroids_with_price_max[c].size()<<endl;
         barycenter_computer_max_[c].runMatching(
-          &total_cost, epsilon_[2], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(2)), &(min_price->at(2)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[2], sizes, kdt, &(min_diag_price->at(2)),
+          &(min_price->at(2)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][2][ii].resize(
             all_matchings[ii].size());
@@ -2214,10 +2205,6 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
           // cout<<"here end"<<endl;
         }
         delete kdt;
-        // for(unsigned int i_kdt=0; i_kdt<correspondance_kdt_map.size();
-        // i_kdt++){
-        //     delete correspondance_kdt_map[i_kdt];
-        // }
       }
 
       cost_ = cost_min_ + cost_sad_ + cost_max_;
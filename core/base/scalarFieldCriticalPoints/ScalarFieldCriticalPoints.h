@@ -9,8 +9,16 @@
 /// This class computes the list of critical points of the input scalar field
 /// and classify them according to their type.
 ///
+/// Each vertex is classified from its link only, by comparing (value, offset)
+/// pairs in place: no global order of the vertices is needed, so this class
+/// does not use ttk::VertexOrder. The vertex positions computed by
+/// ttk::VertexOrder are valid SoS offsets, if they are already available.
+///
 /// \param dataType Data type of the input scalar field (char, float,
 /// etc.).
+/// \param triangulationType Triangulation class used for the traversals:
+/// either ttk::Triangulation, or one of its implementations (see
+/// ttkTemplateMacro()) to avoid virtual calls.
 ///
 /// \b Related \b publication \n
 /// "Critical points and curvature for embedded polyhedral surfaces" \n
@@ -22,6 +30,8 @@
 #ifndef _SCALARFIELDCRITICALPOINTS_H
 #define _SCALARFIELDCRITICALPOINTS_H
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 
 // base code includes
@@ -31,7 +41,7 @@
 
 namespace ttk {
 
-  template <class dataType>
+  template <class dataType, class triangulationType = Triangulation>
   class ScalarFieldCriticalPoints : public Debug {
 
   public:
@@ -46,7 +56,7 @@ namespace ttk {
 
     std::pair<SimplexId, SimplexId>
       getNumberOfLowerUpperComponents(const SimplexId vertexId,
-                                      Triangulation *triangulation) const;
+                                      triangulationType *triangulation) const;
 
     char getCriticalType(const SimplexId &vertexId) const {
 
@@ -54,7 +64,7 @@ namespace ttk {
     }
 
     char getCriticalType(const SimplexId &vertexId,
-                         Triangulation *triangulation) const;
+                         triangulationType *triangulation) const;
 
     char getCriticalType(const SimplexId &vertexId,
                          const std::vector<std::pair<SimplexId, SimplexId>>
@@ -90,7 +100,7 @@ namespace ttk {
       return 0;
     }
 
-    int setupTriangulation(Triangulation *triangulation) {
+    int setupTriangulation(triangulationType *triangulation) {
 
       triangulation_ = triangulation;
 
@@ -139,6 +149,32 @@ namespace ttk {
     }
 
   protected:
+    /// Critical type of a vertex, given the number of connected components
+    /// of its lower and upper links.
+    char getCriticalType(const SimplexId &downValence,
+                         const SimplexId &upValence) const;
+
+    /// Build the link stencil of the interior vertices of a regular grid:
+    /// the identifier offsets of their neighbors and, for each bitmask of
+    /// lower neighbors, the number of connected components of the
+    /// corresponding sub-link.
+    /// \return Returns 0 upon success, negative values otherwise (not a
+    /// regular grid, or no interior vertices).
+    int getGridLinkTable(const SimplexId dimensions[3],
+                         std::vector<SimplexId> &neighborOffsets,
+                         std::vector<unsigned char> &componentNumbers) const;
+
+    /// Classify the vertices of a regular grid. The interior vertices are
+    /// processed row by row: their neighbors are compared in batches (one
+    /// neighbor for all the vertices of the row at a time, which the
+    /// compiler can vectorize) and their links classified with the
+    /// lookup table of getGridLinkTable(). The other vertices go through
+    /// the generic code path.
+    int getGridCriticalTypes(const SimplexId dimensions[3],
+                             const std::vector<SimplexId> &neighborOffsets,
+                             const std::vector<unsigned char> &componentNumbers,
+                             std::vector<char> &vertexTypes) const;
+
     int dimension_;
     SimplexId vertexNumber_;
     const dataType *scalarValues_;
@@ -147,7 +183,7 @@ namespace ttk {
     std::vector<std::pair<SimplexId, char>> *criticalPoints_;
     std::vector<SimplexId> *sosOffsets_;
     std::vector<SimplexId> localSosOffSets_;
-    Triangulation *triangulation_;
+    triangulationType *triangulation_;
 
     bool forceNonManifoldCheck;
   };
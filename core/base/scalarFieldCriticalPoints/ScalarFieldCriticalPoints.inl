@@ -3,8 +3,9 @@
 
 #include <ScalarFieldCriticalPoints.h>
 
-template <class dataType>
-ttk::ScalarFieldCriticalPoints<dataType>::ScalarFieldCriticalPoints() {
+template <class dataType, class triangulationType>
+ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  ScalarFieldCriticalPoints() {
 
   dimension_ = 0;
   vertexNumber_ = 0;
@@ -19,12 +20,13 @@ ttk::ScalarFieldCriticalPoints<dataType>::ScalarFieldCriticalPoints() {
   //   threadNumber_ = 1;
 }
 
-template <class dataType>
-ttk::ScalarFieldCriticalPoints<dataType>::~ScalarFieldCriticalPoints() {
+template <class dataType, class triangulationType>
+ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  ~ScalarFieldCriticalPoints() {
 }
 
-template <class dataType>
-int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
+template <class dataType, class triangulationType>
+int ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::execute() {
 
   // check the consistency of the variables -- to adapt
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -68,7 +70,17 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
 
   std::vector<char> vertexTypes(vertexNumber_);
 
-  if(triangulation_) {
+  SimplexId gridDimensions[3];
+  std::vector<SimplexId> neighborOffsets;
+  std::vector<unsigned char> componentNumbers;
+
+  if(triangulation_
+     && (triangulation_->getRegularGridDimensions(gridDimensions) == 0)
+     && (getGridLinkTable(gridDimensions, neighborOffsets, componentNumbers)
+         == 0)) {
+    getGridCriticalTypes(
+      gridDimensions, neighborOffsets, componentNumbers, vertexTypes);
+  } else if(triangulation_) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
@@ -198,10 +210,11 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
   return 0;
 }
 
-template <class dataType>
+template <class dataType, class triangulationType>
 std::pair<ttk::SimplexId, ttk::SimplexId>
-  ttk::ScalarFieldCriticalPoints<dataType>::getNumberOfLowerUpperComponents(
-    const SimplexId vertexId, Triangulation *triangulation) const {
+  ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+    getNumberOfLowerUpperComponents(const SimplexId vertexId,
+                                    triangulationType *triangulation) const {
 
   SimplexId neighborNumber = triangulation->getVertexNeighborNumber(vertexId);
   std::vector<SimplexId> lowerNeighbors, upperNeighbors;
@@ -338,14 +351,23 @@ std::pair<ttk::SimplexId, ttk::SimplexId>
   return std::make_pair(lowerList.size(), upperList.size());
 }
 
-template <class dataType>
-char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
-  const SimplexId &vertexId, Triangulation *triangulation) const {
+template <class dataType, class triangulationType>
+char ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  getCriticalType(const SimplexId &vertexId,
+                  triangulationType *triangulation) const {
 
   SimplexId downValence, upValence;
   std::tie(downValence, upValence)
     = getNumberOfLowerUpperComponents(vertexId, triangulation);
 
+  return getCriticalType(downValence, upValence);
+}
+
+template <class dataType, class triangulationType>
+char ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  getCriticalType(const SimplexId &downValence,
+                  const SimplexId &upValence) const {
+
   if(downValence == 0 && upValence == 1) {
     return static_cast<char>(CriticalType::Local_minimum);
   } else if(downValence == 1 && upValence == 0) {
@@ -386,10 +408,194 @@ char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
   return static_cast<char>(CriticalType::Regular);
 }
 
-template <class dataType>
-char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
-  const SimplexId &vertexId,
-  const std::vector<std::pair<SimplexId, SimplexId>> &vertexLink) const {
+template <class dataType, class triangulationType>
+int ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  getGridLinkTable(const SimplexId dimensions[3],
+                   std::vector<SimplexId> &neighborOffsets,
+                   std::vector<unsigned char> &componentNumbers) const {
+
+  // first interior vertex of the grid
+  SimplexId referenceVertex = 0;
+  SimplexId shift = 1;
+  for(int k = 0; k < 3; k++) {
+    if(dimensions[k] > 1) {
+      if(dimensions[k] < 3)
+        return -1;
+      referenceVertex += shift;
+    }
+    shift *= dimensions[k];
+  }
+
+  // the bitmasks of neighbors are stored on 16 bits
+  const SimplexId neighborNumber
+    = triangulation_->getVertexNeighborNumber(referenceVertex);
+  if(neighborNumber > 16)
+    return -2;
+
+  neighborOffsets.resize(neighborNumber);
+  for(SimplexId i = 0; i < neighborNumber; i++) {
+    SimplexId neighborId = -1;
+    triangulation_->getVertexNeighbor(referenceVertex, i, neighborId);
+    neighborOffsets[i] = neighborId - referenceVertex;
+  }
+
+  // link graph: two neighbors are adjacent if they share a star cell
+  std::vector<uint32_t> adjacency(neighborNumber, 0);
+  const SimplexId starNumber
+    = triangulation_->getVertexStarNumber(referenceVertex);
+  for(SimplexId i = 0; i < starNumber; i++) {
+    SimplexId cellId = -1;
+    triangulation_->getVertexStar(referenceVertex, i, cellId);
+
+    std::vector<SimplexId> linkVertices;
+    const SimplexId cellSize = triangulation_->getCellVertexNumber(cellId);
+    for(SimplexId j = 0; j < cellSize; j++) {
+      SimplexId vertexId = -1;
+      triangulation_->getCellVertex(cellId, j, vertexId);
+      if(vertexId == referenceVertex)
+        continue;
+      const auto it
+        = std::find(neighborOffsets.begin(), neighborOffsets.end(),
+                    vertexId - referenceVertex);
+      if(it == neighborOffsets.end())
+        return -3;
+      linkVertices.push_back(it - neighborOffsets.begin());
+    }
+
+    for(size_t j = 0; j < linkVertices.size(); j++) {
+      for(size_t k = j + 1; k < linkVertices.size(); k++) {
+        adjacency[linkVertices[j]] |= 1u << linkVertices[k];
+        adjacency[linkVertices[k]] |= 1u << linkVertices[j];
+      }
+    }
+  }
+
+  // number of connected components of the sub-link induced by each subset
+  // of neighbors
+  const uint32_t maskNumber = 1u << neighborNumber;
+  componentNumbers.resize(maskNumber);
+  for(uint32_t mask = 0; mask < maskNumber; mask++) {
+    unsigned char componentNumber = 0;
+    uint32_t remaining = mask;
+    while(remaining) {
+      // grow the component of the first remaining neighbor
+      uint32_t component = remaining & (~remaining + 1);
+      uint32_t previous = 0;
+      while(component != previous) {
+        previous = component;
+        for(SimplexId i = 0; i < neighborNumber; i++) {
+          if(previous & (1u << i))
+            component |= adjacency[i] & mask;
+        }
+      }
+      remaining &= ~component;
+      componentNumber++;
+    }
+    componentNumbers[mask] = componentNumber;
+  }
+
+  return 0;
+}
+
+template <class dataType, class triangulationType>
+int ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  getGridCriticalTypes(const SimplexId dimensions[3],
+                       const std::vector<SimplexId> &neighborOffsets,
+                       const std::vector<unsigned char> &componentNumbers,
+                       std::vector<char> &vertexTypes) const {
+
+  const SimplexId neighborNumber = neighborOffsets.size();
+  const dataType *values = scalarValues_;
+  const SimplexId *offsets = sosOffsets_->data();
+
+  // range of the interior vertices along each axis (flat axes included)
+  SimplexId begin[3], end[3];
+  for(int k = 0; k < 3; k++) {
+    begin[k] = (dimensions[k] > 1) ? 1 : 0;
+    end[k] = (dimensions[k] > 1) ? dimensions[k] - 1 : 1;
+  }
+
+  const SimplexId rowNumber = dimensions[1] * dimensions[2];
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    std::vector<uint16_t> lowerMasks(dimensions[0]), upperMasks(dimensions[0]);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+    for(SimplexId row = 0; row < rowNumber; row++) {
+
+      const SimplexId y = row % dimensions[1];
+      const SimplexId z = row / dimensions[1];
+      const SimplexId rowStart = row * dimensions[0];
+
+      if((y < begin[1]) || (y >= end[1]) || (z < begin[2]) || (z >= end[2])) {
+        for(SimplexId x = 0; x < dimensions[0]; x++) {
+          vertexTypes[rowStart + x]
+            = getCriticalType(rowStart + x, triangulation_);
+        }
+        continue;
+      }
+
+      for(SimplexId x = 0; x < begin[0]; x++) {
+        vertexTypes[rowStart + x]
+          = getCriticalType(rowStart + x, triangulation_);
+      }
+      for(SimplexId x = end[0]; x < dimensions[0]; x++) {
+        vertexTypes[rowStart + x]
+          = getCriticalType(rowStart + x, triangulation_);
+      }
+
+      for(SimplexId x = begin[0]; x < end[0]; x++) {
+        lowerMasks[x] = 0;
+        upperMasks[x] = 0;
+      }
+
+      // one neighbor at a time for the whole row, without branches, so
+      // that the comparisons can be vectorized
+      for(SimplexId j = 0; j < neighborNumber; j++) {
+        const SimplexId neighborOffset = neighborOffsets[j];
+        for(SimplexId x = begin[0]; x < end[0]; x++) {
+          const SimplexId v = rowStart + x;
+          const SimplexId n = v + neighborOffset;
+          const int isLower
+            = (values[n] < values[v])
+              | ((values[n] == values[v]) & (offsets[n] < offsets[v]));
+          const int isHigher
+            = (values[n] > values[v])
+              | ((values[n] == values[v]) & (offsets[n] > offsets[v]));
+          lowerMasks[x] |= (uint16_t)(isLower << j);
+          upperMasks[x] |= (uint16_t)(isHigher << j);
+        }
+      }
+
+      for(SimplexId x = begin[0]; x < end[0]; x++) {
+        SimplexId downValence = componentNumbers[lowerMasks[x]];
+        SimplexId upValence = componentNumbers[upperMasks[x]];
+        // same shortcut as getNumberOfLowerUpperComponents()
+        if(!forceNonManifoldCheck && !lowerMasks[x]) {
+          downValence = 0;
+          upValence = 1;
+        } else if(!forceNonManifoldCheck && !upperMasks[x]) {
+          downValence = 1;
+          upValence = 0;
+        }
+        vertexTypes[rowStart + x] = getCriticalType(downValence, upValence);
+      }
+    }
+  }
+
+  return 0;
+}
+
+template <class dataType, class triangulationType>
+char ttk::ScalarFieldCriticalPoints<dataType, triangulationType>::
+  getCriticalType(
+    const SimplexId &vertexId,
+    const std::vector<std::pair<SimplexId, SimplexId>> &vertexLink) const {
 
   std::map<SimplexId, SimplexId> global2LowerLink, global2UpperLink;
   std::map<SimplexId, SimplexId>::iterator neighborIt;
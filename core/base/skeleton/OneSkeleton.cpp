@@ -11,44 +11,62 @@ OneSkeleton::~OneSkeleton() {
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
+  const FlatJaggedArray &edgeStars,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  FlatJaggedArray &edgeLinks,
+  const SimplexId &beginId,
+  const SimplexId &endId) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
     return -1;
-  if((edgeStars.empty()) || (edgeStars.size() != edgeList.size()))
-    return -2;
   if(!cellArray)
     return -3;
 #endif
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
+  const SimplexId lastId = (endId == -1) ? edgeList.size() : endId;
+
+  // the star table may cover the processed edges only
+  const SimplexId starShift
+    = (edgeStars.size() == (SimplexId)edgeList.size()) ? 0 : beginId;
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeStars.empty())
+     || ((edgeStars.size() != (SimplexId)edgeList.size())
+         && (edgeStars.size() != lastId - beginId)))
+    return -2;
+#endif
+
+  // each triangle of the star contributes exactly one vertex to the link
+  edgeLinks.resize(lastId - beginId);
+  for(SimplexId i = 0; i < edgeLinks.size(); i++) {
+    edgeLinks.setRowSize(i, edgeStars.size(beginId + i - starShift));
+  }
+  edgeLinks.prefixSum();
 
   SimplexId verticesPerCell = cellArray[0];
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
-    for(SimplexId j = 0; j < (SimplexId)edgeStars[i].size(); j++) {
+  for(SimplexId i = 0; i < edgeLinks.size(); i++) {
+    const SimplexId edgeId = beginId + i;
+    const SimplexId starRow = edgeId - starShift;
+    SimplexId *link = edgeLinks.rowData(i);
+
+    for(SimplexId j = 0; j < edgeStars.size(starRow); j++) {
+
+      const LongSimplexId *cell
+        = &(cellArray[(verticesPerCell + 1) * edgeStars.get(starRow, j) + 1]);
 
-      SimplexId vertexId = -1;
       for(int k = 0; k < 3; k++) {
-        if((cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
-            != edgeList[i].first)
-           && (cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
-               != edgeList[i].second)) {
-          vertexId = cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k];
+        if((cell[k] != edgeList[edgeId].first)
+           && (cell[k] != edgeList[edgeId].second)) {
+          link[j] = cell[k];
           break;
         }
       }
-      if(vertexId != -1) {
-        edgeLinks[i].push_back(vertexId);
-      }
     }
   }
 
@@ -64,48 +82,68 @@ int OneSkeleton::buildEdgeLinks(
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
-  const vector<vector<SimplexId>> &cellEdges,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  const FlatJaggedArray &edgeStars,
+  const FlatJaggedArray &cellEdges,
+  FlatJaggedArray &edgeLinks,
+  const SimplexId &beginId,
+  const SimplexId &endId) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
     return -1;
-  if((edgeStars.empty()) || (edgeStars.size() != edgeList.size()))
-    return -2;
   if(cellEdges.empty())
     return -3;
 #endif
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
+  const SimplexId lastId = (endId == -1) ? edgeList.size() : endId;
+
+  // the star table may cover the processed edges only
+  const SimplexId starShift
+    = (edgeStars.size() == (SimplexId)edgeList.size()) ? 0 : beginId;
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeStars.empty())
+     || ((edgeStars.size() != (SimplexId)edgeList.size())
+         && (edgeStars.size() != lastId - beginId)))
+    return -2;
+#endif
+
+  // each tetrahedron of the star contributes exactly one edge to the link
+  edgeLinks.resize(lastId - beginId);
+  for(SimplexId i = 0; i < edgeLinks.size(); i++) {
+    edgeLinks.setRowSize(i, edgeStars.size(beginId + i - starShift));
+  }
+  edgeLinks.prefixSum();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
+  for(SimplexId i = 0; i < edgeLinks.size(); i++) {
 
+    const SimplexId edgeId = beginId + i;
+    const SimplexId starRow = edgeId - starShift;
+    SimplexId *link = edgeLinks.rowData(i);
     SimplexId otherEdgeId = -1;
 
-    for(SimplexId j = 0; j < (SimplexId)edgeStars[i].size(); j++) {
+    for(SimplexId j = 0; j < edgeStars.size(starRow); j++) {
 
+      const SimplexId cellId = edgeStars.get(starRow, j);
       SimplexId linkEdgeId = -1;
 
-      for(SimplexId k = 0; k < (SimplexId)cellEdges[edgeStars[i][j]].size();
-          k++) {
-        otherEdgeId = cellEdges[edgeStars[i][j]][k];
+      for(SimplexId k = 0; k < cellEdges.size(cellId); k++) {
+        otherEdgeId = cellEdges.get(cellId, k);
 
-        if((edgeList[otherEdgeId].first != edgeList[i].first)
-           && (edgeList[otherEdgeId].first != edgeList[i].second)
-           && (edgeList[otherEdgeId].second != edgeList[i].first)
-           && (edgeList[otherEdgeId].second != edgeList[i].second)) {
+        if((edgeList[otherEdgeId].first != edgeList[edgeId].first)
+           && (edgeList[otherEdgeId].first != edgeList[edgeId].second)
+           && (edgeList[otherEdgeId].second != edgeList[edgeId].first)
+           && (edgeList[otherEdgeId].second != edgeList[edgeId].second)) {
           linkEdgeId = otherEdgeId;
           break;
         }
       }
 
-      edgeLinks[i].push_back(linkEdgeId);
+      link[j] = linkEdgeId;
     }
   }
 
@@ -125,12 +163,6 @@ int OneSkeleton::buildEdgeList(
   const LongSimplexId *cellArray,
   vector<pair<SimplexId, SimplexId>> &edgeList) const {
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  threadNumber_ = 1;
-
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
     return -1;
@@ -138,26 +170,33 @@ int OneSkeleton::buildEdgeList(
 
   Timer t;
 
-  vector<vector<vector<SimplexId>>> threadedEdgeTable(threadNumber_);
-
-  for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
-    threadedEdgeTable[i].resize(vertexNumber);
-  }
-
   // WARNING!
   // assuming triangulations here
-  SimplexId verticesPerCell = cellArray[0];
+  const SimplexId verticesPerCell = cellArray[0];
+  const SimplexId edgesPerCell = verticesPerCell * (verticesPerCell - 1) / 2;
+
+  // each edge candidate is encoded by a single key
+  // (smallest vertex id in the high bits, largest one in the low bits)
+  const int vertexBits = RadixSort::keyBits(vertexNumber);
+  if(2 * vertexBits > 64) {
+    // two vertex identifiers do not fit in a 64-bit key
+    stringstream msg;
+    msg << "[OneSkeleton] Too many vertices (" << vertexNumber
+        << ") for the edge keys." << endl;
+    dMsg(cerr, msg.str(), Debug::fatalMsg);
+    return -2;
+  }
+  const size_t candidateNumber = (size_t)cellNumber * edgesPerCell;
+  vector<uint64_t> candidates(candidateNumber), buffer;
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < cellNumber; i++) {
 
-    ThreadId threadId = 0, tmpVertexId = 0;
-    pair<SimplexId, SimplexId> edgeIds;
-#ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
-#endif
+    const LongSimplexId *cell = &(cellArray[(verticesPerCell + 1) * i + 1]);
+    uint64_t *cellCandidates = &(candidates[(size_t)i * edgesPerCell]);
+    SimplexId localEdgeId = 0;
 
     // tet case
     // 0 - 1
@@ -168,82 +207,71 @@ int OneSkeleton::buildEdgeList(
     // 2 - 3
     for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
       for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
-        // edge processing
-        edgeIds.first = cellArray[(verticesPerCell + 1) * i + 1 + j];
-        edgeIds.second = cellArray[(verticesPerCell + 1) * i + 1 + k];
-
-        if(edgeIds.first > edgeIds.second) {
-          tmpVertexId = edgeIds.first;
-          edgeIds.first = edgeIds.second;
-          edgeIds.second = tmpVertexId;
-        }
-
-        bool hasFound = false;
-        for(SimplexId l = 0;
-            l < (SimplexId)threadedEdgeTable[threadId][edgeIds.first].size();
-            l++) {
-          if(edgeIds.second == threadedEdgeTable[threadId][edgeIds.first][l]) {
-            hasFound = true;
-            break;
-          }
-        }
-        if(!hasFound) {
-          threadedEdgeTable[threadId][edgeIds.first].push_back(edgeIds.second);
-        }
-        // end of edge processing
+        uint64_t v0 = cell[j], v1 = cell[k];
+        if(v0 > v1)
+          swap(v0, v1);
+        cellCandidates[localEdgeId++] = (v0 << vertexBits) | v1;
       }
     }
   }
 
-  // now merge the thing
-  SimplexId edgeCount = 0;
-  vector<vector<SimplexId>> edgeTable;
-
-  if(threadNumber_ > 1) {
-    edgeTable.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
-
-      for(SimplexId j = 0; j < (SimplexId)threadedEdgeTable[i].size(); j++) {
+  // sorting the candidates gives the edges in lexicographic order, with
+  // duplicates next to each other
+  RadixSort::sort(
+    candidates, buffer, [](const uint64_t &key) { return key; },
+    2 * vertexBits, threadNumber_);
+  vector<uint64_t>().swap(buffer);
 
-        for(SimplexId k = 0; k < (SimplexId)threadedEdgeTable[i][j].size();
-            k++) {
-
-          // search if it already exists
-          bool hasFound = false;
+  // compaction: each thread counts the edges starting in its chunk, a prefix
+  // sum gives the identifier of its first edge.
+  ThreadId threadNumber = threadNumber_;
+#ifdef TTK_ENABLE_OPENMP
+  if(candidateNumber < (size_t)threadNumber)
+    threadNumber = 1;
+#else
+  threadNumber = 1;
+#endif
+  vector<size_t> chunkOffsets(threadNumber + 1, 0);
+  const uint64_t vertexMask = (((uint64_t)1) << vertexBits) - 1;
 
-          for(SimplexId l = 0; l < (SimplexId)edgeTable[j].size(); l++) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#endif
+  {
+    // the team may be smaller than requested
+    ThreadId threadId = 0;
+    ThreadId teamSize = 1;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+    teamSize = omp_get_num_threads();
+#endif
+    const size_t begin = (candidateNumber * threadId) / teamSize;
+    const size_t end = (candidateNumber * (threadId + 1)) / teamSize;
 
-            if(edgeTable[j][l] == threadedEdgeTable[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound) {
-            edgeTable[j].push_back(threadedEdgeTable[i][j][k]);
-            edgeCount++;
-          }
-        }
-      }
+    size_t localEdgeNumber = 0;
+    for(size_t i = begin; i < end; i++) {
+      if((!i) || (candidates[i] != candidates[i - 1]))
+        localEdgeNumber++;
     }
-  } else {
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable[0].size(); i++)
-      edgeCount += threadedEdgeTable[0][i].size();
-  }
-
-  vector<vector<SimplexId>> *masterEdgeTable = &edgeTable;
-  if(threadNumber_ == 1) {
-    masterEdgeTable = &(threadedEdgeTable[0]);
-  }
+    chunkOffsets[threadId + 1] = localEdgeNumber;
 
-  edgeList.resize(edgeCount);
-  edgeCount = 0;
-  for(SimplexId i = 0; i < (SimplexId)masterEdgeTable->size(); i++) {
-
-    for(SimplexId j = 0; j < (SimplexId)(*masterEdgeTable)[i].size(); j++) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+    {
+      for(ThreadId j = 0; j < teamSize; j++)
+        chunkOffsets[j + 1] += chunkOffsets[j];
+      edgeList.resize(chunkOffsets[teamSize]);
+    }
 
-      edgeList[edgeCount].first = i;
-      edgeList[edgeCount].second = (*masterEdgeTable)[i][j];
-      edgeCount++;
+    size_t edgeId = chunkOffsets[threadId];
+    for(size_t i = begin; i < end; i++) {
+      if((!i) || (candidates[i] != candidates[i - 1])) {
+        edgeList[edgeId].first = candidates[i] >> vertexBits;
+        edgeList[edgeId].second = candidates[i] & vertexMask;
+        edgeId++;
+      }
     }
   }
 
@@ -255,12 +283,6 @@ int OneSkeleton::buildEdgeList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 10.4979 s
-  // 24 threads: 12.3994 s [not efficient in parallel]
-
   return 0;
 }
 
@@ -310,17 +332,15 @@ int OneSkeleton::buildEdgeLists(
 int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
                                 const SimplexId &cellNumber,
                                 const LongSimplexId *cellArray,
-                                vector<vector<SimplexId>> &starList,
+                                FlatJaggedArray &starList,
                                 vector<pair<SimplexId, SimplexId>> *edgeList,
-                                vector<vector<SimplexId>> *vertexStars) const {
+                                FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
     return -1;
 #endif
 
-  Timer t;
-
   auto localEdgeList = edgeList;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
   if(!localEdgeList) {
@@ -331,16 +351,12 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
     buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
-  starList.resize(localEdgeList->size());
-  for(SimplexId i = 0; i < (SimplexId)starList.size(); i++)
-    starList[i].reserve(16);
-
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
-  if((SimplexId)localVertexStars->size() != vertexNumber) {
+  if(localVertexStars->size() != vertexNumber) {
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setThreadNumber(threadNumber_);
     zeroSkeleton.setDebugLevel(debugLevel_);
@@ -348,30 +364,63 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
       vertexNumber, cellNumber, cellArray, *localVertexStars);
   }
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+  return buildEdgeStars(*localEdgeList, *localVertexStars, starList);
+}
+
+int OneSkeleton::buildEdgeStars(
+  const vector<pair<SimplexId, SimplexId>> &edgeList,
+  const FlatJaggedArray &vertexStars,
+  FlatJaggedArray &starList,
+  const SimplexId &beginId,
+  const SimplexId &endId) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(vertexStars.empty())
+    return -1;
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
 
-    SimplexId vertex0 = (*localEdgeList)[i].first;
-    SimplexId vertex1 = (*localEdgeList)[i].second;
+  Timer t;
 
-    // merge the two vertex stars
-    for(SimplexId j = 0; j < (SimplexId)(*localVertexStars)[vertex0].size();
-        j++) {
+  const SimplexId lastId = (endId == -1) ? edgeList.size() : endId;
 
-      bool hasFound = false;
-      for(SimplexId k = 0; k < (SimplexId)(*localVertexStars)[vertex1].size();
-          k++) {
-        if((*localVertexStars)[vertex0][j] == (*localVertexStars)[vertex1][k]) {
-          hasFound = true;
-          break;
+  // the edge star is the intersection of the (sorted) stars of its two
+  // vertices. first pass: count, second pass: fill.
+  starList.resize(lastId - beginId);
+
+  for(int pass = 0; pass < 2; pass++) {
+
+    if(pass == 1)
+      starList.prefixSum();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < starList.size(); i++) {
+
+      const auto star0 = vertexStars[edgeList[beginId + i].first];
+      const auto star1 = vertexStars[edgeList[beginId + i].second];
+
+      SimplexId *edgeStar = (pass == 1) ? starList.rowData(i) : nullptr;
+      SimplexId starSize = 0;
+
+      SimplexId pos0 = 0, pos1 = 0;
+      while((pos0 < star0.size()) && (pos1 < star1.size())) {
+        if(star0[pos0] < star1[pos1]) {
+          pos0++;
+        } else if(star1[pos1] < star0[pos0]) {
+          pos1++;
+        } else {
+          // common to the two vertex stars
+          if(edgeStar)
+            edgeStar[starSize] = star0[pos0];
+          starSize++;
+          pos0++;
+          pos1++;
         }
       }
-      if(hasFound) {
-        // common to the two vertex stars
-        starList[i].push_back((*localVertexStars)[vertex0][j]);
-      }
+
+      if(pass == 0)
+        starList.setRowSize(i, starSize);
     }
   }
 
@@ -16,6 +16,7 @@
 #include <map>
 
 // base code includes
+#include <RadixSort.h>
 #include <Wrapper.h>
 #include <ZeroSkeleton.h>
 
@@ -33,47 +34,60 @@ namespace ttk {
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of triangle
-    /// identifiers.
+    /// \param edgeStars List of edge stars. The number of rows of this table
+    /// should be equal to the number of edges. Each row lists triangle
+    /// identifiers. When a range of edges is processed, it may also have
+    /// only endId - beginId rows, the i-th row being the star of the edge
+    /// beginId + i.
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// \param edgeLinks Output edge links. The number of rows of this table
+    /// will be equal to the number of edges in the triangulation. Each row
+    /// lists the vertices in the link of the corresponding edge.
+    /// \param beginId Optional first edge to process (default: 0).
+    /// \param endId Optional edge where to stop (excluded). By default (-1),
+    /// all the edges are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the link of the
+    /// edge beginId + i.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
+      const FlatJaggedArray &edgeStars,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      FlatJaggedArray &edgeLinks,
+      const SimplexId &beginId = 0,
+      const SimplexId &endId = -1) const;
 
     /// Compute the link of each edge of a 3D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of
-    /// tetrahedron
-    /// identifiers.
-    /// \param cellEdges List of celle edges. The size of this std::vector
+    /// \param edgeStars List of edge stars. The number of rows of this table
+    /// should be equal to the number of edges. Each row lists tetrahedron
+    /// identifiers. When a range of edges is processed, it may also have
+    /// only endId - beginId rows, the i-th row being the star of the edge
+    /// beginId + i.
+    /// \param cellEdges List of cell edges. The number of rows of this table
     /// should be equal to the number of tetrahedra in the triangulation. Each
-    /// entry is a std::vector of edge identifiers.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// row lists edge identifiers.
+    /// \param edgeLinks Output edge links. The number of rows of this table
+    /// will be equal to the number of edges in the triangulation. Each row
+    /// lists the edges in the link of the corresponding edge.
+    /// \param beginId Optional first edge to process (default: 0).
+    /// \param endId Optional edge where to stop (excluded). By default (-1),
+    /// all the edges are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the link of the
+    /// edge beginId + i.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
-      const std::vector<std::vector<SimplexId>> &cellEdges,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      const FlatJaggedArray &edgeStars,
+      const FlatJaggedArray &cellEdges,
+      FlatJaggedArray &edgeLinks,
+      const SimplexId &beginId = 0,
+      const SimplexId &endId = -1) const;
 
     /// Compute the list of edges of a valid triangulation.
     /// \param vertexNumber Number of vertices in the triangulation.
@@ -83,8 +97,8 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param edgeList Output edge list (each entry is an ordered std::pair
-    /// of
-    /// vertex identifiers).
+    /// of vertex identifiers). Edges are sorted in lexicographic order, hence
+    /// edge identifiers do not depend on the number of threads.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeList(
       const SimplexId &vertexNumber,
@@ -113,11 +127,10 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param starList Output list of 3-stars. The size of this std::vector
-    /// will
-    /// be equal to the number of edges in the mesh. Each entry stores a
-    /// std::vector that lists the identifiers of all 3-dimensional cells
-    /// connected to the entry's edge.
+    /// \param starList Output list of 3-stars. The number of rows of this
+    /// table will be equal to the number of edges in the mesh. Each row lists
+    /// (by increasing order) the identifiers of all 3-dimensional cells
+    /// connected to the row's edge.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -132,22 +145,42 @@ namespace ttk {
     /// \param vertexStars Optional list of vertex stars (list of
     /// 3-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
-    /// behavior is unspecified.
+    /// to a non-empty table, this function will use this table as internal
+    /// vertex star list (its rows must be sorted, as returned by
+    /// ZeroSkeleton::buildVertexStars()). If this table is not empty but
+    /// incorrect, the behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeStars(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
                        const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &starList,
+                       FlatJaggedArray &starList,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexStars
-                       = NULL) const;
+                       FlatJaggedArray *vertexStars = NULL) const;
+
+    /// Compute the 3-star of the edges of a triangulation, given its edge
+    /// list and its vertex stars.
+    /// \param edgeList List of edges. Each entry is a std::pair of vertex
+    /// identifiers.
+    /// \param vertexStars List of vertex stars. Its rows must be sorted (as
+    /// returned by ZeroSkeleton::buildVertexStars()).
+    /// \param starList Output list of 3-stars. Each row lists (by increasing
+    /// order) the identifiers of the cells connected to the row's edge.
+    /// \param beginId Optional first edge to process (default: 0).
+    /// \param endId Optional edge where to stop (excluded). By default (-1),
+    /// all the edges are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the star of the
+    /// edge beginId + i.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int buildEdgeStars(
+      const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
+      const FlatJaggedArray &vertexStars,
+      FlatJaggedArray &starList,
+      const SimplexId &beginId = 0,
+      const SimplexId &endId = -1) const;
 
     /// Compute the list of edges of a sub-portion of a valid triangulation.
     /// \param cellNumber Number of maximum-dimensional cells in the
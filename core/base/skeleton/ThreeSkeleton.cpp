@@ -9,13 +9,12 @@ ThreeSkeleton::ThreeSkeleton() {
 ThreeSkeleton::~ThreeSkeleton() {
 }
 
-int ThreeSkeleton::buildCellEdges(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellEdges,
-  vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *vertexEdges) const {
+int ThreeSkeleton::buildCellEdges(const SimplexId &vertexNumber,
+                                  const SimplexId &cellNumber,
+                                  const LongSimplexId *cellArray,
+                                  FlatJaggedArray &cellEdges,
+                                  vector<pair<SimplexId, SimplexId>> *edgeList,
+                                  FlatJaggedArray *vertexEdges) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexNumber <= 0)
@@ -31,7 +30,7 @@ int ThreeSkeleton::buildCellEdges(
   auto localEdgeList = edgeList;
   auto localVertexEdges = vertexEdges;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
-  vector<vector<SimplexId>> defaultVertexEdges{};
+  FlatJaggedArray defaultVertexEdges{};
 
   if(!localEdgeList) {
     localEdgeList = &defaultEdgeList;
@@ -59,14 +58,13 @@ int ThreeSkeleton::buildCellEdges(
       vertexNumber, *localEdgeList, *localVertexEdges);
   }
 
-  cellEdges.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellEdges.size(); i++) {
-    // optimized for tet meshes
-    cellEdges[i].reserve(6);
-  }
-
   int vertexPerCell = cellArray[0];
 
+  // one edge per pair of cell vertices (6 for tet meshes)
+  cellEdges.setUniform(cellNumber, vertexPerCell * (vertexPerCell - 1) / 2);
+
+  const FlatJaggedArray &localVertexEdgeList = *localVertexEdges;
+
   // for each cell, for each pair of vertices, find the edge
   // TODO: check for parallel efficiency here
 #ifdef TTK_ENABLE_OPENMP
@@ -75,6 +73,8 @@ int ThreeSkeleton::buildCellEdges(
   for(SimplexId i = 0; i < cellNumber; i++) {
 
     SimplexId cellId = (vertexPerCell + 1) * i;
+    SimplexId *edges = cellEdges.rowData(i);
+    SimplexId localEdgeNumber = 0;
 
     for(SimplexId j = 0; j < vertexPerCell; j++) {
 
@@ -85,10 +85,9 @@ int ThreeSkeleton::buildCellEdges(
 
         // loop around the edges of vertexId0 in search of vertexId1
         SimplexId edgeId = -1;
-        for(SimplexId l = 0;
-            l < (SimplexId)(*localVertexEdges)[vertexId0].size(); l++) {
+        for(SimplexId l = 0; l < localVertexEdgeList.size(vertexId0); l++) {
 
-          SimplexId localEdgeId = (*localVertexEdges)[vertexId0][l];
+          SimplexId localEdgeId = localVertexEdgeList.get(vertexId0, l);
           if(((*localEdgeList)[localEdgeId].first == vertexId1)
              || ((*localEdgeList)[localEdgeId].second == vertexId1)) {
             edgeId = localEdgeId;
@@ -96,7 +95,7 @@ int ThreeSkeleton::buildCellEdges(
           }
         }
 
-        cellEdges[i].push_back(edgeId);
+        edges[localEdgeNumber++] = edgeId;
       }
     }
   }
@@ -115,13 +114,13 @@ int ThreeSkeleton::buildCellNeighborsFromTriangles(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *triangleStars) const {
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *triangleStars) const {
 
   Timer t;
 
   auto localTriangleStars = triangleStars;
-  vector<vector<SimplexId>> defaultTriangleStars{};
+  FlatJaggedArray defaultTriangleStars{};
   if(!localTriangleStars) {
     localTriangleStars = &defaultTriangleStars;
   }
@@ -135,86 +134,38 @@ int ThreeSkeleton::buildCellNeighborsFromTriangles(
       vertexNumber, cellNumber, cellArray, NULL, localTriangleStars);
   }
 
-  SimplexId vertexPerCell = cellArray[0];
-
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++) {
-    cellNeighbors[i].reserve(vertexPerCell);
-  }
+  const FlatJaggedArray &stars = *localTriangleStars;
 
   // NOTE: not efficient so far in parallel
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
-  if(threadNumber_ == 1) {
-
-    for(SimplexId i = 0; i < (SimplexId)localTriangleStars->size(); i++) {
-
-      if((*localTriangleStars)[i].size() == 2) {
-
-        // interior triangle
-        cellNeighbors[(*localTriangleStars)[i][0]].push_back(
-          (*localTriangleStars)[i][1]);
-
-        cellNeighbors[(*localTriangleStars)[i][1]].push_back(
-          (*localTriangleStars)[i][0]);
-      }
-    }
-  } else {
-
-    vector<vector<vector<SimplexId>>> threadedCellNeighbors(threadNumber_);
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedCellNeighbors[i].resize(cellNumber);
-      for(SimplexId j = 0; j < (SimplexId)threadedCellNeighbors[i].size(); j++)
-        threadedCellNeighbors[i][j].reserve(4);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)(*localTriangleStars).size(); i++) {
-
-      ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      if((*localTriangleStars)[i].size() == 2) {
-
-        // interior triangles
-
-        threadedCellNeighbors[threadId][(*localTriangleStars)[i][0]].push_back(
-          (*localTriangleStars)[i][1]);
-
-        threadedCellNeighbors[threadId][(*localTriangleStars)[i][1]].push_back(
-          (*localTriangleStars)[i][0]);
-      }
+  // two passes over the interior triangles (count, then fill).
+  cellNeighbors.resize(cellNumber);
+  for(SimplexId i = 0; i < stars.size(); i++) {
+    if(stars.size(i) == 2) {
+      // interior triangle
+      cellNeighbors.incrementRowSize(stars.get(i, 0));
+      cellNeighbors.incrementRowSize(stars.get(i, 1));
     }
-
-    // now merge things
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < (SimplexId)threadedCellNeighbors[i].size();
-          j++) {
-
-        for(SimplexId k = 0; k < (SimplexId)threadedCellNeighbors[i][j].size();
-            k++) {
-          cellNeighbors[j].push_back(threadedCellNeighbors[i][j][k]);
-        }
-      }
+  }
+  cellNeighbors.prefixSum();
+
+  vector<SimplexId> fillCount(cellNumber, 0);
+  for(SimplexId i = 0; i < stars.size(); i++) {
+    if(stars.size(i) == 2) {
+      const SimplexId cell0 = stars.get(i, 0);
+      const SimplexId cell1 = stars.get(i, 1);
+      cellNeighbors.rowData(cell0)[fillCount[cell0]++] = cell1;
+      cellNeighbors.rowData(cell1)[fillCount[cell1]++] = cell0;
     }
   }
 
   {
     stringstream msg;
     msg << "[ThreeSkeleton] Cell neighbors (" << cellNumber
-        << " cells) computed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << endl;
+        << " cells) computed in " << t.getElapsedTime() << " s. (1"
+        << " thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiol.vtu, 8.7Mtets, vger (4coresHT)
   // 1 thread: 9.80 s
   // 4 threads: 14.18157 s
@@ -238,8 +189,8 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *vertexStars) const {
 
   if(cellArray[0] == 3) {
 
@@ -262,7 +213,7 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
 
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
@@ -279,16 +230,12 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
 
   int vertexPerCell = cellArray[0];
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++)
-    cellNeighbors[i].reserve(vertexPerCell);
+  // NOTE: vertex stars are sorted by construction (see
+  // ZeroSkeleton::buildVertexStars()), no need to pre-sort them.
+  const FlatJaggedArray &stars = *localVertexStars;
 
-    // pre-sort vertex stars
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    sort((*localVertexStars)[i].begin(), (*localVertexStars)[i].end());
+  // one neighbor candidate per cell triangle, -1 if on the boundary
+  vector<SimplexId> neighborCandidates(cellNumber * vertexPerCell, -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -298,64 +245,41 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
     // go triangle by triangle
     for(SimplexId j = 0; j < vertexPerCell; j++) {
 
-      SimplexId v0
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j) % vertexPerCell];
-      SimplexId v1
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j + 1) % vertexPerCell];
-      SimplexId v2
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j + 2) % vertexPerCell];
+      const auto star0
+        = stars[cellArray[(vertexPerCell + 1) * i + 1 + (j) % vertexPerCell]];
+      const auto star1 = stars[cellArray[(vertexPerCell + 1) * i + 1
+                                         + (j + 1) % vertexPerCell]];
+      const auto star2 = stars[cellArray[(vertexPerCell + 1) * i + 1
+                                         + (j + 2) % vertexPerCell]];
 
       // perform an intersection of the 3 (sorted) star lists
       SimplexId pos0 = 0, pos1 = 0, pos2 = 0;
-      SimplexId intersection = -1;
 
-      while((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-            && (pos1 < (SimplexId)(*localVertexStars)[v1].size())
-            && (pos2 < (SimplexId)(*localVertexStars)[v2].size())) {
+      while((pos0 < star0.size()) && (pos1 < star1.size())
+            && (pos2 < star2.size())) {
 
-        SimplexId biggest = (*localVertexStars)[v0][pos0];
-        if((*localVertexStars)[v1][pos1] > biggest) {
-          biggest = (*localVertexStars)[v1][pos1];
+        SimplexId biggest = star0[pos0];
+        if(star1[pos1] > biggest) {
+          biggest = star1[pos1];
         }
-        if((*localVertexStars)[v2][pos2] > biggest) {
-          biggest = (*localVertexStars)[v2][pos2];
+        if(star2[pos2] > biggest) {
+          biggest = star2[pos2];
         }
 
-        for(SimplexId l = pos0; l < (SimplexId)(*localVertexStars)[v0].size();
-            l++) {
-          if((*localVertexStars)[v0][l] < biggest) {
-            pos0++;
-          } else {
-            break;
-          }
-        }
-        for(SimplexId l = pos1; l < (SimplexId)(*localVertexStars)[v1].size();
-            l++) {
-          if((*localVertexStars)[v1][l] < biggest) {
-            pos1++;
-          } else {
-            break;
-          }
-        }
-        for(SimplexId l = pos2; l < (SimplexId)(*localVertexStars)[v2].size();
-            l++) {
-          if((*localVertexStars)[v2][l] < biggest) {
-            pos2++;
-          } else {
-            break;
-          }
-        }
+        while((pos0 < star0.size()) && (star0[pos0] < biggest))
+          pos0++;
+        while((pos1 < star1.size()) && (star1[pos1] < biggest))
+          pos1++;
+        while((pos2 < star2.size()) && (star2[pos2] < biggest))
+          pos2++;
 
-        if((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-           && (pos1 < (SimplexId)(*localVertexStars)[v1].size())
-           && (pos2 < (SimplexId)(*localVertexStars)[v2].size())) {
+        if((pos0 < star0.size()) && (pos1 < star1.size())
+           && (pos2 < star2.size())) {
 
-          if(((*localVertexStars)[v0][pos0] == (*localVertexStars)[v1][pos1])
-             && ((*localVertexStars)[v0][pos0]
-                 == (*localVertexStars)[v2][pos2])) {
+          if((star0[pos0] == star1[pos1]) && (star0[pos0] == star2[pos2])) {
 
-            if((*localVertexStars)[v0][pos0] != i) {
-              intersection = (*localVertexStars)[v0][pos0];
+            if(star0[pos0] != i) {
+              neighborCandidates[i * vertexPerCell + j] = star0[pos0];
               break;
             }
 
@@ -365,10 +289,27 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
           }
         }
       }
+    }
+  }
 
-      if(intersection != -1) {
-        cellNeighbors[i].push_back(intersection);
-      }
+  cellNeighbors.resize(cellNumber);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(SimplexId j = 0; j < vertexPerCell; j++) {
+      if(neighborCandidates[i * vertexPerCell + j] != -1)
+        cellNeighbors.incrementRowSize(i);
+    }
+  }
+  cellNeighbors.prefixSum();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    SimplexId *neighbors = cellNeighbors.rowData(i);
+    SimplexId neighborNumber = 0;
+    for(SimplexId j = 0; j < vertexPerCell; j++) {
+      if(neighborCandidates[i * vertexPerCell + j] != -1)
+        neighbors[neighborNumber++] = neighborCandidates[i * vertexPerCell + j];
     }
   }
 
@@ -66,11 +66,10 @@ namespace ttk {
     int buildCellEdges(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
                        const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &cellEdges,
+                       FlatJaggedArray &cellEdges,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexEdges
-                       = NULL) const;
+                       FlatJaggedArray *vertexEdges = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -104,8 +103,8 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *triangleStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *triangleStars = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -135,8 +134,8 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *vertexStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *vertexStars = NULL) const;
 
   protected:
   };
@@ -13,13 +13,13 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *vertexStars) const {
 
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
 
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
@@ -36,16 +36,12 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
 
   SimplexId vertexPerCell = cellArray[0];
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++)
-    cellNeighbors[i].reserve(vertexPerCell);
+  // NOTE: vertex stars are sorted by construction (see
+  // ZeroSkeleton::buildVertexStars()), no need to pre-sort them.
+  const FlatJaggedArray &stars = *localVertexStars;
 
-    // pre-sort vertex stars
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    sort((*localVertexStars)[i].begin(), (*localVertexStars)[i].end());
+  // one neighbor candidate per cell edge, -1 if on the boundary
+  vector<SimplexId> neighborCandidates(cellNumber * vertexPerCell, -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -59,49 +55,45 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
         = cellArray[(vertexPerCell + 1) * i + 1 + (j + 1) % vertexPerCell];
 
       // perform an intersection of the 2 sorted star lists
+      const auto star0 = stars[v0];
+      const auto star1 = stars[v1];
       SimplexId pos0 = 0, pos1 = 0;
-      SimplexId intersection = -1;
-
-      while((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-            && (pos1 < (SimplexId)(*localVertexStars)[v1].size())) {
-
-        SimplexId biggest = (*localVertexStars)[v0][pos0];
-        if((*localVertexStars)[v1][pos1] > biggest) {
-          biggest = (*localVertexStars)[v1][pos1];
-        }
 
-        for(SimplexId l = pos0; l < (SimplexId)(*localVertexStars)[v0].size();
-            l++) {
-          if((*localVertexStars)[v0][l] < biggest) {
-            pos0++;
-          } else {
-            break;
-          }
-        }
-        for(SimplexId l = pos1; l < (SimplexId)(*localVertexStars)[v1].size();
-            l++) {
-          if((*localVertexStars)[v1][l] < biggest) {
-            pos1++;
-          } else {
-            break;
-          }
-        }
-
-        if((*localVertexStars)[v0][pos0] == (*localVertexStars)[v1][pos1]) {
-
-          if((*localVertexStars)[v0][pos0] != i) {
-            intersection = (*localVertexStars)[v0][pos0];
+      while((pos0 < star0.size()) && (pos1 < star1.size())) {
+        if(star0[pos0] < star1[pos1]) {
+          pos0++;
+        } else if(star1[pos1] < star0[pos0]) {
+          pos1++;
+        } else {
+          if(star0[pos0] != i) {
+            neighborCandidates[i * vertexPerCell + j] = star0[pos0];
             break;
           }
-
           pos0++;
           pos1++;
         }
       }
+    }
+  }
 
-      if(intersection != -1) {
-        cellNeighbors[i].push_back(intersection);
-      }
+  cellNeighbors.resize(cellNumber);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(SimplexId j = 0; j < vertexPerCell; j++) {
+      if(neighborCandidates[i * vertexPerCell + j] != -1)
+        cellNeighbors.incrementRowSize(i);
+    }
+  }
+  cellNeighbors.prefixSum();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    SimplexId *neighbors = cellNeighbors.rowData(i);
+    SimplexId neighborNumber = 0;
+    for(SimplexId j = 0; j < vertexPerCell; j++) {
+      if(neighborCandidates[i * vertexPerCell + j] != -1)
+        neighbors[neighborNumber++] = neighborCandidates[i * vertexPerCell + j];
     }
   }
 
@@ -120,13 +112,13 @@ int TwoSkeleton::buildEdgeTriangles(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeTriangleList,
-  vector<vector<SimplexId>> *vertexStarList,
+  FlatJaggedArray &edgeTriangleList,
+  FlatJaggedArray *vertexStarList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *edgeStarList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *edgeStarList,
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -151,13 +143,13 @@ int TwoSkeleton::buildEdgeTriangles(
   }
 
   auto localEdgeStarList = edgeStarList;
-  vector<vector<SimplexId>> defaultEdgeStarList{};
+  FlatJaggedArray defaultEdgeStarList{};
   if(!localEdgeStarList) {
     localEdgeStarList = &defaultEdgeStarList;
   }
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
@@ -167,7 +159,7 @@ int TwoSkeleton::buildEdgeTriangles(
   // need it.
 
   auto localCellTriangleList = cellTriangleList;
-  vector<vector<SimplexId>> defaultCellTriangleList{};
+  FlatJaggedArray defaultCellTriangleList{};
   if(!localCellTriangleList) {
     localCellTriangleList = &defaultCellTriangleList;
   }
@@ -193,67 +185,96 @@ int TwoSkeleton::buildEdgeTriangles(
                       triangleStarList, localCellTriangleList);
   }
 
-  edgeTriangleList.resize(localEdgeList->size());
+  const SimplexId edgeNumber = localEdgeList->size();
+  const FlatJaggedArray &edgeStars = *localEdgeStarList;
+  const FlatJaggedArray &cellTriangles = *localCellTriangleList;
+  const FlatJaggedArray &triangles = *localTriangleList;
+
+  // per-thread scratch buffer (no allocation per edge)
+  vector<vector<SimplexId>> threadedEdgeTriangles(threadNumber_);
+  for(ThreadId i = 0; i < threadNumber_; i++) {
+    threadedEdgeTriangles[i].reserve(32);
+  }
+
+  // first pass: count, second pass: fill.
+  edgeTriangleList.resize(edgeNumber);
+
+  for(int pass = 0; pass < 2; pass++) {
+
+    if(pass == 1)
+      edgeTriangleList.prefixSum();
 
-  // alright, let's get things done now.
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-    SimplexId vertexId0, vertexId1, vertexId2;
+    for(SimplexId i = 0; i < edgeNumber; i++) {
 
-    for(SimplexId j = 0; j < (SimplexId)(*localEdgeStarList)[i].size(); j++) {
-      SimplexId tetId = (*localEdgeStarList)[i][j];
+      ThreadId threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+      threadId = omp_get_thread_num();
+#endif
+      vector<SimplexId> &edgeTriangles = threadedEdgeTriangles[threadId];
+      edgeTriangles.clear();
 
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localCellTriangleList)[tetId].size(); k++) {
-        SimplexId triangleId = (*localCellTriangleList)[tetId][k];
+      SimplexId vertexId0, vertexId1, vertexId2;
+      const SimplexId first = (*localEdgeList)[i].first;
+      const SimplexId second = (*localEdgeList)[i].second;
 
-        bool isAttached = false;
+      for(SimplexId j = 0; j < edgeStars.size(i); j++) {
+        SimplexId tetId = edgeStars.get(i, j);
 
-        vertexId0 = (*localTriangleList)[triangleId][0];
-        vertexId1 = (*localTriangleList)[triangleId][1];
-        vertexId2 = (*localTriangleList)[triangleId][2];
+        for(SimplexId k = 0; k < cellTriangles.size(tetId); k++) {
+          SimplexId triangleId = cellTriangles.get(tetId, k);
 
-        if((*localEdgeList)[i].first == vertexId0) {
-          if(((*localEdgeList)[i].second == vertexId1)
-             || ((*localEdgeList)[i].second == vertexId2)) {
-            isAttached = true;
+          bool isAttached = false;
+
+          vertexId0 = triangles.get(triangleId, 0);
+          vertexId1 = triangles.get(triangleId, 1);
+          vertexId2 = triangles.get(triangleId, 2);
+
+          if(first == vertexId0) {
+            if((second == vertexId1) || (second == vertexId2)) {
+              isAttached = true;
+            }
           }
-        }
 
-        if((*localEdgeList)[i].first == vertexId1) {
-          if(((*localEdgeList)[i].second == vertexId0)
-             || ((*localEdgeList)[i].second == vertexId2)) {
-            isAttached = true;
+          if(first == vertexId1) {
+            if((second == vertexId0) || (second == vertexId2)) {
+              isAttached = true;
+            }
           }
-        }
 
-        if((*localEdgeList)[i].first == vertexId2) {
-          if(((*localEdgeList)[i].second == vertexId1)
-             || ((*localEdgeList)[i].second == vertexId0)) {
-            isAttached = true;
+          if(first == vertexId2) {
+            if((second == vertexId1) || (second == vertexId0)) {
+              isAttached = true;
+            }
           }
-        }
 
-        if(isAttached) {
+          if(isAttached) {
 
-          bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)edgeTriangleList[i].size(); l++) {
-            if(edgeTriangleList[i][l] == triangleId) {
-              isIn = true;
-              break;
+            bool isIn = false;
+            for(size_t l = 0; l < edgeTriangles.size(); l++) {
+              if(edgeTriangles[l] == triangleId) {
+                isIn = true;
+                break;
+              }
+            }
+            if(!isIn) {
+              edgeTriangles.push_back(triangleId);
             }
-          }
-          if(!isIn) {
-            edgeTriangleList[i].push_back(triangleId);
           }
         }
       }
+
+      if(pass == 0) {
+        edgeTriangleList.setRowSize(i, edgeTriangles.size());
+      } else {
+        copy(edgeTriangles.begin(), edgeTriangles.end(),
+             edgeTriangleList.rowData(i));
+      }
     }
   }
 
-  SimplexId edgeNumber = localEdgeList->size();
   SimplexId triangleNumber = localTriangleList->size();
 
   {
@@ -267,23 +288,15 @@ int TwoSkeleton::buildEdgeTriangles(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleList(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStars,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+int TwoSkeleton::buildTriangleList(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const LongSimplexId *cellArray,
+                                   FlatJaggedArray *triangleList,
+                                   FlatJaggedArray *triangleStars,
+                                   FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
-  SimplexId triangleNumber = 0;
-
   // check the consistency of the variables -- to adapt
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexNumber <= 0)
@@ -298,284 +311,156 @@ int TwoSkeleton::buildTriangleList(
   }
 #endif
 
-  if(triangleList) {
-    // NOTE: 9 is pretty empirical here...
-    triangleList->clear();
-    triangleList->reserve(9 * vertexNumber);
-  }
-  if(triangleStars) {
-    triangleStars->clear();
-    triangleStars->reserve(9 * vertexNumber);
-  }
-  if(cellTriangleList) {
-    cellTriangleList->resize(cellNumber);
-    for(SimplexId i = 0; i < cellNumber; i++)
-      // assuming tet-mesh here
-      (*cellTriangleList)[i].resize(4, -1);
+  // one candidate per tet face: the two smallest vertex ids are packed in a
+  // single key, the cell face (4 * cellId + localTriangleId) is kept along.
+  struct TriangleCandidate {
+    uint64_t key01;
+    SimplexId v2;
+    SimplexId face;
+  };
+
+  const int vertexBits = RadixSort::keyBits(vertexNumber);
+  if(2 * vertexBits > 64) {
+    // two vertex identifiers do not fit in a 64-bit key
+    stringstream msg;
+    msg << "[TwoSkeleton] Too many vertices (" << vertexNumber
+        << ") for the triangle keys." << endl;
+    dMsg(cerr, msg.str(), Debug::fatalMsg);
+    return -5;
   }
+  const size_t candidateNumber = 4 * (size_t)cellNumber;
+  vector<TriangleCandidate> candidates(candidateNumber), buffer;
 
-  if(threadNumber_ == 1) {
-
-    // for each vertex,
-    //   list of triangles
-    //    each triangle is a list vertex Id + a triangleId
-    vector<vector<pair<vector<SimplexId>, SimplexId>>> triangleTable(
-      vertexNumber);
-    for(SimplexId i = 0; i < vertexNumber; i++)
-      triangleTable[i].reserve(32);
-
-    for(SimplexId i = 0; i < cellNumber; i++) {
-
-      if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
-
-        vector<SimplexId> triangle(3);
-
-        for(int j = 0; j < 4; j++) {
-          // doing triangle j
-
-          for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
-          }
-          sort(triangle.begin(), triangle.end());
-
-          SimplexId triangleId = -1;
-          for(SimplexId k = 0; k < (SimplexId)triangleTable[triangle[0]].size();
-              k++) {
-
-            // processing a triangle stored for that vertex
-            if((triangleTable[triangle[0]][k].first[1] == triangle[1])
-               && (triangleTable[triangle[0]][k].first[2] == triangle[2])) {
-              triangleId = triangleTable[triangle[0]][k].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-            // not found yet
-            triangleId = triangleNumber;
-            triangleTable[triangle[0]].push_back(
-              pair<vector<SimplexId>, SimplexId>(triangle, triangleNumber));
-            triangleNumber++;
-
-            if(triangleList) {
-              triangleList->size();
-              triangleList->push_back(triangle);
-            }
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              // store the tet i in the triangleStars list
-              triangleStars->back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              // add tet i as a neighbor of triangleId
-              (*triangleStars)[triangleId].push_back(i);
-            }
-          }
-
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            for(int k = 0; k < 4; k++) {
-              if((*cellTriangleList)[i][k] == -1) {
-                (*cellTriangleList)[i][k] = triangleId;
-                break;
-              }
-            }
-          }
-        }
-
-        // update the progress bar of the wrapping code -- to adapt
-        if(debugLevel_ > advancedInfoMsg) {
-          if((wrapper_) && (!(i % ((cellNumber) / 10)))) {
-            wrapper_->updateProgress((i + 1.0) / cellNumber);
-          }
-        }
+  // assuming tet-mesh here
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(int j = 0; j < 4; j++) {
+      // doing triangle j
+      SimplexId triangle[3];
+      for(int k = 0; k < 3; k++) {
+        triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
       }
-    }
-  } else {
-
-    Timer memTimer;
-    //  for each thread,
-    //    for each vertex
-    //      for each triangle
-    //        vertex ids
-    //        triangleId
-    vector<vector<vector<pair<vector<SimplexId>, SimplexId>>>>
-      threadedTriangleTable(threadNumber_);
+      sort(triangle, triangle + 3);
 
-    vector<SimplexId> triangleNumbers(threadNumber_, 0);
-
-    vector<vector<vector<SimplexId>>> threadedTriangleStars(threadNumber_);
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedTriangleTable[i].resize(vertexNumber);
+      TriangleCandidate &candidate = candidates[4 * (size_t)i + j];
+      candidate.key01 = (((uint64_t)triangle[0]) << vertexBits) | triangle[1];
+      candidate.v2 = triangle[2];
+      candidate.face = 4 * i + j;
     }
+  }
 
-    int count = 0;
+  // LSD sort: least significant vertex first. Both sorts are stable, so the
+  // faces of a given triangle remain ordered by increasing tet id.
+  RadixSort::sort(
+    candidates, buffer,
+    [](const TriangleCandidate &c) { return (uint64_t)c.v2; }, vertexBits,
+    threadNumber_);
+  RadixSort::sort(
+    candidates, buffer,
+    [](const TriangleCandidate &c) { return c.key01; }, 2 * vertexBits,
+    threadNumber_);
+  vector<TriangleCandidate>().swap(buffer);
+
+  auto isNewTriangle = [&candidates](const size_t &i) {
+    return (!i) || (candidates[i].key01 != candidates[i - 1].key01)
+           || (candidates[i].v2 != candidates[i - 1].v2);
+  };
 
-    // the following open-mp processing is only relevant for embarassingly
-    // parallel algorithms (such as smoothing) -- to adapt
+  if(cellTriangleList) {
+    cellTriangleList->setUniform(cellNumber, 4);
+  }
+
+  // compaction: each thread counts the triangles starting in its chunk, a
+  // prefix sum gives the identifier of its first triangle.
+  ThreadId threadNumber = threadNumber_;
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+  if(candidateNumber < (size_t)threadNumber)
+    threadNumber = 1;
+#else
+  threadNumber = 1;
 #endif
-    for(SimplexId i = 0; i < (SimplexId)cellNumber; i++) {
-
-      // avoid any processing if the abort signal is sent
-      if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
+  vector<size_t> chunkOffsets(threadNumber + 1, 0);
+  vector<size_t> triangleStarts;
+  const uint64_t vertexMask = (((uint64_t)1) << vertexBits) - 1;
 
-        ThreadId threadId = 1;
 #ifdef TTK_ENABLE_OPENMP
-        threadId = omp_get_thread_num();
+#pragma omp parallel num_threads(threadNumber)
 #endif
+  {
+    // the team may be smaller than requested
+    ThreadId threadId = 0;
+    ThreadId teamSize = 1;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+    teamSize = omp_get_num_threads();
+#endif
+    const size_t begin = (candidateNumber * threadId) / teamSize;
+    const size_t end = (candidateNumber * (threadId + 1)) / teamSize;
 
-        vector<SimplexId> triangle(3);
-
-        for(int j = 0; j < 4; j++) {
-          // doing triangle j
-
-          for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
-          }
-          sort(triangle.begin(), triangle.end());
-
-          SimplexId triangleId = -1;
-          for(SimplexId k = 0;
-              k
-              < (SimplexId)threadedTriangleTable[threadId][triangle[0]].size();
-              k++) {
-
-            // processing a triangle stored for that vertex
-            if((threadedTriangleTable[threadId][triangle[0]][k].first[1]
-                == triangle[1])
-               && (threadedTriangleTable[threadId][triangle[0]][k].first[2]
-                   == triangle[2])) {
-              triangleId
-                = threadedTriangleTable[threadId][triangle[0]][k].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-            // not visited by this thread
-            threadedTriangleTable[threadId][triangle[0]].push_back(
-              pair<vector<SimplexId>, SimplexId>(
-                triangle, triangleNumbers[threadId]));
-            triangleNumbers[threadId]++;
-
-            if(triangleStars) {
-              threadedTriangleStars[threadId].resize(
-                threadedTriangleStars[threadId].size() + 1);
-              threadedTriangleStars[threadId].back().resize(1);
-              threadedTriangleStars[threadId].back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              threadedTriangleStars[threadId][triangleId].push_back(i);
-            }
-          }
-        }
+    size_t localTriangleNumber = 0;
+    for(size_t i = begin; i < end; i++) {
+      if(isNewTriangle(i))
+        localTriangleNumber++;
+    }
+    chunkOffsets[threadId + 1] = localTriangleNumber;
 
-        // update the progress bar of the wrapping code -- to adapt
-        if(debugLevel_ > advancedInfoMsg) {
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
+#pragma omp barrier
+#pragma omp single
 #endif
-          {
-            if((wrapper_) && (!(count % ((cellNumber) / 10)))) {
-              wrapper_->updateProgress((count + 1.0) / cellNumber);
-            }
+    {
+      for(ThreadId j = 0; j < teamSize; j++)
+        chunkOffsets[j + 1] += chunkOffsets[j];
+      triangleStarts.resize(chunkOffsets[teamSize] + 1);
+      triangleStarts.back() = candidateNumber;
+    }
 
-            count++;
-          }
-        }
+    // the chunk may start in the middle of a triangle started by the
+    // previous thread
+    SimplexId triangleId = (SimplexId)chunkOffsets[threadId] - 1;
+    for(size_t i = begin; i < end; i++) {
+      if(isNewTriangle(i)) {
+        triangleId++;
+        triangleStarts[triangleId] = i;
+      }
+      if(cellTriangleList) {
+        const SimplexId face = candidates[i].face;
+        cellTriangleList->rowData(face / 4)[face % 4] = triangleId;
       }
     }
+  }
 
-    Timer mergeTimer;
-    // now merge the lists
-    vector<vector<pair<vector<SimplexId>, SimplexId>>> mainTriangleTable(
-      vertexNumber);
-    //     for(int i = 0; i < vertexNumber; i++){
-    //       mainTriangleTable[i].reserve(32);
-    //     }
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // vertex j
-      for(SimplexId j = 0; j < (SimplexId)threadedTriangleTable[i].size();
-          j++) {
-
-        // triangle k
-        for(SimplexId k = 0; k < (SimplexId)threadedTriangleTable[i][j].size();
-            k++) {
-
-          SimplexId triangleId = -1;
-          // triangle l
-          for(SimplexId l = 0; l < (SimplexId)mainTriangleTable[j].size();
-              l++) {
-            if((threadedTriangleTable[i][j][k].first[0]
-                == mainTriangleTable[j][l].first[0])
-               && (threadedTriangleTable[i][j][k].first[1]
-                   == mainTriangleTable[j][l].first[1])
-               && (threadedTriangleTable[i][j][k].first[2]
-                   == mainTriangleTable[j][l].first[2])) {
-
-              triangleId = mainTriangleTable[j][l].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-
-            triangleId = triangleNumber;
-            mainTriangleTable[j].push_back(pair<vector<SimplexId>, SimplexId>(
-              threadedTriangleTable[i][j][k].first, triangleNumber));
-            triangleNumber++;
-
-            if(triangleList)
-              triangleList->push_back(mainTriangleTable[j].back().first);
-
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              triangleStars->back()
-                = threadedTriangleStars[i]
-                                       [threadedTriangleTable[i][j][k].second];
-            }
-          } else {
-            if(triangleStars) {
-              for(SimplexId l = 0;
-                  l < (SimplexId)threadedTriangleStars
-                        [i][threadedTriangleTable[i][j][k].second]
-                          .size();
-                  l++) {
-                (*triangleStars)[triangleId].push_back(
-                  threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                             .second][l]);
-              }
-            }
-          }
+  const SimplexId triangleNumber = (SimplexId)triangleStarts.size() - 1;
 
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            SimplexId cellId = -1;
-
-            for(SimplexId l = 0;
-                l
-                < (SimplexId)
-                    threadedTriangleStars[i]
-                                         [threadedTriangleTable[i][j][k].second]
-                                           .size();
-                l++) {
-              cellId = threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                                  .second][l];
-              for(int m = 0; m < 4; m++) {
-                if((*cellTriangleList)[cellId][m] == -1) {
-                  (*cellTriangleList)[cellId][m] = triangleId;
-                  break;
-                }
-              }
-            }
-          }
-        }
+  if(triangleList) {
+    triangleList->setUniform(triangleNumber, 3);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < triangleNumber; i++) {
+      const TriangleCandidate &candidate = candidates[triangleStarts[i]];
+      SimplexId *triangle = triangleList->rowData(i);
+      triangle[0] = candidate.key01 >> vertexBits;
+      triangle[1] = candidate.key01 & vertexMask;
+      triangle[2] = candidate.v2;
+    }
+  }
+
+  if(triangleStars) {
+    triangleStars->resize(triangleNumber);
+    for(SimplexId i = 0; i < triangleNumber; i++) {
+      triangleStars->setRowSize(i, triangleStarts[i + 1] - triangleStarts[i]);
+    }
+    triangleStars->prefixSum();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < triangleNumber; i++) {
+      SimplexId *star = triangleStars->rowData(i);
+      for(size_t j = triangleStarts[i]; j < triangleStarts[i + 1]; j++) {
+        star[j - triangleStarts[i]] = candidates[j].face / 4;
       }
     }
   }
@@ -588,24 +473,6 @@ int TwoSkeleton::buildTriangleList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 58.5631 s
-  // 24 threads: 87.5816 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - no tet adj
-  // 1 thread: 5.7427 s
-  // 4 threads: 9.14764 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - tet adjacency
-  // 1 thread: 8.59854 s
-  // 4 threads: 15.837 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - tet adjacency only
-  // 1 thread: 6.85897 s
-  // 4 threads: 14.78 s (~)
-
   return 0;
 }
 
@@ -613,12 +480,12 @@ int TwoSkeleton::buildTriangleEdgeList(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleEdgeList,
-  vector<vector<SimplexId>> *vertexEdgeList,
+  FlatJaggedArray &triangleEdgeList,
+  FlatJaggedArray *vertexEdgeList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -638,7 +505,7 @@ int TwoSkeleton::buildTriangleEdgeList(
   }
 
   auto localVertexEdgeList = vertexEdgeList;
-  vector<vector<SimplexId>> defaultVertexEdgeList{};
+  FlatJaggedArray defaultVertexEdgeList{};
   if(!localVertexEdgeList) {
     localVertexEdgeList = &defaultVertexEdgeList;
   }
@@ -658,7 +525,7 @@ int TwoSkeleton::buildTriangleEdgeList(
   // can compute them for free optionally.
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
@@ -668,7 +535,11 @@ int TwoSkeleton::buildTriangleEdgeList(
                       triangleStarList, cellTriangleList);
   }
 
-  triangleEdgeList.resize(localTriangleList->size());
+  const FlatJaggedArray &triangles = *localTriangleList;
+  const FlatJaggedArray &vertexEdges = *localVertexEdgeList;
+
+  // each triangle has exactly 3 edges
+  triangleEdgeList.setUniform(triangles.size(), 3);
 
   // now for each triangle, grab its vertices, add the edges in the triangle
   // with no duplicate
@@ -676,14 +547,16 @@ int TwoSkeleton::buildTriangleEdgeList(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localTriangleList->size(); i++) {
+  for(SimplexId i = 0; i < triangles.size(); i++) {
+    SimplexId *triangleEdges = triangleEdgeList.rowData(i);
+    SimplexId triangleEdgeNumber = 0;
+
     SimplexId vertexId = -1;
-    for(SimplexId j = 0; j < (SimplexId)(*localTriangleList)[i].size(); j++) {
-      vertexId = (*localTriangleList)[i][j];
+    for(SimplexId j = 0; j < triangles.size(i); j++) {
+      vertexId = triangles.get(i, j);
 
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localVertexEdgeList)[vertexId].size(); k++) {
-        SimplexId edgeId = (*localVertexEdgeList)[vertexId][k];
+      for(SimplexId k = 0; k < vertexEdges.size(vertexId); k++) {
+        SimplexId edgeId = vertexEdges.get(vertexId, k);
 
         SimplexId otherVertexId = (*localEdgeList)[edgeId].first;
 
@@ -692,9 +565,8 @@ int TwoSkeleton::buildTriangleEdgeList(
         }
 
         bool isInTriangle = false;
-        for(SimplexId l = 0; l < (SimplexId)(*localTriangleList)[i].size();
-            l++) {
-          if((*localTriangleList)[i][l] == otherVertexId) {
+        for(SimplexId l = 0; l < triangles.size(i); l++) {
+          if(triangles.get(i, l) == otherVertexId) {
             isInTriangle = true;
             break;
           }
@@ -702,14 +574,14 @@ int TwoSkeleton::buildTriangleEdgeList(
 
         if(isInTriangle) {
           bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)triangleEdgeList[i].size(); l++) {
-            if(triangleEdgeList[i][l] == edgeId) {
+          for(SimplexId l = 0; l < triangleEdgeNumber; l++) {
+            if(triangleEdges[l] == edgeId) {
               isIn = true;
               break;
             }
           }
-          if(!isIn) {
-            triangleEdgeList[i].push_back(edgeId);
+          if((!isIn) && (triangleEdgeNumber < 3)) {
+            triangleEdges[triangleEdgeNumber++] = edgeId;
           }
         }
       }
@@ -731,11 +603,12 @@ int TwoSkeleton::buildTriangleEdgeList(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleLinks(
-  const vector<vector<SimplexId>> &triangleList,
-  const vector<vector<SimplexId>> &triangleStars,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleLinks) const {
+int TwoSkeleton::buildTriangleLinks(const FlatJaggedArray &triangleList,
+                                    const FlatJaggedArray &triangleStars,
+                                    const LongSimplexId *cellArray,
+                                    FlatJaggedArray &triangleLinks,
+                                    const SimplexId &beginId,
+                                    const SimplexId &endId) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(triangleList.empty())
@@ -748,21 +621,33 @@ int TwoSkeleton::buildTriangleLinks(
 
   Timer t;
 
-  triangleLinks.resize(triangleList.size());
+  const SimplexId lastId = (endId == -1) ? triangleList.size() : endId;
+
+  // each tetrahedron of the star contributes exactly one vertex to the link
+  triangleLinks.resize(lastId - beginId);
+  for(SimplexId i = 0; i < triangleLinks.size(); i++) {
+    triangleLinks.setRowSize(i, triangleStars.size(beginId + i));
+  }
+  triangleLinks.prefixSum();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
+  for(SimplexId i = 0; i < triangleLinks.size(); i++) {
+
+    const SimplexId triangleId = beginId + i;
+    SimplexId *link = triangleLinks.rowData(i);
 
-    for(SimplexId j = 0; j < (SimplexId)triangleStars[i].size(); j++) {
+    for(SimplexId j = 0; j < triangleStars.size(triangleId); j++) {
 
       for(int k = 0; k < 4; k++) {
-        SimplexId vertexId = cellArray[5 * triangleStars[i][j] + 1 + k];
+        SimplexId vertexId
+          = cellArray[5 * triangleStars.get(triangleId, j) + 1 + k];
 
-        if((vertexId != triangleList[i][0]) && (vertexId != triangleList[i][1])
-           && (vertexId != triangleList[i][2])) {
-          triangleLinks[i].push_back(vertexId);
+        if((vertexId != triangleList.get(triangleId, 0))
+           && (vertexId != triangleList.get(triangleId, 1))
+           && (vertexId != triangleList.get(triangleId, 2))) {
+          link[j] = vertexId;
           break;
         }
       }
@@ -781,62 +666,36 @@ int TwoSkeleton::buildTriangleLinks(
 
 int TwoSkeleton::buildVertexTriangles(
   const SimplexId &vertexNumber,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexTriangleList) const {
+  const FlatJaggedArray &triangleList,
+  FlatJaggedArray &vertexTriangleList) const {
 
   Timer t;
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  threadNumber_ = 1;
-
-  if(threadNumber_ != 1) {
-    vector<vector<vector<SimplexId>>> threadedLists(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedLists[i].resize(vertexNumber);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        threadedLists[threadId][triangleList[i][j]].push_back(i);
-      }
+  // NOTE: two sequential passes (count, then fill), the per-thread version
+  // was not efficient.
+  vertexTriangleList.resize(vertexNumber);
+  for(SimplexId i = 0; i < triangleList.size(); i++) {
+    for(SimplexId j = 0; j < triangleList.size(i); j++) {
+      vertexTriangleList.incrementRowSize(triangleList.get(i, j));
     }
+  }
+  vertexTriangleList.prefixSum();
 
-    // merge back
-    vertexTriangleList.resize(vertexNumber, vector<SimplexId>());
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < vertexNumber; j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedLists[i][j].size(); k++) {
-          vertexTriangleList[j].push_back(threadedLists[i][j][k]);
-        }
-      }
-    }
-  } else {
-    vertexTriangleList.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        vertexTriangleList[triangleList[i][j]].push_back(i);
-      }
+  vector<SimplexId> fillCount(vertexNumber, 0);
+  for(SimplexId i = 0; i < triangleList.size(); i++) {
+    for(SimplexId j = 0; j < triangleList.size(i); j++) {
+      const SimplexId vertexId = triangleList.get(i, j);
+      vertexTriangleList.rowData(vertexId)[fillCount[vertexId]++] = i;
     }
   }
 
   {
     stringstream msg;
     msg << "[TwoSkeleton] Vertex triangle list (" << vertexNumber
-        << " vertices) computed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << endl;
+        << " vertices) computed in " << t.getElapsedTime() << " s. (1"
+        << " thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   return 0;
 }
@@ -57,8 +57,8 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *vertexStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the list of triangles connected to each edge for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -150,13 +150,13 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &edgeTriangleList,
-      std::vector<std::vector<SimplexId>> *vertexStarList = NULL,
+      FlatJaggedArray &edgeTriangleList,
+      FlatJaggedArray *vertexStarList = NULL,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL,
-      std::vector<std::vector<SimplexId>> *edgeStarList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStarList = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *edgeStarList = NULL,
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStarList = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the list of triangles of a triangulation represented by a
     /// vtkUnstructuredGrid object. Unspecified behavior if the input mesh is
@@ -177,9 +177,9 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStars = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStars = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the list of edges connected to each triangle for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -261,12 +261,12 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &triangleEdgeList,
-      std::vector<std::vector<SimplexId>> *vertexEdgeList = NULL,
+      FlatJaggedArray &triangleEdgeList,
+      FlatJaggedArray *vertexEdgeList = NULL,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStarList = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStarList = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the links of triangles in a 3D triangulation.
     /// \param triangleList Input triangle list. The number of entries of this
@@ -283,12 +283,18 @@ namespace ttk {
     /// of this list is equal to the number of triangles in the triangulation.
     /// Each entry lists the identifiers of the vertices in the link of the
     /// corresponding triangle.
+    /// \param beginId Optional first triangle to process (default: 0).
+    /// \param endId Optional triangle where to stop (excluded). By default
+    /// (-1), all the triangles are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the link of the
+    /// triangle beginId + i.
     /// \return Returns 0 upon success, negative values otherwise.
-    int buildTriangleLinks(
-      const std::vector<std::vector<SimplexId>> &triangeList,
-      const std::vector<std::vector<SimplexId>> &triangleStars,
-      const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &triangleLinks) const;
+    int buildTriangleLinks(const FlatJaggedArray &triangeList,
+                           const FlatJaggedArray &triangleStars,
+                           const LongSimplexId *cellArray,
+                           FlatJaggedArray &triangleLinks,
+                           const SimplexId &beginId = 0,
+                           const SimplexId &endId = -1) const;
 
     /// Compute the list of triangles connected to each vertex for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -300,8 +306,8 @@ namespace ttk {
     /// std::vectors of triangle identifiers).
     int buildVertexTriangles(
       const SimplexId &vertexNumber,
-      const std::vector<std::vector<SimplexId>> &triangleList,
-      std::vector<std::vector<SimplexId>> &vertexTriangleList) const;
+      const FlatJaggedArray &triangleList,
+      FlatJaggedArray &vertexTriangleList) const;
 
   protected:
   };
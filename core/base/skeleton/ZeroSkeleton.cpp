@@ -13,75 +13,35 @@ ZeroSkeleton::~ZeroSkeleton() {
 int ZeroSkeleton::buildVertexEdges(
   const SimplexId &vertexNumber,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexEdges) const {
+  FlatJaggedArray &vertexEdges) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
+  // NOTE: the compressed table is built in two sequential passes over the
+  // edge list (count, then fill). Each pass is memory bound and the previous
+  // per-thread implementation was slower than the sequential one.
   vertexEdges.resize(vertexNumber);
-  for(SimplexId i = 0; i < (SimplexId)vertexEdges.size(); i++) {
-    vertexEdges[i].clear();
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+    vertexEdges.incrementRowSize(edgeList[i].first);
+    vertexEdges.incrementRowSize(edgeList[i].second);
   }
-
-  if(threadNumber_ == 1) {
-    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
-      vertexEdges[edgeList[i].first].push_back(i);
-      vertexEdges[edgeList[i].second].push_back(i);
-    }
-  } else {
-    vector<vector<vector<SimplexId>>> threadedVertexEdges(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedVertexEdges[i].resize(vertexNumber);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
-
-      ThreadId threadId = 0;
-
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      threadedVertexEdges[threadId][edgeList[i].first].push_back(i);
-      threadedVertexEdges[threadId][edgeList[i].second].push_back(i);
-    }
-
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < (SimplexId)threadedVertexEdges[i].size(); j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedVertexEdges[i][j].size();
-            k++) {
-
-          bool hasFound = false;
-          for(SimplexId l = 0; l < (SimplexId)vertexEdges[j].size(); l++) {
-            if(vertexEdges[j][l] == threadedVertexEdges[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound)
-            vertexEdges[j].push_back(threadedVertexEdges[i][j][k]);
-        }
-      }
-    }
+  vertexEdges.prefixSum();
+
+  vector<SimplexId> fillCount(vertexNumber, 0);
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+    const SimplexId v0 = edgeList[i].first;
+    const SimplexId v1 = edgeList[i].second;
+    vertexEdges.rowData(v0)[fillCount[v0]++] = i;
+    vertexEdges.rowData(v1)[fillCount[v1]++] = i;
   }
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex edges built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
   // 1 thread: 11.85 s
   // 24 threads: 20.93 s [not efficient]
@@ -185,7 +145,7 @@ int ZeroSkeleton::buildVertexLinks(
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
   vector<vector<LongSimplexId>> &vertexLinks,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
@@ -195,7 +155,7 @@ int ZeroSkeleton::buildVertexLinks(
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
@@ -363,10 +323,12 @@ int ZeroSkeleton::buildVertexLinks(
 }
 
 int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellEdges,
+  const FlatJaggedArray &vertexStars,
+  const FlatJaggedArray &cellEdges,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+  FlatJaggedArray &vertexLinks,
+  const SimplexId &beginId,
+  const SimplexId &endId) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -379,23 +341,34 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  const SimplexId lastId = (endId == -1) ? vertexStars.size() : endId;
+
+  // each triangle of the star contributes exactly one edge to the link
+  vertexLinks.resize(lastId - beginId);
+  for(SimplexId i = 0; i < vertexLinks.size(); i++) {
+    vertexLinks.setRowSize(i, vertexStars.size(beginId + i));
+  }
+  vertexLinks.prefixSum();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < vertexLinks.size(); i++) {
+
+    const SimplexId vertexId = beginId + i;
+    SimplexId *link = vertexLinks.rowData(i);
+    SimplexId linkSize = 0;
 
-    for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-      for(SimplexId k = 0; k < (SimplexId)cellEdges[vertexStars[i][j]].size();
-          k++) {
-        SimplexId edgeId = cellEdges[vertexStars[i][j]][k];
+    for(SimplexId j = 0; j < vertexStars.size(vertexId); j++) {
+      const SimplexId cellId = vertexStars.get(vertexId, j);
+      for(SimplexId k = 0; k < cellEdges.size(cellId); k++) {
+        SimplexId edgeId = cellEdges.get(cellId, k);
 
         SimplexId vertexId0 = edgeList[edgeId].first;
         SimplexId vertexId1 = edgeList[edgeId].second;
 
-        if((vertexId0 != i) && (vertexId1 != i)) {
-          vertexLinks[i].push_back(edgeId);
+        if((vertexId0 != vertexId) && (vertexId1 != vertexId)) {
+          link[linkSize++] = edgeId;
         }
       }
     }
@@ -411,11 +384,12 @@ int ZeroSkeleton::buildVertexLinks(
   return 0;
 }
 
-int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellTriangles,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+int ZeroSkeleton::buildVertexLinks(const FlatJaggedArray &vertexStars,
+                                   const FlatJaggedArray &cellTriangles,
+                                   const FlatJaggedArray &triangleList,
+                                   FlatJaggedArray &vertexLinks,
+                                   const SimplexId &beginId,
+                                   const SimplexId &endId) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -428,28 +402,39 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  const SimplexId lastId = (endId == -1) ? vertexStars.size() : endId;
+
+  // each tetrahedron of the star contributes exactly one triangle to the link
+  vertexLinks.resize(lastId - beginId);
+  for(SimplexId i = 0; i < vertexLinks.size(); i++) {
+    vertexLinks.setRowSize(i, vertexStars.size(beginId + i));
+  }
+  vertexLinks.prefixSum();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < vertexLinks.size(); i++) {
+
+    const SimplexId vertexId = beginId + i;
+    SimplexId *link = vertexLinks.rowData(i);
+    SimplexId linkSize = 0;
 
-    for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-      for(SimplexId k = 0;
-          k < (SimplexId)cellTriangles[vertexStars[i][j]].size(); k++) {
-        SimplexId triangleId = cellTriangles[vertexStars[i][j]][k];
+    for(SimplexId j = 0; j < vertexStars.size(vertexId); j++) {
+      const SimplexId cellId = vertexStars.get(vertexId, j);
+      for(SimplexId k = 0; k < cellTriangles.size(cellId); k++) {
+        SimplexId triangleId = cellTriangles.get(cellId, k);
 
         bool hasVertex = false;
         for(int l = 0; l < 3; l++) {
-          if(i == triangleList[triangleId][l]) {
+          if(vertexId == triangleList.get(triangleId, l)) {
             hasVertex = true;
             break;
           }
         }
 
         if(!hasVertex) {
-          vertexLinks[i].push_back(triangleId);
+          link[linkSize++] = triangleId;
         }
       }
     }
@@ -469,7 +454,7 @@ int ZeroSkeleton::buildVertexNeighbors(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &oneSkeleton,
+  FlatJaggedArray &oneSkeleton,
   vector<pair<SimplexId, SimplexId>> *edgeList) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -479,8 +464,6 @@ int ZeroSkeleton::buildVertexNeighbors(
 
   Timer t;
 
-  oneSkeleton.resize(vertexNumber);
-
   auto localEdgeList = edgeList;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
   if(!localEdgeList) {
@@ -494,11 +477,19 @@ int ZeroSkeleton::buildVertexNeighbors(
     osk.buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
+  oneSkeleton.resize(vertexNumber);
+  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
+    oneSkeleton.incrementRowSize((*localEdgeList)[i].first);
+    oneSkeleton.incrementRowSize((*localEdgeList)[i].second);
+  }
+  oneSkeleton.prefixSum();
+
+  vector<SimplexId> fillCount(vertexNumber, 0);
   for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-    oneSkeleton[(*localEdgeList)[i].first].push_back(
-      (*localEdgeList)[i].second);
-    oneSkeleton[(*localEdgeList)[i].second].push_back(
-      (*localEdgeList)[i].first);
+    const SimplexId v0 = (*localEdgeList)[i].first;
+    const SimplexId v1 = (*localEdgeList)[i].second;
+    oneSkeleton.rowData(v0)[fillCount[v0]++] = v1;
+    oneSkeleton.rowData(v1)[fillCount[v1]++] = v0;
   }
 
   {
@@ -516,116 +507,62 @@ int ZeroSkeleton::buildVertexNeighbors(
   return 0;
 }
 
-int ZeroSkeleton::buildVertexStars(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &vertexStars) const {
+int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const LongSimplexId *cellArray,
+                                   FlatJaggedArray &vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
     return -1;
 #endif
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
   Timer t;
 
-  vertexStars.resize(vertexNumber);
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    vertexStars[i].reserve(32);
-
-  vector<vector<vector<SimplexId>> *> threadedZeroSkeleton(threadNumber_);
-  if(threadNumber_ == 1) {
-    threadedZeroSkeleton[0] = &vertexStars;
-  } else {
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedZeroSkeleton[i] = new vector<vector<SimplexId>>();
-      threadedZeroSkeleton[i]->resize(vertexNumber);
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-        (*threadedZeroSkeleton[i])[j].reserve(32);
-      }
-    }
-  }
-
   SimplexId vertexNumberPerCell = cellArray[0];
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
+  // first pass: count the cells around each vertex
+  vertexStars.resize(vertexNumber);
   for(SimplexId i = 0; i < cellNumber; i++) {
-
-    ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
-#endif
-
     for(SimplexId j = 0; j < vertexNumberPerCell; j++) {
-      (*threadedZeroSkeleton[threadId])[cellArray[(vertexNumberPerCell + 1) * i
-                                                  + 1 + j]]
-        .push_back(i);
+      vertexStars.incrementRowSize(
+        cellArray[(vertexNumberPerCell + 1) * i + 1 + j]);
     }
   }
+  vertexStars.prefixSum();
 
-  if(threadNumber_ > 1) {
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // looping on vertices
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-
-        // looping on the vertex star
-        for(SimplexId k = 0;
-            k < (SimplexId)(*threadedZeroSkeleton[i])[j].size(); k++) {
-
-          bool hasFound = false;
-          if(threadNumber_) {
-            for(SimplexId l = 0; l < (SimplexId)vertexStars[j].size(); l++) {
-              if(vertexStars[j][l] == (*threadedZeroSkeleton[i])[j][k]) {
-                hasFound = true;
-                break;
-              }
-            }
-          }
-          if(!hasFound)
-            vertexStars[j].push_back((*threadedZeroSkeleton[i])[j][k]);
-        }
-      }
-    }
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      delete threadedZeroSkeleton[i];
+  // second pass: fill the stars. cells are visited by increasing identifier,
+  // hence each vertex star is sorted (ThreeSkeleton relies on this).
+  vector<SimplexId> fillCount(vertexNumber, 0);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(SimplexId j = 0; j < vertexNumberPerCell; j++) {
+      const SimplexId vertexId
+        = cellArray[(vertexNumberPerCell + 1) * i + 1 + j];
+      vertexStars.rowData(vertexId)[fillCount[vertexId]++] = i;
     }
   }
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex stars built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
   if(debugLevel_ >= Debug::advancedInfoMsg) {
     stringstream msg;
 
-    for(SimplexId i = 0; i < (SimplexId)vertexStars.size(); i++) {
-      msg << "[ZeroSkeleton] Vertex #" << i << " (" << vertexStars[i].size()
+    for(SimplexId i = 0; i < vertexStars.size(); i++) {
+      msg << "[ZeroSkeleton] Vertex #" << i << " (" << vertexStars.size(i)
           << " cell(s)): ";
-      for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-        msg << " " << vertexStars[i][j];
+      for(SimplexId j = 0; j < vertexStars.size(i); j++) {
+        msg << " " << vertexStars.get(i, j);
       }
       msg << endl;
     }
     dMsg(cout, msg.str(), Debug::advancedInfoMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiol.vtu, 8.7Mtets, hal9000 (12coresHT)
   // 1 thread: 0.53 s
   // 24 threads: 7.99 s
@@ -16,6 +16,7 @@
 #include <map>
 
 // base code includes
+#include <FlatJaggedArray.h>
 #include <Wrapper.h>
 
 namespace ttk {
@@ -31,15 +32,14 @@ namespace ttk {
     /// \param vertexNumber Number of vertices in the triangulation.
     /// \param edgeList List of edges. Each entry is represented by the
     /// ordered std::pair of identifiers of the entry's edge's vertices.
-    /// \param vertexEdges Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be a std::vector listing the identifiers of the edges connected to the
-    /// entry's vertex.
+    /// \param vertexEdges Output vertex edges. The number of rows of this
+    /// table will be equal to the number of vertices in the mesh. Each row
+    /// lists the identifiers of the edges connected to the row's vertex.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexEdges(
       const SimplexId &vertexNumber,
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      std::vector<std::vector<SimplexId>> &vertexEdges) const;
+      FlatJaggedArray &vertexEdges) const;
 
     /// Compute the link of a single vertex of a triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
@@ -78,61 +78,67 @@ namespace ttk {
     /// \param vertexStars Optional list of vertex stars (list of
     /// 3-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector
-    /// as internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// to a non-empty table, this function will use this table as internal
+    /// vertex star list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexLinks(const SimplexId &vertexNumber,
                          const SimplexId &cellNumber,
                          const LongSimplexId *cellArray,
                          std::vector<std::vector<LongSimplexId>> &vertexLinks,
-                         std::vector<std::vector<SimplexId>> *vertexStars
-                         = NULL) const;
+                         FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the link of each vertex of a 2D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
-    /// \param vertexStars List of vertex stars. The size of this std::vector
-    /// should be equal to the number of vertices in the triangulation. Each
-    /// entry is a std::vector listing the identifiers of triangles.
-    /// \param cellEdges List of cell edges. The size of this std::vector
-    /// should be
-    /// equal to the number of triangles. Each entry is a std::vector of
+    /// \param vertexStars List of vertex stars. The number of rows of this
+    /// table should be equal to the number of vertices in the triangulation.
+    /// Each row lists the identifiers of triangles.
+    /// \param cellEdges List of cell edges. The number of rows of this table
+    /// should be equal to the number of triangles. Each row lists
     /// identifiers of edges.
-    /// \param vertexLinks Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the triangulation. Each
-    /// entry will be a std::vector listing the edges in the link of the
-    /// corresponding vertex.
+    /// \param vertexLinks Output vertex links. The number of rows of this
+    /// table will be equal to the number of vertices in the triangulation.
+    /// Each row lists the edges in the link of the corresponding vertex.
+    /// \param beginId Optional first vertex to process (default: 0).
+    /// \param endId Optional vertex where to stop (excluded). By default (-1),
+    /// all the vertexs are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the link of the
+    /// vertex beginId + i.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexLinks(
-      const std::vector<std::vector<SimplexId>> &vertexStars,
-      const std::vector<std::vector<SimplexId>> &cellEdges,
+      const FlatJaggedArray &vertexStars,
+      const FlatJaggedArray &cellEdges,
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      std::vector<std::vector<SimplexId>> &vertexLinks) const;
+      FlatJaggedArray &vertexLinks,
+      const SimplexId &beginId = 0,
+      const SimplexId &endId = -1) const;
 
     /// Compute the link of each vertex of a 3D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
-    /// \param vertexStars List of vertex stars. The size of this std::vector
-    /// should be equal to the number of vertices in the triangulation. Each
-    /// entry is a std::vector listing the identifiers of tetrahedra.
-    /// \param cellTriangles List of cell triangles. The size of this
-    /// std::vector
-    /// should be equal to the number of tetrahedra. Each entry is a
-    /// std::vector
-    /// of identifiers of triangles.
-    /// \param vertexLinks Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the triangulation. Each
-    /// entry will be a std::vector listing the triangles in the link of the
-    /// corresponding vertex.
+    /// \param vertexStars List of vertex stars. The number of rows of this
+    /// table should be equal to the number of vertices in the triangulation.
+    /// Each row lists the identifiers of tetrahedra.
+    /// \param cellTriangles List of cell triangles. The number of rows of
+    /// this table should be equal to the number of tetrahedra. Each row lists
+    /// identifiers of triangles.
+    /// \param vertexLinks Output vertex links. The number of rows of this
+    /// table will be equal to the number of vertices in the triangulation.
+    /// Each row lists the triangles in the link of the corresponding vertex.
+    /// \param beginId Optional first vertex to process (default: 0).
+    /// \param endId Optional vertex where to stop (excluded). By default (-1),
+    /// all the vertexs are processed. Otherwise the output only has
+    /// endId - beginId rows, the i-th row being the link of the
+    /// vertex beginId + i.
     /// \return Returns 0 upon success, negative values otherwise.
-    int
-      buildVertexLinks(const std::vector<std::vector<SimplexId>> &vertexStars,
-                       const std::vector<std::vector<SimplexId>> &cellTriangles,
-                       const std::vector<std::vector<SimplexId>> &triangleList,
-                       std::vector<std::vector<SimplexId>> &vertexLinks) const;
+    int buildVertexLinks(const FlatJaggedArray &vertexStars,
+                         const FlatJaggedArray &cellTriangles,
+                         const FlatJaggedArray &triangleList,
+                         FlatJaggedArray &vertexLinks,
+                         const SimplexId &beginId = 0,
+                         const SimplexId &endId = -1) const;
 
     /// Compute the list of neighbors of each vertex of a triangulation.
     /// Unspecified behavior if the input mesh is not a valid triangulation).
@@ -142,11 +148,9 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param vertexNeighbors Output neighbor list. The size of this
-    /// std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be std::vector listing the vertex identifiers of the entry's vertex'
-    /// neighbors.
+    /// \param vertexNeighbors Output neighbor list. The number of rows of
+    /// this table will be equal to the number of vertices in the mesh. Each
+    /// row lists the vertex identifiers of the row's vertex' neighbors.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -163,7 +167,7 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &vertexNeighbors,
+      FlatJaggedArray &vertexNeighbors,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL) const;
 
     /// Compute the star of each vertex of a triangulation. Unspecified
@@ -174,17 +178,16 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param vertexStars Output vertex stars. The size of this std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be a std::vector listing the identifiers of the maximum-dimensional
-    /// cells
-    /// (3D: tetrahedra, 2D: triangles, etc.) connected to the entry's vertex.
+    /// \param vertexStars Output vertex stars. The number of rows of this
+    /// table will be equal to the number of vertices in the mesh. Each row
+    /// lists (by increasing order) the identifiers of the maximum-dimensional
+    /// cells (3D: tetrahedra, 2D: triangles, etc.) connected to the row's
+    /// vertex.
     /// \return Returns 0 upon success, negative values otherwise.
-    int
-      buildVertexStars(const SimplexId &vertexNumber,
-                       const SimplexId &cellNumber,
-                       const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &vertexStars) const;
+    int buildVertexStars(const SimplexId &vertexNumber,
+                         const SimplexId &cellNumber,
+                         const LongSimplexId *cellArray,
+                         FlatJaggedArray &vertexStars) const;
 
   protected:
   };
@@ -0,0 +1,483 @@
+#include <TaskRuntime.h>
+
+#include <chrono>
+#include <deque>
+#include <random>
+#include <thread>
+
+using namespace std;
+using namespace ttk;
+
+namespace {
+
+  // nesting depth of the tasks executed by the calling thread: only the
+  // outermost task is timed, nested tasks are part of its busy time
+  thread_local int taskDepth_ = 0;
+
+  class SequentialTaskRuntime : public TaskRuntime {
+
+  public:
+    Type getType() const override {
+      return Type::SEQUENTIAL;
+    }
+
+    int run(const function<void()> &root, const ThreadId &) override {
+      Timer t;
+      initializeStatistics(1);
+      execute(root, 0);
+      runTime_ += t.getElapsedTime();
+      return 0;
+    }
+
+  protected:
+    // the tasks are deferred until a wait, then executed last in first out,
+    // as by a single work-stealing worker
+    void spawn(TaskGroup &group,
+               function<void()> &&task,
+               const int &) override {
+      pendingTasks(group)++;
+      queue_.emplace_back(std::move(task), &group);
+    }
+
+    void wait(TaskGroup &group) override {
+      while(pendingTasks(group) && !queue_.empty()) {
+        function<void()> task(std::move(queue_.back().first));
+        TaskGroup *taskGroup = queue_.back().second;
+        queue_.pop_back();
+        execute(task, 0);
+        pendingTasks(*taskGroup)--;
+      }
+    }
+
+    deque<pair<function<void()>, TaskGroup *>> queue_;
+  };
+
+#ifdef TTK_ENABLE_OPENMP
+  class OpenMPTaskRuntime : public TaskRuntime {
+
+  public:
+    Type getType() const override {
+      return Type::OPENMP;
+    }
+
+    int run(const function<void()> &root,
+            const ThreadId &threadNumber) override {
+
+      if(omp_in_parallel()) {
+        // already in a parallel region (nested run)
+        execute(root, omp_get_thread_num());
+        return 0;
+      }
+
+      Timer t;
+      initializeStatistics(threadNumber);
+#pragma omp parallel num_threads(threadNumber)
+      {
+#pragma omp single nowait
+        execute(root, omp_get_thread_num());
+      }
+      runTime_ += t.getElapsedTime();
+
+      return 0;
+    }
+
+    void yield() override {
+#pragma omp taskyield
+    }
+
+  protected:
+    void spawn(TaskGroup &,
+               function<void()> &&task,
+               const int &priority) override {
+      // the task is a child of the calling task, as if the pragma was in
+      // the caller
+      function<void()> localTask(std::move(task));
+#ifdef TTK_ENABLE_OMP_PRIORITY
+#pragma omp task untied firstprivate(localTask) priority(priority)
+#else
+      (void)priority;
+#pragma omp task untied firstprivate(localTask)
+#endif
+      execute(localTask, omp_get_thread_num());
+    }
+
+    void wait(TaskGroup &) override {
+#pragma omp taskwait
+    }
+  };
+#endif
+
+  class WorkStealingTaskRuntime : public TaskRuntime {
+
+  public:
+    ~WorkStealingTaskRuntime() {
+    }
+
+    Type getType() const override {
+      return Type::WORK_STEALING;
+    }
+
+    int run(const function<void()> &root,
+            const ThreadId &threadNumber) override;
+
+  protected:
+    struct Task {
+      function<void()> work;
+      TaskGroup *group;
+    };
+
+    /// Lock-free Chase-Lev deque (with the C11 memory orderings of Le et al.,
+    /// "Correct and Efficient Work-Stealing for Weak Memory Models", 2013).
+    /// Only the owner pushes and pops, at the bottom; thieves steal at the
+    /// top.
+    class Deque {
+
+    public:
+      Deque() : top_(0), bottom_(0) {
+        arrays_.emplace_back(new Array(256));
+        array_.store(arrays_.back().get(), memory_order_relaxed);
+      }
+
+      void push(Task *task) {
+        const int64_t b = bottom_.load(memory_order_relaxed);
+        const int64_t t = top_.load(memory_order_acquire);
+        Array *a = array_.load(memory_order_relaxed);
+        if(b - t > a->capacity - 1) {
+          // full: the previous arrays are kept alive until the end of run(),
+          // concurrent thieves may still read them
+          Array *grown = new Array(2 * a->capacity);
+          for(int64_t i = t; i < b; i++)
+            grown->put(i, a->get(i));
+          arrays_.emplace_back(grown);
+          a = grown;
+          array_.store(a, memory_order_release);
+        }
+        a->put(b, task);
+        atomic_thread_fence(memory_order_release);
+        bottom_.store(b + 1, memory_order_relaxed);
+      }
+
+      Task *pop() {
+        const int64_t b = bottom_.load(memory_order_relaxed) - 1;
+        Array *a = array_.load(memory_order_relaxed);
+        bottom_.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t t = top_.load(memory_order_relaxed);
+        Task *task = nullptr;
+        if(t <= b) {
+          task = a->get(b);
+          if(t == b) {
+            // last task: race against the thieves
+            if(!top_.compare_exchange_strong(
+                 t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+              task = nullptr;
+            bottom_.store(b + 1, memory_order_relaxed);
+          }
+        } else {
+          bottom_.store(b + 1, memory_order_relaxed);
+        }
+        return task;
+      }
+
+      Task *steal() {
+        int64_t t = top_.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        const int64_t b = bottom_.load(memory_order_acquire);
+        if(t < b) {
+          Array *a = array_.load(memory_order_acquire);
+          Task *task = a->get(t);
+          if(!top_.compare_exchange_strong(
+               t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+            return nullptr;
+          return task;
+        }
+        return nullptr;
+      }
+
+    protected:
+      struct Array {
+        explicit Array(const int64_t &size)
+          : capacity(size), items(new atomic<Task *>[size]) {
+        }
+
+        inline Task *get(const int64_t &i) const {
+          return items[i & (capacity - 1)].load(memory_order_relaxed);
+        }
+
+        inline void put(const int64_t &i, Task *task) {
+          items[i & (capacity - 1)].store(task, memory_order_relaxed);
+        }
+
+        // power of two
+        const int64_t capacity;
+        unique_ptr<atomic<Task *>[]> items;
+      };
+
+      atomic<int64_t> top_;
+      atomic<int64_t> bottom_;
+      atomic<Array *> array_;
+      // owned by the worker
+      vector<unique_ptr<Array>> arrays_;
+    };
+
+    struct Worker {
+      WorkStealingTaskRuntime *runtime;
+      ThreadId id;
+      Deque deque;
+      minstd_rand random;
+    };
+
+    void spawn(TaskGroup &group,
+               function<void()> &&task,
+               const int &priority) override;
+
+    void wait(TaskGroup &group) override;
+
+    /// Worker of this runtime running on the calling thread, if any.
+    Worker *getCurrentWorker() const {
+      return (currentWorker_ && currentWorker_->runtime == this)
+               ? currentWorker_
+               : nullptr;
+    }
+
+    /// Pop a task from the deque of \p worker, or steal one.
+    Task *findTask(Worker &worker, bool &stolen);
+
+    void runTask(Task *task, Worker &worker, const bool &stolen);
+
+    void workerLoop(Worker &worker);
+
+    vector<unique_ptr<Worker>> workers_;
+    atomic<bool> done_;
+
+    static thread_local Worker *currentWorker_;
+  };
+
+  thread_local WorkStealingTaskRuntime::Worker
+    *WorkStealingTaskRuntime::currentWorker_
+    = nullptr;
+
+  int WorkStealingTaskRuntime::run(const function<void()> &root,
+                                   const ThreadId &threadNumber) {
+
+    Worker *current = getCurrentWorker();
+    if(current) {
+      // nested run
+      execute(root, current->id);
+      return 0;
+    }
+
+    Timer t;
+
+    const ThreadId workerNumber = max(threadNumber, (ThreadId)1);
+    initializeStatistics(workerNumber);
+
+    workers_.clear();
+    for(ThreadId i = 0; i < workerNumber; i++) {
+      workers_.emplace_back(new Worker());
+      workers_[i]->runtime = this;
+      workers_[i]->id = i;
+      workers_[i]->random.seed(i + 1);
+    }
+    done_ = false;
+
+    vector<thread> threads;
+    for(ThreadId i = 1; i < workerNumber; i++)
+      threads.emplace_back(&WorkStealingTaskRuntime::workerLoop, this,
+                           std::ref(*workers_[i]));
+
+    // the calling thread is the worker 0
+    Worker *previous = currentWorker_;
+    currentWorker_ = workers_[0].get();
+    execute(root, 0);
+    currentWorker_ = previous;
+
+    done_.store(true, memory_order_release);
+    for(auto &thread : threads)
+      thread.join();
+    workers_.clear();
+
+    runTime_ += t.getElapsedTime();
+
+    return 0;
+  }
+
+  void WorkStealingTaskRuntime::workerLoop(Worker &worker) {
+
+    currentWorker_ = &worker;
+
+    int idleRounds = 0;
+    while(!done_.load(memory_order_acquire)) {
+      bool stolen = false;
+      Task *task = findTask(worker, stolen);
+      if(task) {
+        runTask(task, worker, stolen);
+        idleRounds = 0;
+      } else if(++idleRounds > 4096) {
+        // long idle phase (for instance a sequential part of the root)
+        this_thread::sleep_for(chrono::microseconds(50));
+      } else if(idleRounds > 64) {
+        this_thread::yield();
+      }
+    }
+
+    currentWorker_ = nullptr;
+  }
+
+  WorkStealingTaskRuntime::Task *
+    WorkStealingTaskRuntime::findTask(Worker &worker, bool &stolen) {
+
+    Task *task = worker.deque.pop();
+    if(task)
+      return task;
+
+    const ThreadId workerNumber = workers_.size();
+    if(workerNumber < 2)
+      return nullptr;
+
+    // one round of random victims
+    for(ThreadId i = 0; i < workerNumber; i++) {
+      ThreadId victim = worker.random() % (workerNumber - 1);
+      if(victim >= worker.id)
+        victim++;
+      task = workers_[victim]->deque.steal();
+      if(task) {
+        stolen = true;
+        return task;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void WorkStealingTaskRuntime::runTask(Task *task,
+                                        Worker &worker,
+                                        const bool &stolen) {
+
+    execute(task->work, worker.id, stolen);
+
+    TaskGroup *group = task->group;
+    delete task;
+    // last access to the group: it may be destroyed right after
+    pendingTasks(*group).fetch_sub(1, memory_order_release);
+  }
+
+  void WorkStealingTaskRuntime::spawn(TaskGroup &group,
+                                      function<void()> &&task,
+                                      const int &) {
+
+    Worker *worker = getCurrentWorker();
+    if(!worker) {
+      // not in run(): executed immediately
+      execute(task, 0);
+      return;
+    }
+
+    pendingTasks(group).fetch_add(1, memory_order_relaxed);
+    worker->deque.push(new Task{std::move(task), &group});
+  }
+
+  void WorkStealingTaskRuntime::wait(TaskGroup &group) {
+
+    Worker *worker = getCurrentWorker();
+    if(!worker)
+      return;
+
+    // help instead of blocking
+    while(pendingTasks(group).load(memory_order_acquire)) {
+      bool stolen = false;
+      Task *task = findTask(*worker, stolen);
+      if(task)
+        runTask(task, *worker, stolen);
+      else
+        this_thread::yield();
+    }
+  }
+} // namespace
+
+TaskRuntime::TaskRuntime() {
+  runTime_ = 0;
+}
+
+TaskRuntime::~TaskRuntime() {
+}
+
+shared_ptr<TaskRuntime> TaskRuntime::create(const Type &type) {
+
+  if(type == Type::WORK_STEALING)
+    return make_shared<WorkStealingTaskRuntime>();
+#ifdef TTK_ENABLE_OPENMP
+  if(type == Type::OPENMP)
+    return make_shared<OpenMPTaskRuntime>();
+#endif
+  return make_shared<SequentialTaskRuntime>();
+}
+
+TaskRuntime::Type TaskRuntime::getDefaultType() {
+#ifdef TTK_ENABLE_OPENMP
+  return Type::OPENMP;
+#else
+  return Type::SEQUENTIAL;
+#endif
+}
+
+void TaskRuntime::execute(const function<void()> &task,
+                          const ThreadId &workerId,
+                          const bool &stolen) {
+
+  WorkerStatistics *statistics = nullptr;
+  if(workerId < (ThreadId)statistics_.size())
+    statistics = &statistics_[workerId];
+
+  if(taskDepth_++ || !statistics) {
+    task();
+  } else {
+    Timer t;
+    task();
+    statistics->busyTime += t.getElapsedTime();
+  }
+  taskDepth_--;
+
+  if(statistics) {
+    statistics->executedTasks++;
+    if(stolen)
+      statistics->stolenTasks++;
+  }
+}
+
+void TaskRuntime::initializeStatistics(const ThreadId &workerNumber) {
+  if((ThreadId)statistics_.size() < workerNumber)
+    statistics_.resize(workerNumber);
+}
+
+int TaskRuntime::resetStatistics() {
+  statistics_.clear();
+  runTime_ = 0;
+  return 0;
+}
+
+int TaskRuntime::printStatistics(const int &debugLevel) const {
+
+  if(debugLevel_ < debugLevel)
+    return 0;
+
+  const char *typeName = "sequential";
+  if(getType() == Type::OPENMP)
+    typeName = "OpenMP";
+  else if(getType() == Type::WORK_STEALING)
+    typeName = "work-stealing";
+
+  stringstream msg;
+  msg << "[TaskRuntime] " << typeName << " runtime, " << statistics_.size()
+      << " worker(s), " << runTime_ << " s. in run()." << endl;
+  for(size_t i = 0; i < statistics_.size(); i++) {
+    const WorkerStatistics &s = statistics_[i];
+    msg << "[TaskRuntime]   Worker #" << i << ": "
+        << (runTime_ > 0 ? 100 * s.busyTime / runTime_ : 0) << "% busy, "
+        << s.executedTasks << " task(s) (" << s.stolenTasks << " stolen)."
+        << endl;
+  }
+  dMsg(cout, msg.str(), debugLevel);
+
+  return 0;
+}
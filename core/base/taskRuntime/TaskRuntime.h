@@ -0,0 +1,183 @@
+/// \ingroup base
+/// \class ttk::TaskRuntime
+/// \date October 2019.
+///
+/// \brief Pluggable runtime for the task-parallel modules.
+///
+/// Task-parallel algorithms (see ttk::ftm::FTMTree_MT) are written against
+/// this interface instead of OpenMP task pragmas: run() executes a root
+/// function on a pool of workers, and the root (or any task) spawns child
+/// tasks in a ttk::TaskGroup and waits for them.
+///
+/// Three implementations are available through create():
+///   - SEQUENTIAL: the tasks are executed by the calling thread when they
+///   are waited for, most recent first;
+///   - OPENMP: the tasks are OpenMP tasks (untied, with priorities if
+///   TTK_ENABLE_OMP_PRIORITY is defined), as in the original implementations;
+///   - WORK_STEALING: a pool of std::thread workers, each owning a lock-free
+///   Chase-Lev deque. A worker pushes and pops its own tasks at the bottom of
+///   its deque (depth-first) and, when it runs out of work, steals the oldest
+///   task of a randomly chosen worker. Waiting on a group executes pending
+///   tasks instead of blocking. This backend does not require an OpenMP task
+///   runtime and ignores the task priorities.
+///
+/// Each runtime reports, per worker, the time spent executing tasks, the
+/// number of executed and stolen tasks, and the resulting utilization
+/// (busy time over the wall time spent in run()).
+///
+/// \sa ttk::TaskGroup
+/// \sa ttk::ftm::FTMTree
+
+#ifndef _TASKRUNTIME_H
+#define _TASKRUNTIME_H
+
+#ifdef TTK_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+// base code includes
+#include <Wrapper.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  class TaskRuntime;
+
+  /// \brief Set of tasks spawned on a ttk::TaskRuntime, which can be waited
+  /// for. The destructor waits for the pending tasks.
+  class TaskGroup {
+
+  public:
+    TaskGroup(TaskRuntime *runtime) : runtime_(runtime), pendingTasks_(0) {
+    }
+
+    TaskGroup(const std::shared_ptr<TaskRuntime> &runtime)
+      : TaskGroup(runtime.get()) {
+    }
+
+    TaskGroup(const TaskGroup &) = delete;
+
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    inline ~TaskGroup();
+
+    /// Spawn \p task in this group. Tasks with a higher \p priority are
+    /// scheduled first, when the runtime supports priorities.
+    template <class taskType>
+    inline void spawn(taskType &&task, const int &priority = 0);
+
+    /// Wait for all the tasks of this group (the calling worker executes
+    /// pending tasks in the meantime).
+    inline void wait();
+
+  protected:
+    friend class TaskRuntime;
+
+    TaskRuntime *runtime_;
+    // tasks spawned and not finished yet (unused by the OpenMP runtime)
+    std::atomic<size_t> pendingTasks_;
+  };
+
+  class TaskRuntime : virtual public Debug {
+
+  public:
+    enum class Type { SEQUENTIAL, OPENMP, WORK_STEALING };
+
+    struct WorkerStatistics {
+      /// Time spent executing tasks (in seconds).
+      double busyTime{0};
+      size_t executedTasks{0};
+      /// Tasks taken from the deque of another worker.
+      size_t stolenTasks{0};
+      // avoid false sharing between the workers
+      char padding[40];
+    };
+
+    /// Create a runtime of the given type (OPENMP falls back to SEQUENTIAL
+    /// when TTK is built without OpenMP).
+    static std::shared_ptr<TaskRuntime> create(const Type &type);
+
+    /// OPENMP when TTK is built with OpenMP, SEQUENTIAL otherwise.
+    static Type getDefaultType();
+
+    virtual ~TaskRuntime();
+
+    virtual Type getType() const = 0;
+
+    /// Execute \p root with \p threadNumber workers and return when it is
+    /// done (its tasks should be waited for by \p root). When called from a
+    /// task of this runtime, \p root is executed by the calling worker.
+    virtual int run(const std::function<void()> &root,
+                    const ThreadId &threadNumber)
+      = 0;
+
+    /// Hint that the calling task can let other tasks progress.
+    virtual void yield() {
+    }
+
+    /// Statistics accumulated since the last call to resetStatistics().
+    inline const std::vector<WorkerStatistics> &getWorkerStatistics() const {
+      return statistics_;
+    }
+
+    /// Wall time spent in run() since the last call to resetStatistics().
+    inline double getRunTime() const {
+      return runTime_;
+    }
+
+    int resetStatistics();
+
+    /// Print the utilization of each worker.
+    int printStatistics(const int &debugLevel = infoMsg) const;
+
+  protected:
+    friend class TaskGroup;
+
+    TaskRuntime();
+
+    virtual void spawn(TaskGroup &group,
+                       std::function<void()> &&task,
+                       const int &priority)
+      = 0;
+
+    virtual void wait(TaskGroup &group) = 0;
+
+    static inline std::atomic<size_t> &pendingTasks(TaskGroup &group) {
+      return group.pendingTasks_;
+    }
+
+    /// Execute \p task on behalf of the worker \p workerId and account for
+    /// it in the statistics.
+    void execute(const std::function<void()> &task,
+                 const ThreadId &workerId,
+                 const bool &stolen = false);
+
+    /// Make room for the statistics of \p workerNumber workers.
+    void initializeStatistics(const ThreadId &workerNumber);
+
+    std::vector<WorkerStatistics> statistics_;
+    double runTime_;
+  };
+} // namespace ttk
+
+inline ttk::TaskGroup::~TaskGroup() {
+  wait();
+}
+
+template <class taskType>
+inline void ttk::TaskGroup::spawn(taskType &&task, const int &priority) {
+  runtime_->spawn(
+    *this, std::function<void()>(std::forward<taskType>(task)), priority);
+}
+
+inline void ttk::TaskGroup::wait() {
+  runtime_->wait(*this);
+}
+
+#endif // _TASKRUNTIME_H
@@ -8,7 +8,7 @@ TopologicalSimplification::TopologicalSimplification()
     inputScalarFieldPointer_{}, vertexIdentifierScalarFieldPointer_{},
     inputOffsetScalarFieldPointer_{}, considerIdentifierAsBlackList_{},
     addPerturbation_{}, outputScalarFieldPointer_{},
-    outputOffsetScalarFieldPointer_{} {
+    outputOffsetScalarFieldPointer_{}, outputModificationTime_{} {
   considerIdentifierAsBlackList_ = false;
   addPerturbation_ = false;
 }
@@ -28,6 +28,7 @@
 #include <Wrapper.h>
 
 #include <Triangulation.h>
+#include <VertexOrder.h>
 #include <cmath>
 #include <set>
 #include <tuple>
@@ -104,8 +105,14 @@ namespace ttk {
                           std::vector<SimplexId> &maxList,
                           std::vector<bool> &blackList) const;
 
+    /// Perturb \p scalars so that they strictly increase along the
+    /// (value, offset) order. If \p modificationTime is non-zero and the
+    /// perturbation succeeds, the order is cached for the perturbed field
+    /// (see ttk::VertexOrder::cacheOrder()).
     template <typename dataType>
-    int addPerturbation(dataType *scalars, SimplexId *offsets) const;
+    int addPerturbation(dataType *scalars,
+                        SimplexId *offsets,
+                        const unsigned long long &modificationTime = 0) const;
 
     template <typename dataType, typename idType>
     int execute() const;
@@ -164,6 +171,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the modification time of the output scalar and offset fields,
+    /// under which the order of the perturbed field is cached.
+    inline int
+      setOutputModificationTime(const unsigned long long &modificationTime) {
+      outputModificationTime_ = modificationTime;
+      return 0;
+    }
+
   protected:
     Triangulation *triangulation_;
     SimplexId vertexNumber_;
@@ -175,6 +190,7 @@ namespace ttk {
     bool addPerturbation_;
     void *outputScalarFieldPointer_;
     void *outputOffsetScalarFieldPointer_;
+    unsigned long long outputModificationTime_;
   };
 } // namespace ttk
 
@@ -277,8 +293,10 @@ int ttk::TopologicalSimplification::getCriticalPoints(
 }
 
 template <typename dataType>
-int ttk::TopologicalSimplification::addPerturbation(dataType *scalars,
-                                                    SimplexId *offsets) const {
+int ttk::TopologicalSimplification::addPerturbation(
+  dataType *scalars,
+  SimplexId *offsets,
+  const unsigned long long &modificationTime) const {
   dataType epsilon{};
 
   if(std::is_same<dataType, double>::value)
@@ -288,24 +306,33 @@ int ttk::TopologicalSimplification::addPerturbation(dataType *scalars,
   else
     return -1;
 
-  std::vector<std::tuple<dataType, SimplexId, SimplexId>> perturbation(
-    vertexNumber_);
-  for(SimplexId i = 0; i < vertexNumber_; ++i) {
-    std::get<0>(perturbation[i]) = scalars[i];
-    std::get<1>(perturbation[i]) = offsets[i];
-    std::get<2>(perturbation[i]) = i;
+  // vertices by increasing (value, offset)
+  VertexOrder vertexOrder;
+  vertexOrder.setDebugLevel(debugLevel_);
+  vertexOrder.setThreadNumber(threadNumber_);
+  vertexOrder.setVertexNumber(vertexNumber_);
+  vertexOrder.setInputScalarField(scalars);
+  vertexOrder.setInputOffsets(offsets);
+  vertexOrder.execute<dataType>();
+  const std::vector<SimplexId> &sortedVertices
+    = vertexOrder.getOrder()->sortedVertices;
+
+  bool isStrict = true;
+  for(SimplexId i = 1; i < vertexNumber_; ++i) {
+    const SimplexId vertex = sortedVertices[i];
+    const SimplexId previous = sortedVertices[i - 1];
+    if(scalars[vertex] <= scalars[previous])
+      scalars[vertex] = scalars[previous] + epsilon;
+    // epsilon can be absorbed by large values
+    if(scalars[vertex] <= scalars[previous])
+      isStrict = false;
   }
 
-  SweepCmp cmp(true);
-  sort(perturbation.begin(), perturbation.end(), cmp);
-
-  for(SimplexId i = 0; i < vertexNumber_; ++i) {
-    if(i) {
-      if(std::get<0>(perturbation[i]) <= std::get<0>(perturbation[i - 1]))
-        std::get<0>(perturbation[i])
-          = std::get<0>(perturbation[i - 1]) + epsilon;
-    }
-    scalars[std::get<2>(perturbation[i])] = std::get<0>(perturbation[i]);
+  // the values now follow the order on their own: it remains valid for the
+  // perturbed field, which the next modules do not need to sort again
+  if(isStrict && modificationTime) {
+    vertexOrder.setModificationTime(modificationTime);
+    vertexOrder.cacheOrder<dataType>();
   }
 
   return 0;
@@ -484,8 +511,11 @@ int ttk::TopologicalSimplification::execute() const {
     }
 
     // optional adding of perturbation
-    if(addPerturbation_)
-      addPerturbation<dataType>(scalars, offsets);
+    if(addPerturbation_) {
+      // only the final field is seen by the next modules
+      addPerturbation<dataType>(
+        scalars, offsets, needForMoreIterations ? 0 : outputModificationTime_);
+    }
 
     ++iteration;
     if(!needForMoreIterations)
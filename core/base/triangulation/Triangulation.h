@@ -48,6 +48,9 @@ namespace ttk {
   class Triangulation final : public AbstractTriangulation {
 
   public:
+    /// Type of the implementation answering the queries (see getType()).
+    enum class Type { EXPLICIT, IMPLICIT, PERIODIC };
+
     Triangulation();
     Triangulation(const Triangulation &);
     Triangulation(Triangulation &&);
@@ -77,6 +80,18 @@ namespace ttk {
       return 0;
     }
 
+    /// Fill \p report with the memory footprint of each relation of the
+    /// data-structure (see ttk::MemoryReport).
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int getMemoryReport(MemoryReport &report) const override {
+
+      if(abstractTriangulation_) {
+        return abstractTriangulation_->getMemoryReport(report);
+      }
+
+      return 0;
+    }
+
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
     ///
     /// Here the notion of cell refers to the simplicices of maximal
@@ -567,6 +582,22 @@ namespace ttk {
       return abstractTriangulation_->getDimensionality();
     }
 
+    /// Get the number of vertices along each axis, if the object is the
+    /// implicit triangulation of a (non-periodic) regular grid. The vertex
+    /// identifiers then follow the row-major order of the grid.
+    /// \param dimensions Array filled with the dimensions of the grid
+    /// (first: x, second: y, third: z).
+    /// \return Returns 0 upon success, negative values otherwise (for
+    /// instance, if the object is not representing a regular grid).
+    inline int
+      getRegularGridDimensions(SimplexId dimensions[3]) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      return abstractTriangulation_->getRegularGridDimensions(dimensions);
+    }
+
     /// \warning
     /// YOU SHOULD NOT CALL THIS FUNCTION UNLESS YOU REALLY KNOW WHAT YOU ARE
     /// DOING.
@@ -2447,6 +2478,149 @@ namespace ttk {
       return !abstractTriangulation_;
     }
 
+    /// Get the implementation answering the queries (explicit, implicit or
+    /// periodic implicit triangulation), to be cast to the class matching
+    /// getType(). Calling the traversal functions directly on this class
+    /// avoids the virtual calls of the Triangulation interface (see
+    /// ttkTemplateMacro()).
+    /// \warning Unlike Triangulation, the implementations do not check that
+    /// the queries have been pre-processed.
+    /// \return Returns a pointer to the implementation, NULL if the
+    /// triangulation is empty.
+    inline AbstractTriangulation *getData() {
+      return abstractTriangulation_;
+    }
+
+    /// Get the type of the implementation answering the queries.
+    /// \return Returns the type of the implementation.
+    inline Type getType() const {
+      if(abstractTriangulation_ == &implicitTriangulation_)
+        return Type::IMPLICIT;
+      if(abstractTriangulation_ == &periodicImplicitTriangulation_)
+        return Type::PERIODIC;
+      return Type::EXPLICIT;
+    }
+
+    /// Get a hash of the input cells of an explicit triangulation, which
+    /// identifies it in its cache files (see writeToFile()).
+    /// \return Returns the hash, 0 if the triangulation is not explicit.
+    inline unsigned long long getCellsHash() const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return 0;
+      return explicitTriangulation_.getCellsHash();
+    }
+
+    /// Load the relations of an explicit triangulation, pre-processed by a
+    /// previous execution on the same input cells and saved with
+    /// writeToFile(). The file is memory-mapped, the relation tables are not
+    /// copied. The pre-processing functions then return immediately for the
+    /// loaded relations.
+    /// \pre setInputPoints() and setInputCells() need to be called first.
+    /// \param fileName Path to the cache file.
+    /// \return Returns 0 upon success, negative values if the triangulation
+    /// is not explicit, or if the file cannot be read, or was written by
+    /// another version or for other input cells.
+    inline int readFromFile(const std::string &fileName) {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return -1;
+      return explicitTriangulation_.readFromFile(fileName);
+    }
+
+    /// Write the pre-processed relations of an explicit triangulation
+    /// (edges, triangles, stars, links, boundary flags, etc.) to a versioned
+    /// binary cache file, to be loaded with readFromFile() by later
+    /// executions on the same input cells.
+    /// \param fileName Path to the cache file.
+    /// \return Returns 0 upon success, negative values if the triangulation
+    /// is not explicit or if the file cannot be written.
+    inline int writeToFile(const std::string &fileName) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return -1;
+      return explicitTriangulation_.writeToFile(fileName);
+    }
+
+    /// Identifier in the input of the \p cellId-th cell of a reordered
+    /// explicit triangulation (see reorderInput()).
+    /// \return Returns the input identifier (\p cellId if the triangulation
+    /// has not been reordered).
+    inline SimplexId getInputCellId(const SimplexId &cellId) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return cellId;
+      return explicitTriangulation_.getInputCellId(cellId);
+    }
+
+    /// Identifier in the input of the \p vertexId-th vertex of a reordered
+    /// explicit triangulation (see reorderInput()).
+    /// \return Returns the input identifier (\p vertexId if the
+    /// triangulation has not been reordered).
+    inline SimplexId getInputVertexId(const SimplexId &vertexId) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return vertexId;
+      return explicitTriangulation_.getInputVertexId(vertexId);
+    }
+
+    /// Identifier in a reordered explicit triangulation of the
+    /// \p inputCellId-th input cell (see reorderInput()).
+    inline SimplexId getReorderedCellId(const SimplexId &inputCellId) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return inputCellId;
+      return explicitTriangulation_.getReorderedCellId(inputCellId);
+    }
+
+    /// Identifier in a reordered explicit triangulation of the
+    /// \p inputVertexId-th input vertex (see reorderInput()).
+    inline SimplexId
+      getReorderedVertexId(const SimplexId &inputVertexId) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return inputVertexId;
+      return explicitTriangulation_.getReorderedVertexId(inputVertexId);
+    }
+
+    /// Returns true if the input of the (explicit) triangulation has been
+    /// reordered (see reorderInput()).
+    inline bool isReordered() const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return false;
+      return explicitTriangulation_.isReordered();
+    }
+
+    /// Renumber the vertices of an explicit triangulation along a Hilbert
+    /// space-filling curve, and its cells by increasing smallest vertex, to
+    /// improve the memory locality of the traversals. The triangulation
+    /// then works on internal copies of the input points and cells.
+    ///
+    /// All the identifiers used by the traversal functions then refer to
+    /// the reordered vertices and cells: per-vertex input data need to be
+    /// permuted with reorderVertexData() and the results mapped back with
+    /// getInputVertexId() and getInputCellId().
+    /// \pre setInputPoints() and setInputCells() need to be called first,
+    /// before any pre-processing.
+    /// \return Returns 0 upon success, negative values if the triangulation
+    /// is not explicit or has already been pre-processed.
+    inline int reorderInput() {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return -1;
+      return explicitTriangulation_.reorderInput();
+    }
+
+    /// Permute per-vertex input data (for instance a scalar field) into the
+    /// vertex order of a reordered explicit triangulation (see
+    /// reorderInput()).
+    /// \param inputData Input data, in the input vertex order.
+    /// \param data Output data (with the same size as \p inputData).
+    /// \param componentNumber Number of components per vertex.
+    /// \return Returns 0 upon success, negative values if the triangulation
+    /// is not explicit.
+    template <class dataType>
+    inline int reorderVertexData(const dataType *inputData,
+                                 dataType *data,
+                                 const int &componentNumber = 1) const {
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return -1;
+      return explicitTriangulation_.reorderVertexData(
+        inputData, data, componentNumber);
+    }
+
     /// Check if the triangle with global identifier \p triangleId is on the
     /// boundary of the domain.
     ///
@@ -3129,6 +3303,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the memory budget (in bytes) of the relation cache used in lazy
+    /// mode (default: 1 GB).
+    /// \sa setLazyMode()
+    inline int setCacheMemoryBudget(const size_t &memoryBudget) override {
+      explicitTriangulation_.setCacheMemoryBudget(memoryBudget);
+      return AbstractTriangulation::setCacheMemoryBudget(memoryBudget);
+    }
+
     /// Set the input cells for the triangulation.
     ///
     /// Here the notion of cell refers to the simplicices of maximal
@@ -3262,6 +3444,30 @@ namespace ttk {
         pointNumber, pointSet, doublePrecision);
     }
 
+    /// Enable or disable the lazy mode (default: disabled).
+    ///
+    /// In lazy mode, the following pre-processing functions only compute
+    /// the prerequisites of their relation:
+    ///   - preprocessEdgeLinks()
+    ///   - preprocessEdgeStars()
+    ///   - preprocessTriangleLinks()
+    ///   - preprocessVertexLinks()
+    ///
+    /// The relation is then computed by blocks of simplices upon the first
+    /// query on one of their simplices, and kept in a cache whose memory is
+    /// bounded (see setCacheMemoryBudget()). This is useful for interactive
+    /// or localized queries on large meshes. Only explicit triangulations
+    /// are affected (implicit triangulations do not store their relations).
+    ///
+    /// \note The legacy functions returning whole relations (for instance
+    /// getEdgeStars()) pre-process the relation for the whole triangulation
+    /// and copy it, which costs more memory than the eager mode: they print
+    /// a warning in lazy mode and should be avoided there.
+    inline int setLazyMode(const bool &lazyMode) override {
+      explicitTriangulation_.setLazyMode(lazyMode);
+      return AbstractTriangulation::setLazyMode(lazyMode);
+    }
+
     /// Tune the number of active threads (default: number of logical cores)
     inline int setThreadNumber(const ThreadId &threadNumber) {
       explicitTriangulation_.setThreadNumber(threadNumber);
@@ -3302,6 +3508,34 @@ namespace ttk {
   };
 } // namespace ttk
 
+/// \cond
+#define ttkTemplateMacroCase(triangulationType, triangulationClass, call) \
+  case triangulationType: {                                               \
+    typedef triangulationClass TTK_TT;                                    \
+    call;                                                                 \
+  }; break
+/// \endcond
+
+/// Static dispatch on the implementation of a ttk::Triangulation, in the
+/// spirit of vtkTemplateMacro(). \p call is instantiated once per
+/// implementation class, available as TTK_TT, for instance:
+/// \code
+/// ttkTemplateMacro(
+///   triangulation->getType(),
+///   (execute<TTK_TT>((TTK_TT *)triangulation->getData())));
+/// \endcode
+/// Since the implementation classes are final, the traversal functions called
+/// on TTK_TT are resolved at compile time and can be inlined.
+#define ttkTemplateMacro(triangulationType, call)                           \
+  switch(triangulationType) {                                              \
+    ttkTemplateMacroCase(                                                   \
+      ttk::Triangulation::Type::EXPLICIT, ttk::ExplicitTriangulation, call); \
+    ttkTemplateMacroCase(                                                   \
+      ttk::Triangulation::Type::IMPLICIT, ttk::ImplicitTriangulation, call); \
+    ttkTemplateMacroCase(ttk::Triangulation::Type::PERIODIC,                \
+                         ttk::PeriodicImplicitTriangulation, call);         \
+  }
+
 // if the package is not a template, comment the following line
 // #include                  <Triangulation.cpp>
 
@@ -0,0 +1,124 @@
+#include <VertexOrder.h>
+
+#include <list>
+#include <mutex>
+
+using namespace std;
+using namespace ttk;
+
+class VertexOrder::Cache {
+
+public:
+  Cache() : size_(4) {
+  }
+
+  // evict the least recently used orders. the mutex should be held.
+  inline void trim() {
+    while(entries_.size() > size_)
+      entries_.pop_back();
+  }
+
+  size_t size_;
+  // most recently used first
+  list<pair<Key, shared_ptr<const Order>>> entries_;
+  // the cache is shared by all the threads, whatever their runtime
+  mutex mutex_;
+};
+
+VertexOrder::VertexOrder() {
+
+  inputScalarField_ = nullptr;
+  inputOffsets_ = nullptr;
+  vertexNumber_ = 0;
+  modificationTime_ = 0;
+  previousScalarField_ = nullptr;
+  previousOffsets_ = nullptr;
+  updatedVertexNumber_ = 0;
+}
+
+VertexOrder::~VertexOrder() {
+}
+
+VertexOrder::Cache &VertexOrder::getCache() {
+  static Cache cache;
+  return cache;
+}
+
+shared_ptr<const VertexOrder::Order> VertexOrder::findInCache(const Key &key) {
+
+  Cache &cache = getCache();
+  shared_ptr<const Order> order;
+
+  lock_guard<mutex> lock(cache.mutex_);
+  for(auto it = cache.entries_.begin(); it != cache.entries_.end(); ++it) {
+    if(it->first.sameField(key)) {
+      if(it->first.modificationTime == key.modificationTime) {
+        order = it->second;
+        cache.entries_.splice(cache.entries_.begin(), cache.entries_, it);
+      } else {
+        // the field has been modified since
+        cache.entries_.erase(it);
+      }
+      break;
+    }
+  }
+
+  return order;
+}
+
+void VertexOrder::insertInCache(const Key &key,
+                                const shared_ptr<const Order> &order) {
+
+  Cache &cache = getCache();
+
+  lock_guard<mutex> lock(cache.mutex_);
+  for(auto it = cache.entries_.begin(); it != cache.entries_.end(); ++it) {
+    if(it->first.sameField(key)) {
+      cache.entries_.erase(it);
+      break;
+    }
+  }
+  cache.entries_.emplace_front(key, order);
+  cache.trim();
+}
+
+int VertexOrder::setCacheSize(const size_t &size) {
+
+  Cache &cache = getCache();
+
+  lock_guard<mutex> lock(cache.mutex_);
+  cache.size_ = size;
+  cache.trim();
+
+  return 0;
+}
+
+size_t VertexOrder::getCacheSize() {
+
+  Cache &cache = getCache();
+
+  lock_guard<mutex> lock(cache.mutex_);
+  return cache.size_;
+}
+
+void VertexOrder::clearCache() {
+
+  Cache &cache = getCache();
+
+  lock_guard<mutex> lock(cache.mutex_);
+  cache.entries_.clear();
+}
+
+int VertexOrder::getMemoryReport(MemoryReport &report) const {
+
+  if(order_) {
+    report.add("VertexOrder", "sortedVertices",
+               MemoryReport::bytes(order_->sortedVertices),
+               modificationTime_ ? "cached" : "");
+    report.add("VertexOrder", "vertexOrder",
+               MemoryReport::bytes(order_->vertexOrder),
+               modificationTime_ ? "cached" : "");
+  }
+
+  return 0;
+}
@@ -0,0 +1,554 @@
+/// \ingroup base
+/// \class ttk::VertexOrder
+/// \date October 2019.
+///
+/// \brief Shared computation of the total order of the vertices of a scalar
+/// field.
+///
+/// Most topological modules process the vertices by increasing scalar value,
+/// breaking the ties with an offset field (simulation of simplicity). This
+/// class computes that total order once: the list of the vertices sorted by
+/// increasing (value, offset, identifier) and, for each vertex, its position
+/// in that list. The position of a vertex is a valid offset field on its own:
+/// comparing positions is equivalent to comparing (value, offset) pairs.
+///
+/// The orders are kept in a process-wide cache, keyed by the addresses of
+/// the scalar and offset arrays, the number of vertices, the data types and
+/// a modification time provided by the caller (for instance the modification
+/// time of the VTK arrays). A pipeline chaining several modules on the same
+/// field therefore sorts it only once. When the modification time is 0
+/// (unknown), the order is computed but not cached.
+///
+/// The vertices are sorted with a parallel LSD radix sort (see
+/// ttk::RadixSort), first by offset then by scalar value. Floating-point and
+/// signed values are mapped to unsigned integer keys preserving their order,
+/// and only the bits which vary across the field are sorted. The sort is
+/// stable, so the vertex identifiers break the remaining ties, and its
+/// output does not depend on the compiler or on the number of threads.
+///
+/// For time-varying fields, the order of the previous time step can be
+/// updated instead of being recomputed (see setPreviousField()): only the
+/// vertices whose value or offset changed are sorted, and then merged with
+/// the other ones, which keep their previous relative order.
+///
+/// \sa ttk::ftm::FTMTree_MT
+/// \sa ttk::TopologicalSimplification
+/// \sa ttk::dcg::DiscreteGradient
+
+#ifndef _VERTEXORDER_H
+#define _VERTEXORDER_H
+
+#ifdef TTK_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+// base code includes
+#include <RadixSort.h>
+#include <Wrapper.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace ttk {
+
+  class VertexOrder : virtual public Debug {
+
+  public:
+    struct Order {
+      /// Vertex identifiers, by increasing order.
+      std::vector<SimplexId> sortedVertices;
+      /// Position of each vertex in sortedVertices.
+      std::vector<SimplexId> vertexOrder;
+    };
+
+    VertexOrder();
+
+    ~VertexOrder();
+
+    /// Compute (or fetch from the cache) the order of the vertices.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType, class idType = SimplexId>
+    int execute();
+
+    /// Order computed by the last call to execute().
+    inline std::shared_ptr<const Order> getOrder() const {
+      return order_;
+    }
+
+    /// Cache the order computed by the last call to execute() for the
+    /// current fields and modification time. This lets a module which
+    /// modifies a field without changing its order (for instance a
+    /// perturbation) publish that order for the next modules.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType, class idType = SimplexId>
+    int cacheOrder() const;
+
+    /// Vertex identifiers, by increasing order (shares the ownership of the
+    /// order).
+    inline std::shared_ptr<const std::vector<SimplexId>>
+      getSortedVertices() const {
+      if(!order_)
+        return nullptr;
+      return std::shared_ptr<const std::vector<SimplexId>>(
+        order_, &(order_->sortedVertices));
+    }
+
+    /// Position of each vertex in the order (shares the ownership of the
+    /// order).
+    inline std::shared_ptr<const std::vector<SimplexId>>
+      getVertexOrder() const {
+      if(!order_)
+        return nullptr;
+      return std::shared_ptr<const std::vector<SimplexId>>(
+        order_, &(order_->vertexOrder));
+    }
+
+    /// Set the scalar field to sort.
+    inline int setInputScalarField(const void *data) {
+      inputScalarField_ = data;
+      return 0;
+    }
+
+    /// Set the offset field used to break the ties. If none is set (or if
+    /// it is set to nullptr), the vertex identifiers are used instead.
+    inline int setInputOffsets(const void *data) {
+      inputOffsets_ = data;
+      return 0;
+    }
+
+    /// Set the modification time of the scalar and offset fields. The order
+    /// is cached only if it is non-zero.
+    inline int setModificationTime(const unsigned long long &time) {
+      modificationTime_ = time;
+      return 0;
+    }
+
+    inline int setVertexNumber(const SimplexId &vertexNumber) {
+      vertexNumber_ = vertexNumber;
+      return 0;
+    }
+
+    /// Incremental mode for time-varying fields: \p order is the order of
+    /// the previous field (\p scalars and \p offsets, of the same types as
+    /// the current ones, nullptr offsets standing for the vertex
+    /// identifiers). The previous arrays should not be the current ones: if
+    /// they are, the field is considered as unchanged.
+    inline int setPreviousField(const void *scalars,
+                                const void *offsets,
+                                const std::shared_ptr<const Order> &order) {
+      previousScalarField_ = scalars;
+      previousOffsets_ = offsets;
+      previousOrder_ = order;
+      return 0;
+    }
+
+    /// Number of vertices whose value or offset changed since the previous
+    /// field, as found by the last call to execute() (all the vertices if
+    /// no previous field is set).
+    inline SimplexId getUpdatedVertexNumber() const {
+      return updatedVertexNumber_;
+    }
+
+    int getMemoryReport(MemoryReport &report) const override;
+
+    /// Maximum number of orders kept in the cache (default: 4).
+    static int setCacheSize(const size_t &size);
+
+    static size_t getCacheSize();
+
+    /// Remove all the orders from the cache. The orders still referenced by
+    /// the modules remain valid.
+    static void clearCache();
+
+  protected:
+    struct Key {
+      const void *scalars;
+      const void *offsets;
+      SimplexId vertexNumber;
+      const std::type_info *dataType;
+      const std::type_info *idType;
+      unsigned long long modificationTime;
+
+      inline bool sameField(const Key &rhs) const {
+        return (scalars == rhs.scalars) && (offsets == rhs.offsets)
+               && (vertexNumber == rhs.vertexNumber)
+               && (*dataType == *rhs.dataType) && (*idType == *rhs.idType);
+      }
+    };
+
+    // process-wide cache, defined in VertexOrder.cpp
+    class Cache;
+
+    static Cache &getCache();
+
+    static std::shared_ptr<const Order> findInCache(const Key &key);
+
+    static void insertInCache(const Key &key,
+                              const std::shared_ptr<const Order> &order);
+
+    template <class dataType, class idType>
+    inline Key getKey() const {
+      Key key;
+      key.scalars = inputScalarField_;
+      key.offsets = inputOffsets_;
+      key.vertexNumber = vertexNumber_;
+      key.dataType = &typeid(dataType);
+      key.idType = &typeid(idType);
+      key.modificationTime = modificationTime_;
+      return key;
+    }
+
+    /// Order-preserving conversion of an integer to an unsigned key.
+    template <class valueType>
+    static inline
+      typename std::enable_if<std::is_integral<valueType>::value,
+                              uint64_t>::type
+      radixKey(const valueType &value) {
+      if(std::is_signed<valueType>::value)
+        return ((uint64_t)(int64_t)value) ^ (((uint64_t)1) << 63);
+      return (uint64_t)value;
+    }
+
+    /// Order-preserving conversion of a float to an unsigned key (the
+    /// two zeros get the same key).
+    static inline uint64_t radixKey(const float &value) {
+      const float v = (value == 0) ? 0 : value;
+      uint32_t bits;
+      std::memcpy(&bits, &v, sizeof(bits));
+      return (bits >> 31) ? (uint32_t)~bits : (bits | (((uint32_t)1) << 31));
+    }
+
+    /// Order-preserving conversion of a double to an unsigned key (the
+    /// two zeros get the same key).
+    static inline uint64_t radixKey(const double &value) {
+      const double v = (value == 0) ? 0 : value;
+      uint64_t bits;
+      std::memcpy(&bits, &v, sizeof(bits));
+      return (bits >> 63) ? ~bits : (bits | (((uint64_t)1) << 63));
+    }
+
+    /// Stable radix sort of \p vertices by \p getKey (offset by
+    /// \p minKey).
+    template <class keyType, class keyFunctor>
+    void sortByKey(std::vector<SimplexId> &vertices,
+                   const keyFunctor &getKey,
+                   const uint64_t &minKey,
+                   const int &bitNumber) const;
+
+    /// Stable sort of \p vertices by increasing \p values.
+    template <class valueType>
+    void sortVertices(std::vector<SimplexId> &vertices,
+                      const valueType *values) const;
+
+    /// Check if \p values are non-decreasing with the vertex identifiers.
+    template <class valueType>
+    bool isSorted(const valueType *values) const;
+
+    /// Update the previous order into \p order (incremental mode), left
+    /// empty if no vertex changed.
+    /// \return Returns false if too many vertices changed: sorting them all
+    /// is then faster.
+    template <class dataType, class idType>
+    bool updateOrder(Order &order);
+
+    const void *inputScalarField_;
+    const void *inputOffsets_;
+    SimplexId vertexNumber_;
+    unsigned long long modificationTime_;
+    std::shared_ptr<const Order> order_;
+
+    const void *previousScalarField_;
+    const void *previousOffsets_;
+    std::shared_ptr<const Order> previousOrder_;
+    SimplexId updatedVertexNumber_;
+  };
+} // namespace ttk
+
+template <class keyType, class keyFunctor>
+void ttk::VertexOrder::sortByKey(std::vector<SimplexId> &vertices,
+                                 const keyFunctor &getKey,
+                                 const uint64_t &minKey,
+                                 const int &bitNumber) const {
+
+  struct Item {
+    keyType key;
+    SimplexId vertex;
+  };
+
+  const SimplexId vertexNumber = vertices.size();
+  std::vector<Item> items(vertexNumber), buffer;
+
+  // gather the keys once, so that the radix passes read them sequentially
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    items[i].key = static_cast<keyType>(getKey(vertices[i]) - minKey);
+    items[i].vertex = vertices[i];
+  }
+
+  RadixSort::sort(
+    items, buffer, [](const Item &item) { return item.key; }, bitNumber,
+    threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++)
+    vertices[i] = items[i].vertex;
+}
+
+template <class valueType>
+void ttk::VertexOrder::sortVertices(std::vector<SimplexId> &vertices,
+                                    const valueType *values) const {
+
+  const SimplexId vertexNumber = vertices.size();
+
+  uint64_t minKey = std::numeric_limits<uint64_t>::max();
+  uint64_t maxKey = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(min : minKey) reduction(max : maxKey)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    const uint64_t key = radixKey(values[i]);
+    if(key < minKey)
+      minKey = key;
+    if(key > maxKey)
+      maxKey = key;
+  }
+
+  // only the bits which vary across the field are sorted
+  const int bitNumber = RadixSort::keyBits(maxKey - minKey);
+  if(!bitNumber)
+    return;
+
+  const auto getKey
+    = [values](const SimplexId &vertex) { return radixKey(values[vertex]); };
+
+  if(bitNumber <= 32)
+    sortByKey<uint32_t>(vertices, getKey, minKey, bitNumber);
+  else
+    sortByKey<uint64_t>(vertices, getKey, minKey, bitNumber);
+}
+
+template <class valueType>
+bool ttk::VertexOrder::isSorted(const valueType *values) const {
+
+  bool isSorted = true;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(&& : isSorted)
+#endif
+  for(SimplexId i = 1; i < vertexNumber_; i++) {
+    if(radixKey(values[i - 1]) > radixKey(values[i]))
+      isSorted = false;
+  }
+
+  return isSorted;
+}
+
+template <class dataType, class idType>
+bool ttk::VertexOrder::updateOrder(Order &order) {
+
+  const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
+  const idType *offsets = static_cast<const idType *>(inputOffsets_);
+  const dataType *previousScalars
+    = static_cast<const dataType *>(previousScalarField_);
+  const idType *previousOffsets = static_cast<const idType *>(previousOffsets_);
+  const std::vector<SimplexId> &previousSortedVertices
+    = previousOrder_->sortedVertices;
+
+  // (value, offset, identifier) comparison, as done by the radix sorts
+  const auto getOffsetKey = [](const idType *o, const SimplexId &vertex) {
+    return o ? radixKey(o[vertex]) : radixKey(vertex);
+  };
+  const auto isLower = [&](const SimplexId &a, const SimplexId &b) {
+    const uint64_t ka = radixKey(scalars[a]), kb = radixKey(scalars[b]);
+    if(ka != kb)
+      return ka < kb;
+    const uint64_t oa = getOffsetKey(offsets, a), ob = getOffsetKey(offsets, b);
+    if(oa != ob)
+      return oa < ob;
+    return a < b;
+  };
+
+  std::vector<char> isUpdated(vertexNumber_);
+  SimplexId updatedNumber = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(+ : updatedNumber)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    isUpdated[i]
+      = (radixKey(scalars[i]) != radixKey(previousScalars[i]))
+        || (getOffsetKey(offsets, i) != getOffsetKey(previousOffsets, i));
+    updatedNumber += isUpdated[i];
+  }
+  updatedVertexNumber_ = updatedNumber;
+  if(!updatedNumber)
+    return true;
+
+  // beyond that, a full radix sort is faster than a comparison sort of the
+  // updated vertices
+  if(updatedNumber > vertexNumber_ / 8)
+    return false;
+
+  std::vector<SimplexId> &sortedVertices = order.sortedVertices;
+  std::vector<SimplexId> &vertexOrder = order.vertexOrder;
+
+  // the other vertices keep their relative order
+  std::vector<SimplexId> updated;
+  updated.reserve(updatedNumber);
+  sortedVertices.resize(vertexNumber_);
+  SimplexId keptNumber = 0;
+  for(const SimplexId v : previousSortedVertices) {
+    if(isUpdated[v])
+      updated.push_back(v);
+    else
+      sortedVertices[keptNumber++] = v;
+  }
+  std::sort(updated.begin(), updated.end(), isLower);
+
+  // in-place merge, from the end
+  SimplexId i = keptNumber - 1, j = updatedNumber - 1;
+  for(SimplexId k = vertexNumber_ - 1; j >= 0; k--) {
+    if(i >= 0 && isLower(updated[j], sortedVertices[i]))
+      sortedVertices[k] = sortedVertices[i--];
+    else
+      sortedVertices[k] = updated[j--];
+  }
+
+  // only the vertices which moved get a new position
+  vertexOrder = previousOrder_->vertexOrder;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; k++) {
+    if(sortedVertices[k] != previousSortedVertices[k])
+      vertexOrder[sortedVertices[k]] = k;
+  }
+
+  return true;
+}
+
+template <class dataType, class idType>
+int ttk::VertexOrder::execute() {
+
+  Timer t;
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!inputScalarField_)
+    return -1;
+  if(vertexNumber_ < 0)
+    return -2;
+#endif
+
+  const Key key = getKey<dataType, idType>();
+
+  updatedVertexNumber_ = vertexNumber_;
+
+  const bool incremental
+    = previousOrder_ && previousScalarField_
+      && (SimplexId)previousOrder_->sortedVertices.size() == vertexNumber_;
+
+  if(incremental && previousScalarField_ == inputScalarField_
+     && previousOffsets_ == inputOffsets_) {
+    order_ = previousOrder_;
+    updatedVertexNumber_ = 0;
+    return 0;
+  }
+
+  if(modificationTime_) {
+    order_ = findInCache(key);
+    if(order_) {
+      std::stringstream msg;
+      msg << "[VertexOrder] Order of " << vertexNumber_
+          << " vertices found in the cache." << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+      return 0;
+    }
+  }
+
+  const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
+  const idType *offsets = static_cast<const idType *>(inputOffsets_);
+
+  std::shared_ptr<Order> order = std::make_shared<Order>();
+  std::vector<SimplexId> &sortedVertices = order->sortedVertices;
+  std::vector<SimplexId> &vertexOrder = order->vertexOrder;
+
+  if(incremental && updateOrder<dataType, idType>(*order)) {
+    if(updatedVertexNumber_)
+      order_ = order;
+    else
+      order_ = previousOrder_;
+    if(modificationTime_)
+      insertInCache(key, order_);
+
+    std::stringstream msg;
+    msg << "[VertexOrder] Updated the order of " << vertexNumber_
+        << " vertices (" << updatedVertexNumber_ << " changed) in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+    return 0;
+  }
+
+  sortedVertices.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    sortedVertices[i] = i;
+
+  // least significant key first: the vertices are initially sorted by
+  // identifier and each sort is stable. the offset pass is skipped when the
+  // offsets already follow the identifiers (default offsets).
+  if(offsets && !isSorted(offsets))
+    sortVertices(sortedVertices, offsets);
+  sortVertices(sortedVertices, scalars);
+
+  vertexOrder.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    vertexOrder[sortedVertices[i]] = i;
+
+  order_ = order;
+  if(modificationTime_)
+    insertInCache(key, order_);
+
+  {
+    std::stringstream msg;
+    msg << "[VertexOrder] Sorted " << vertexNumber_ << " vertices in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <class dataType, class idType>
+int ttk::VertexOrder::cacheOrder() const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!order_)
+    return -1;
+  if((SimplexId)order_->sortedVertices.size() != vertexNumber_)
+    return -2;
+#endif
+
+  if(modificationTime_)
+    insertInCache(getKey<dataType, idType>(), order_);
+
+  return 0;
+}
+
+#endif // _VERTEXORDER_H
@@ -42,6 +42,7 @@ ttkContourForests::ttkContourForests()
   arcResolution_ = 20;
   skeletonSmoothing_ = 15;
   lessPartition_ = 1;
+  TaskRuntimeType = (int)TaskRuntime::getDefaultType();
   partitionNum_ = -1;
 
   UseAllCores = true;
@@ -1401,6 +1402,7 @@ void ttkContourForests::getTree() {
   contourTree_.setTreeType(treeType_);
   // parallel params
   contourTree_.setLessPartition(lessPartition_);
+  contourTree_.setTaskRuntimeType((TaskRuntime::Type)TaskRuntimeType);
   contourTree_.setThreadNumber(threadNumber_);
   contourTree_.setPartitionNum(partitionNum_);
   // simplification params
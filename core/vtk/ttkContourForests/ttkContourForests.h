@@ -116,6 +116,10 @@ public:
   void SetPartitionNumber(int partitionNum);
   void SetLessPartition(bool l);
 
+  // see ttk::TaskRuntime::Type
+  vtkSetMacro(TaskRuntimeType, int);
+  vtkGetMacro(TaskRuntimeType, int);
+
   void SetSkeletonSmoothing(double skeletonSmooth);
 
   void SetSimplificationType(int type);
@@ -187,6 +191,7 @@ private:
   std::string inputOffsetScalarFieldName_;
   bool isLoaded_;
   bool lessPartition_;
+  int TaskRuntimeType;
   ttk::cf::MergeTree *tree_;
   ttk::cf::ContourForests contourTree_;
   vtkPolyData *skeletonNodes_;
@@ -371,9 +371,19 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
   for(int cc = 0; cc < nbCC_; cc++) {
     ftmTree_[cc].tree.setVertexScalars(inputScalars_[cc]->GetVoidPointer(0));
     ftmTree_[cc].tree.setVertexSoSoffsets(offsets_[cc].data());
+    // the vertex order is shared with the other modules (ttk::VertexOrder)
+    // as long as the arrays are not modified
+    unsigned long long modificationTime = inputScalars_[cc]->GetMTime();
+    if(inputOffsets_[cc]) {
+      modificationTime = std::max(
+        modificationTime, (unsigned long long)inputOffsets_[cc]->GetMTime());
+    }
+    ftmTree_[cc].tree.setScalarsModificationTime(modificationTime);
     ftmTree_[cc].tree.setTreeType(GetTreeType());
     ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
     ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
+    ftmTree_[cc].tree.setTaskRuntimeType(
+      (ttk::TaskRuntime::Type)TaskRuntimeType);
 
     switch(inputScalars_[cc]->GetDataType()) {
       vtkTemplateMacro((ftmTree_[cc].tree.build<VTK_TT, SimplexId>()));
@@ -428,8 +438,9 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
 
 int ttkFTMTree::getOffsets() {
   offsets_.resize(nbCC_);
+  inputOffsets_.resize(nbCC_);
   for(int cc = 0; cc < nbCC_; cc++) {
-    vtkDataArray *inputOffsets;
+    vtkDataArray *inputOffsets = nullptr;
     if(OffsetFieldId != -1) {
       inputOffsets
         = connected_components_[cc]->GetPointData()->GetArray(OffsetFieldId);
@@ -458,6 +469,7 @@ int ttkFTMTree::getOffsets() {
         offsets_[cc][i] = inputOffsets->GetTuple1(i);
       }
     } else {
+      inputOffsets = nullptr;
       if(hasUpdatedMesh_ and offsets_[cc].size()) {
         // don't keep an out-dated offset array
         offsets_[cc].clear();
@@ -481,6 +493,7 @@ int ttkFTMTree::getOffsets() {
       return -1;
     }
 #endif
+    inputOffsets_[cc] = inputOffsets;
   }
 
   return 0;
@@ -720,8 +733,10 @@ int ttkFTMTree::setupTriangulation() {
 ttkFTMTree::ttkFTMTree()
   : ScalarField{}, ForceInputOffsetScalarField{false},
     InputOffsetScalarFieldName{ttk::OffsetScalarFieldName}, ScalarFieldId{},
-    OffsetFieldId{-1}, PeriodicBoundaryConditions{false}, params_{},
-    triangulation_{}, inputScalars_{}, offsets_{}, hasUpdatedMesh_{} {
+    OffsetFieldId{-1}, PeriodicBoundaryConditions{false},
+    TaskRuntimeType{(int)ttk::TaskRuntime::getDefaultType()}, params_{},
+    triangulation_{}, inputScalars_{}, inputOffsets_{}, offsets_{},
+    hasUpdatedMesh_{} {
   SetSuperArcSamplingLevel(0);
   SetWithNormalize(true);
   SetWithAdvStats(true);
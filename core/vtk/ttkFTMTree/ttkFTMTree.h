@@ -74,6 +74,10 @@ public:
   vtkSetMacro(PeriodicBoundaryConditions, int);
   vtkGetMacro(PeriodicBoundaryConditions, int);
 
+  // see ttk::TaskRuntime::Type
+  vtkSetMacro(TaskRuntimeType, int);
+  vtkGetMacro(TaskRuntimeType, int);
+
   // Parameters uses a structure, we can't use vtkMacro on them
   void SetTreeType(const int type) {
     params_.treeType = (ttk::ftm::TreeType)type;
@@ -172,6 +176,7 @@ private:
   int ScalarFieldId;
   int OffsetFieldId;
   bool PeriodicBoundaryConditions;
+  int TaskRuntimeType;
 
   ttk::ftm::Params params_;
 
@@ -180,6 +185,8 @@ private:
   std::vector<ttk::Triangulation *> triangulation_;
   std::vector<ttk::ftm::LocalFTM> ftmTree_;
   std::vector<vtkDataArray *> inputScalars_;
+  // arrays copied into offsets_ (nullptr for the vertex identifiers)
+  std::vector<vtkDataArray *> inputOffsets_;
   std::vector<std::vector<ttk::SimplexId>> offsets_;
 
   bool hasUpdatedMesh_;
@@ -259,6 +259,7 @@ int ttkFTRGraph::dispatch(Graph &graph) {
   // common parameters
   ftrGraph_.setWrapper(this);
   ftrGraph_.setParams(params_);
+  ftrGraph_.setTaskRuntimeType((ttk::TaskRuntime::Type)TaskRuntimeType);
   // reeb graph parameters
   ftrGraph_.setScalars(inputScalars_->GetVoidPointer(0));
   ftrGraph_.setVertexSoSoffsets(&offsets_);
@@ -550,8 +551,9 @@ int ttkFTRGraph::setupTriangulation() {
 
 ttkFTRGraph::ttkFTRGraph()
   : ScalarField{}, UseInputOffsetScalarField{}, InputOffsetScalarFieldName{},
-    ScalarFieldId{}, OffsetFieldId{-1}, params_{}, mesh_{}, triangulation_{},
-    inputScalars_{}, offsets_{}, hasUpdatedMesh_{} {
+    ScalarFieldId{}, OffsetFieldId{-1},
+    TaskRuntimeType{(int)ttk::TaskRuntime::getDefaultType()}, params_{},
+    mesh_{}, triangulation_{}, inputScalars_{}, offsets_{}, hasUpdatedMesh_{} {
   SetNumberOfInputPorts(1);
   SetNumberOfOutputPorts(3);
 }
@@ -43,6 +43,7 @@ private:
   std::string InputOffsetScalarFieldName;
   int ScalarFieldId;
   int OffsetFieldId;
+  int TaskRuntimeType;
 
   ttk::ftr::Params params_;
 
@@ -99,6 +100,10 @@ public:
 
   vtkSetMacro(Dummy, bool);
 
+  // see ttk::TaskRuntime::Type
+  vtkSetMacro(TaskRuntimeType, int);
+  vtkGetMacro(TaskRuntimeType, int);
+
   void SetSingleSweep(const bool ss) {
     params_.singleSweep = ss;
     Modified();
@@ -967,6 +967,10 @@ int ttkMorseSmaleComplex::doIt(vector<vtkDataSet *> &inputs,
 
   morseSmaleComplex_.setInputScalarField(inputScalars->GetVoidPointer(0));
   morseSmaleComplex_.setInputOffsets(inputOffsets->GetVoidPointer(0));
+  // share the vertex order of the saddle connector filtering with the other
+  // modules, until the arrays are modified
+  morseSmaleComplex_.setInputModificationTime(
+    std::max(inputScalars->GetMTime(), inputOffsets->GetMTime()));
 
   void *ascendingManifoldPtr = nullptr;
   void *descendingManifoldPtr = nullptr;
@@ -311,6 +311,10 @@ int ttkPersistenceCurve::doIt(vtkDataSet *input,
   persistenceCurve_.setWrapper(this);
   persistenceCurve_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceCurve_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // share the vertex order with the other modules, until the arrays are
+  // modified
+  persistenceCurve_.setInputModificationTime(
+    std::max(inputScalars_->GetMTime(), inputOffsets_->GetMTime()));
   persistenceCurve_.setComputeSaddleConnectors(ComputeSaddleConnectors);
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
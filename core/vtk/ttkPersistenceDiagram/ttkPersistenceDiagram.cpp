@@ -9,7 +9,8 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   ttkPersistenceDiagram::ttkPersistenceDiagram()
   : UseAllCores{}, inputScalars_{},
     CTPersistenceDiagram_{vtkUnstructuredGrid::New()}, offsets_{},
-    inputOffsets_{}, varyingMesh_{} {
+    inputOffsets_{}, previousScalarsMTime_{}, previousOffsetsMTime_{},
+    varyingMesh_{} {
   SetNumberOfInputPorts(1);
   SetNumberOfOutputPorts(1);
 
@@ -23,6 +24,7 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   ShowInsideDomain = false;
   computeDiagram_ = true;
   PeriodicBoundaryConditions = false;
+  IncrementalSort = false;
 
   triangulation_ = nullptr;
   CTDiagram_ = nullptr;
@@ -298,11 +300,43 @@ int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
   persistenceDiagram_.setDMTPairs(&dmt_pairs);
   persistenceDiagram_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceDiagram_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // share the vertex order with the other modules, until the arrays are
+  // modified
+  persistenceDiagram_.setInputModificationTime(
+    std::max(inputScalars_->GetMTime(), inputOffsets_->GetMTime()));
   persistenceDiagram_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+
+  // new time step on the same mesh: only the vertices which changed since
+  // the previous computation are sorted (the pairs are fully recomputed).
+  // the previous arrays must not have been modified in place since.
+  if(IncrementalSort and !varyingMesh_ and previousScalars_
+     and previousScalars_ != inputScalars_
+     and previousScalars_->GetDataType() == inputScalars_->GetDataType()
+     and previousOffsets_->GetDataType() == inputOffsets_->GetDataType()
+     and previousScalars_->GetNumberOfTuples()
+           == inputScalars_->GetNumberOfTuples()
+     and previousScalars_->GetMTime() == previousScalarsMTime_
+     and previousOffsets_->GetMTime() == previousOffsetsMTime_) {
+    persistenceDiagram_.setPreviousStep(previousScalars_->GetVoidPointer(0),
+                                        previousOffsets_->GetVoidPointer(0),
+                                        persistenceDiagram_.getOrder(),
+                                        nullptr);
+  } else {
+    persistenceDiagram_.setPreviousStep(nullptr, nullptr, nullptr, nullptr);
+  }
+
+  const bool computeDiagram = computeDiagram_;
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
   }
 
+  if(IncrementalSort and computeDiagram and !ret) {
+    previousScalars_ = inputScalars_;
+    previousScalarsMTime_ = inputScalars_->GetMTime();
+    previousOffsets_ = inputOffsets_;
+    previousOffsetsMTime_ = inputOffsets_->GetMTime();
+  }
+
   outputCTPersistenceDiagram->ShallowCopy(CTPersistenceDiagram_);
   computeDiagram_ = false;
 
@@ -32,6 +32,13 @@
 /// See the related ParaView example state files for usage examples within a
 /// VTK pipeline.
 ///
+/// For time-varying fields on a fixed mesh, SetIncrementalSort() keeps the
+/// scalar and offset arrays of the previous time step, so that only the
+/// vertices which changed are sorted again. This holds a reference on two
+/// more arrays and is therefore disabled by default. Only the sort is
+/// incremental: the merge trees (or the streaming pairs) are recomputed in
+/// full at each time step.
+///
 /// \b Related \b publication \n
 /// "Computational Topology: An Introduction" \n
 /// Herbert Edelsbrunner and John Harer \n
@@ -148,6 +155,16 @@ public:
   }
   vtkGetMacro(PeriodicBoundaryConditions, int);
 
+  void SetIncrementalSort(int onOff) {
+    IncrementalSort = onOff;
+    if(!IncrementalSort) {
+      previousScalars_ = nullptr;
+      previousOffsets_ = nullptr;
+    }
+    Modified();
+  }
+  vtkGetMacro(IncrementalSort, int);
+
   int getScalars(vtkDataSet *input);
   int getTriangulation(vtkDataSet *input);
   int getOffsets(vtkDataSet *input);
@@ -224,6 +241,7 @@ private:
   bool ComputeSaddleConnectors;
   int ShowInsideDomain;
   bool PeriodicBoundaryConditions;
+  bool IncrementalSort;
 
   ttk::PersistenceDiagram persistenceDiagram_;
   ttk::Triangulation *triangulation_;
@@ -231,6 +249,11 @@ private:
   vtkUnstructuredGrid *CTPersistenceDiagram_;
   vtkDataArray *offsets_;
   vtkDataArray *inputOffsets_;
+  // fields of the previous computation, kept alive for the incremental sort
+  // of time-varying fields (see ttk::PersistenceDiagram::setPreviousStep()),
+  // only if IncrementalSort is enabled
+  vtkSmartPointer<vtkDataArray> previousScalars_, previousOffsets_;
+  unsigned long long previousScalarsMTime_, previousOffsetsMTime_;
   bool varyingMesh_;
   int ScalarFieldId, OffsetFieldId;
   void *CTDiagram_;
@@ -23,11 +23,11 @@ vtkStandardNewMacro(ttkScalarFieldCriticalPoints)
 ttkScalarFieldCriticalPoints::~ttkScalarFieldCriticalPoints() {
 }
 
-template <typename VTK_TT>
-int ttkScalarFieldCriticalPoints::dispatch(Triangulation *triangulation,
+template <typename VTK_TT, typename TTK_TT>
+int ttkScalarFieldCriticalPoints::dispatch(TTK_TT *triangulation,
                                            void *scalarValues,
                                            const SimplexId vertexNumber) {
-  ScalarFieldCriticalPoints<VTK_TT> criticalPoints;
+  ScalarFieldCriticalPoints<VTK_TT, TTK_TT> criticalPoints;
   criticalPoints.setupTriangulation(triangulation);
   int domainDimension = triangulation->getCellVertexNumber(0) - 1;
 
@@ -149,10 +149,22 @@ int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
     }
   }
 
+#ifndef TTK_ENABLE_KAMIKAZE
+  // the implementation is called directly below
+  if(!triangulation->getData()) {
+    cerr << "[ttkScalarFieldCriticalPoints] Error: input triangulation is "
+            "empty."
+         << endl;
+    return -1;
+  }
+#endif
+
   switch(inputScalarField->GetDataType()) {
-    vtkTemplateMacro(dispatch<VTK_TT>(triangulation,
-                                      inputScalarField->GetVoidPointer(0),
-                                      input->GetNumberOfPoints()));
+    vtkTemplateMacro(ttkTemplateMacro(
+      triangulation->getType(),
+      (dispatch<VTK_TT, TTK_TT>((TTK_TT *)triangulation->getData(),
+                                inputScalarField->GetVoidPointer(0),
+                                input->GetNumberOfPoints()))));
   }
 
   // allocate the output
@@ -108,8 +108,8 @@ public:
     return 1;
   }
 
-  template <typename VTK_TT>
-  int dispatch(ttk::Triangulation *triangulation,
+  template <typename VTK_TT, typename TTK_TT>
+  int dispatch(TTK_TT *triangulation,
                void *scalarValues,
                const ttk::SimplexId vertexNumber);
 
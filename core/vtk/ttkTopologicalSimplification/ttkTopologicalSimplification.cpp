@@ -354,6 +354,10 @@ int ttkTopologicalSimplification::doIt(vector<vtkDataSet *> &inputs,
 
   topologicalSimplification_.setOutputOffsetScalarFieldPointer(
     outputOffsets->GetVoidPointer(0));
+  // the order of the perturbed field is cached under the time at which the
+  // output arrays are read by the next filters
+  topologicalSimplification_.setOutputModificationTime(std::max(
+    outputScalars->GetMTime(), outputOffsets->GetMTime()));
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(identifiers_->GetDataType() != inputOffsets_->GetDataType()) {
@@ -16,10 +16,14 @@ int main(int argc, char **argv) {
 
   int fieldId = 0;
   int treeType = 0;
+  int taskRuntime = (int)TaskRuntime::getDefaultType();
 
   program.parser_.setArgument("f", &fieldId, "Field identifier", true);
   program.parser_.setArgument(
     "T", &treeType, "Tree type {0: JT, 1: ST, 2: CT}", true);
+  program.parser_.setArgument(
+    "R", &taskRuntime,
+    "Task runtime {0: sequential, 1: OpenMP, 2: work stealing}", true);
 
   int ret = 0;
   ret = program.init(argc, argv);
@@ -29,6 +33,7 @@ int main(int argc, char **argv) {
 
   program.ttkObject_->SetScalarFieldId(fieldId);
   program.ttkObject_->SetTreeType(treeType);
+  program.ttkObject_->SetTaskRuntimeType(taskRuntime);
 
   // execute data processing
   ret = program.run();